@@ -0,0 +1,220 @@
+/**
+ * Frame cost of banded rendering against the full framebuffer, for the same scene of text, lines and runs.
+ *
+ * Full-buffer mode draws the scene into the 48 KB framebuffer and copies it into the SPI chunks; banded mode
+ * renders each 40-row strip of the scene straight into a chunk. The strips are compared against the framebuffer
+ * before timing. Frame times add the SPI transfer of both planes at 12 MHz, overlapped with the chunk preparation
+ * the way epaper_write_data_stream() overlaps them: a chunk costs the longer of its preparation and the transfer
+ * of the one before it.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "dlist.h"
+#include "epaper.h"
+
+#define BENCH_SECONDS 0.5
+#define CHUNK_SIZE 4000
+#define CHUNK_ROWS (CHUNK_SIZE / DISPLAY_STRIDE)
+#define CHUNKS (DISPLAY_BUFFER_SIZE / CHUNK_SIZE)
+#define SPI_BYTES_PER_US (12.0 / 8)
+#define SCENE_LINES (DISPLAY_HEIGHT / 24)
+// DISPLAY_LIST_SIZE in display.c
+#define LIST_SIZE 8192
+
+static uint8_t framebuffer[DISPLAY_BUFFER_SIZE];
+static uint8_t banded[DISPLAY_BUFFER_SIZE];
+static uint8_t chunks[2][CHUNK_SIZE];
+static DisplayList scene;
+
+static double now_seconds()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void put_item(const DisplayItem* item, const void* data)
+{
+    Rect replaced;
+
+    if (!dlist_put(&scene, item, data, &replaced)) {
+        fprintf(stderr, "scene does not fit the display list\n");
+        exit(1);
+    }
+}
+
+static void build_scene(bool red)
+{
+    static const char box_text[] = "Banded rendering keeps only two strips of the frame in memory at any time.";
+
+    dlist_clear(&scene);
+
+    for (int row = 0; row < SCENE_LINES; row++) {
+        char text[51] = { 0 };
+        DisplayItem item = { .type = DLIST_ITEM_TEXT, .x = 0, .y = row * 24, .length = sizeof(text) };
+
+        item.color = red && row % 4 == 0 ? COLOR_RED : COLOR_BLACK;
+        for (int i = 0; i < 50; i++) {
+            text[i] = 0x20 + (row * 50 + i) % 95;
+        }
+        put_item(&item, text);
+    }
+
+    put_item(&(DisplayItem) { .type = DLIST_ITEM_LINE, .x = 0, .y = 0, .x2 = 799, .y2 = 479 }, NULL);
+    put_item(&(DisplayItem) { .type = DLIST_ITEM_LINE, .x = 799, .y = 0, .x2 = 0, .y2 = 479 }, NULL);
+    put_item(&(DisplayItem) { .type = DLIST_ITEM_RUN, .x = 100, .y = 250, .width = 600, .height = 1 }, NULL);
+    put_item(
+        &(DisplayItem) {
+            .type = DLIST_ITEM_TEXT_BOX,
+            .x = 400,
+            .y = 300,
+            .width = 300,
+            .height = 100,
+            .color = red ? COLOR_RED : COLOR_BLACK,
+            .layout = { .align = LAYOUT_ALIGN_CENTER, .flags = LAYOUT_WRAP | LAYOUT_ELLIPSIS },
+            .length = sizeof(box_text),
+        },
+        box_text);
+}
+
+static void render_full(uint8_t plane)
+{
+    Raster raster = { .buffer = framebuffer, .width = DISPLAY_WIDTH, .height = DISPLAY_HEIGHT, .stride = DISPLAY_STRIDE };
+
+    dlist_render(&scene, &raster, plane, NULL);
+}
+
+static void render_band(uint8_t* chunk, int index, uint8_t plane)
+{
+    Raster band = {
+        .buffer = chunk,
+        .width = DISPLAY_WIDTH,
+        .height = CHUNK_ROWS,
+        .stride = DISPLAY_STRIDE,
+        .top = index * CHUNK_ROWS,
+    };
+
+    dlist_render(&scene, &band, plane, NULL);
+}
+
+/**
+ * Average time to prepare each chunk of one plane, in microseconds; `setup_us` receives the time spent before
+ * the first chunk can be prepared (the framebuffer render in full-buffer mode).
+ */
+static void time_plane(bool use_bands, uint8_t plane, double* setup_us, double* chunk_us)
+{
+    uint64_t frames = 0;
+    double setup = 0;
+    double chunk_time[CHUNKS] = { 0 };
+    double start = now_seconds();
+
+    do {
+        double t = now_seconds();
+
+        if (!use_bands) {
+            render_full(plane);
+            setup += now_seconds() - t;
+        }
+
+        for (int i = 0; i < CHUNKS; i++) {
+            t = now_seconds();
+            if (use_bands) {
+                render_band(chunks[i % 2], i, plane);
+            } else {
+                memcpy(chunks[i % 2], framebuffer + i * CHUNK_SIZE, CHUNK_SIZE);
+            }
+            chunk_time[i] += now_seconds() - t;
+        }
+        frames++;
+    } while (now_seconds() - start < BENCH_SECONDS);
+
+    *setup_us = setup * 1e6 / frames;
+    for (int i = 0; i < CHUNKS; i++) {
+        chunk_us[i] = chunk_time[i] * 1e6 / frames;
+    }
+}
+
+/**
+ * Setup, then chunk i is prepared while chunk i - 1 is on the wire.
+ */
+static double plane_time_us(double setup_us, const double* chunk_us)
+{
+    double transfer_us = CHUNK_SIZE / SPI_BYTES_PER_US;
+    double total = setup_us + chunk_us[0];
+
+    for (int i = 1; i < CHUNKS; i++) {
+        total += chunk_us[i] > transfer_us ? chunk_us[i] : transfer_us;
+    }
+
+    return total + transfer_us;
+}
+
+static double frame_time_us(bool use_bands, bool red, double* render_us)
+{
+    double total = 0;
+
+    *render_us = 0;
+
+    for (uint8_t plane = EPAPER_PLANE_BLACK; plane <= EPAPER_PLANE_RED; plane++) {
+        double setup_us;
+        double chunk_us[CHUNKS];
+
+        if (plane == EPAPER_PLANE_RED && !red) {
+            // Zero-filled without rendering in both modes
+            memset(chunk_us, 0, sizeof(chunk_us));
+            setup_us = 0;
+        } else {
+            time_plane(use_bands, plane, &setup_us, chunk_us);
+        }
+
+        *render_us += setup_us;
+        for (int i = 0; i < CHUNKS; i++) {
+            *render_us += chunk_us[i];
+        }
+        total += plane_time_us(setup_us, chunk_us);
+    }
+
+    return total;
+}
+
+int main()
+{
+    // Full-buffer mode: framebuffer, the diff's copy of the last frame, the two SPI chunks and the red plane
+    size_t full_ram = DISPLAY_BUFFER_SIZE * 2 + sizeof(chunks);
+    // Banded mode: the SPI chunks and the display task's display list
+    size_t banded_ram = sizeof(chunks) + LIST_SIZE;
+
+    dlist_init(&scene, LIST_SIZE);
+
+    for (int red = 0; red <= 1; red++) {
+        build_scene(red);
+
+        for (uint8_t plane = EPAPER_PLANE_BLACK; plane <= EPAPER_PLANE_RED; plane++) {
+            render_full(plane);
+            for (int i = 0; i < CHUNKS; i++) {
+                render_band(banded + i * CHUNK_SIZE, i, plane);
+            }
+
+            if (memcmp(framebuffer, banded, sizeof(framebuffer)) != 0) {
+                fprintf(stderr, "plane %u: banded frame differs from the framebuffer\n", plane);
+                return 1;
+            }
+        }
+
+        double full_render_us;
+        double banded_render_us;
+        double full_us = frame_time_us(false, red, &full_render_us);
+        double banded_us = frame_time_us(true, red, &banded_render_us);
+
+        printf("%-9s  full buffer %6zu B RAM  %7.0f us/frame (%6.0f us CPU)  banded %6zu B RAM  %7.0f us/frame "
+               "(%6.0f us CPU)\n",
+            red ? "black+red" : "black", full_ram + red * DISPLAY_BUFFER_SIZE, full_us, full_render_us, banded_ram,
+            banded_us, banded_render_us);
+    }
+
+    return 0;
+}
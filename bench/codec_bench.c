@@ -0,0 +1,222 @@
+/**
+ * Compression ratio and encode/decode throughput of the PackBits frame codec on representative frames.
+ *
+ * Decoding goes through the same chunked path as /framebuffer uploads: 256-byte input chunks into a sink that
+ * writes the framebuffer.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "font.h"
+#include "raster.h"
+#include "rle.h"
+
+#define WIDTH 800
+#define HEIGHT 480
+#define STRIDE (WIDTH / 8)
+#define FRAME_SIZE (STRIDE * HEIGHT)
+// Same as HTTP_STREAM_CHUNK_SIZE in http.c
+#define CHUNK_SIZE 256
+#define BENCH_SECONDS 0.5
+
+static uint8_t frame[FRAME_SIZE];
+static uint8_t decoded[FRAME_SIZE];
+static uint8_t packed[FRAME_SIZE * 2];
+static size_t packed_length;
+static size_t decoded_offset;
+
+static double now_seconds()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void put_pixel(int x, int y, int color)
+{
+    if (x < 0 || x >= WIDTH || y < 0 || y >= HEIGHT) {
+        return;
+    }
+
+    if (color) {
+        frame[y * STRIDE + x / 8] |= 0x80u >> (x % 8);
+    } else {
+        frame[y * STRIDE + x / 8] &= ~(0x80u >> (x % 8));
+    }
+}
+
+// Same glyph walk as epaper_draw_text()
+static void draw_text(int pos_x, int pos_y, const char* text, const Font* font)
+{
+    Raster raster = { .buffer = frame, .width = WIDTH, .height = HEIGHT, .stride = STRIDE };
+    uint32_t x = pos_x;
+
+    for (size_t i = 0; i < strlen(text) && x < WIDTH; i++) {
+        const Glyph* glyph = font_get_glyph(font, (uint8_t) text[i]);
+        raster_draw_glyph(&raster, x, pos_y, font, glyph);
+        x += glyph->advance;
+    }
+}
+
+static void frame_white()
+{
+    memset(frame, 0xff, sizeof(frame));
+}
+
+// Same pattern as epaper_draw_dummy()
+static void frame_dummy()
+{
+    uint16_t mark = 0x1000;
+
+    frame_white();
+
+    draw_text(20, 20, "Hello, world!", &font_jetbrains_mono_16x24);
+    draw_text(20, 60, "Give me", &font_jetbrains_mono_16x24);
+    draw_text(40, 90, "$1,000,000", &font_jetbrains_mono_16x24);
+    draw_text(20, 120, "please...", &font_jetbrains_mono_16x24);
+
+    for (int x = 20; x <= HEIGHT / 2 - 20; x++) {
+        put_pixel(x, HEIGHT / 2, 0);
+    }
+
+    for (uint16_t y = 0; y < HEIGHT; y++) {
+        for (uint16_t x = HEIGHT / 16; x < STRIDE; x += 2) {
+            frame[y * STRIDE + x] = mark & 0x1000 ? 0xff : 0x00;
+            frame[y * STRIDE + x + 1] = mark & 0x1000 ? 0x00 : 0xff;
+        }
+
+        if ((mark & 0xfff) < 10) {
+            mark++;
+        } else {
+            mark = 0 | ((!((mark & 0x1000) >> 12)) << 12);
+        }
+    }
+}
+
+static void frame_dashboard()
+{
+    char line[64];
+
+    frame_white();
+
+    for (int i = 0; i < 15; i++) {
+        snprintf(line, sizeof(line), "Sensor %02d  %5.1f C  %3d %%  OK", i + 1, 18.0 + i * 0.7, 30 + i * 3);
+        draw_text(20, 20 + i * 30, line, &font_jetbrains_mono_16x24);
+    }
+}
+
+static void frame_text_full()
+{
+    char line[51];
+
+    frame_white();
+
+    for (int row = 0; row < HEIGHT / 24; row++) {
+        for (int i = 0; i < 50; i++) {
+            line[i] = 0x21 + (row * 50 + i) % 94;
+        }
+        line[50] = '\0';
+        draw_text(0, row * 24, line, &font_ubuntu_mono_16x24);
+    }
+}
+
+static void packed_emit(const uint8_t* data, size_t length, void* ctx)
+{
+    memcpy(packed + packed_length, data, length);
+    packed_length += length;
+}
+
+static void decoded_write(const uint8_t* data, size_t length, void* ctx)
+{
+    memcpy(decoded + decoded_offset, data, length);
+    decoded_offset += length;
+}
+
+static void decoded_fill(uint8_t value, size_t length, void* ctx)
+{
+    memset(decoded + decoded_offset, value, length);
+    decoded_offset += length;
+}
+
+static void encode()
+{
+    rle_encoder encoder;
+
+    packed_length = 0;
+    rle_encoder_init(&encoder, packed_emit, NULL);
+    rle_encoder_feed(&encoder, frame, sizeof(frame));
+    rle_encoder_finish(&encoder);
+}
+
+static int decode()
+{
+    rle_sink sink = { .write = decoded_write, .fill = decoded_fill };
+    rle_decoder decoder;
+
+    decoded_offset = 0;
+    rle_decoder_init(&decoder, &sink, sizeof(decoded));
+
+    for (size_t offset = 0; offset < packed_length; offset += CHUNK_SIZE) {
+        size_t n = packed_length - offset < CHUNK_SIZE ? packed_length - offset : CHUNK_SIZE;
+
+        if (!rle_decoder_feed(&decoder, packed + offset, n)) {
+            return 0;
+        }
+    }
+
+    return rle_decoder_finish(&decoder);
+}
+
+static double throughput(void (*fn)(), int (*check)())
+{
+    uint32_t iterations = 0;
+    double start = now_seconds();
+    double elapsed;
+
+    do {
+        if (fn) {
+            fn();
+        } else {
+            check();
+        }
+        iterations++;
+        elapsed = now_seconds() - start;
+    } while (elapsed < BENCH_SECONDS);
+
+    return (double) FRAME_SIZE * iterations / elapsed / 1e6;
+}
+
+static int run(const char* name, void (*draw)())
+{
+    draw();
+    encode();
+
+    if (!decode() || memcmp(frame, decoded, sizeof(frame)) != 0) {
+        fprintf(stderr, "%s: round trip failed\n", name);
+        return 1;
+    }
+
+    size_t length = packed_length;
+    double encode_mbps = throughput(encode, NULL);
+    double decode_mbps = throughput(NULL, decode);
+
+    printf("%-10s %5u -> %5zu B  %6.1fx  encode %7.1f MB/s  decode %7.1f MB/s\n", name, FRAME_SIZE, length,
+        (double) FRAME_SIZE / length, encode_mbps, decode_mbps);
+
+    return 0;
+}
+
+int main()
+{
+    int failed = 0;
+
+    failed |= run("white", frame_white);
+    failed |= run("dummy", frame_dummy);
+    failed |= run("dashboard", frame_dashboard);
+    failed |= run("text", frame_text_full);
+
+    return failed;
+}
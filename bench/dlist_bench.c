@@ -0,0 +1,182 @@
+/**
+ * Cost of updating one item of the display list against redrawing the whole frame from it.
+ *
+ * A clock in the corner of a screen full of text, lines, fills and icons is replaced the way display.c does it:
+ * the areas of the old and the new item are redrawn from the list 40 rows at a time into a scratch strip, and
+ * their byte-aligned windows copied into the framebuffer. The result is compared against a full replay of the
+ * list before timing, and the list is checked to survive a serialize/deserialize round trip.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/param.h>
+#include <time.h>
+
+#include "dlist.h"
+#include "epaper.h"
+
+#define BENCH_SECONDS 0.5
+// EPAPER_BAND_ROWS in epaper.c
+#define STRIP_ROWS 40
+#define LIST_SIZE 8192
+#define CLOCK_ID 1
+#define ICON_ID 2
+
+static uint8_t framebuffer[DISPLAY_BUFFER_SIZE];
+static uint8_t reference[DISPLAY_BUFFER_SIZE];
+static uint8_t strip[STRIP_ROWS * DISPLAY_STRIDE];
+static uint8_t serialized[DLIST_HEADER_SIZE + LIST_SIZE];
+static DisplayList list;
+
+static double now_seconds()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void put_item(const DisplayItem* item, const void* data, Rect* replaced)
+{
+    if (!dlist_put(&list, item, data, replaced)) {
+        fprintf(stderr, "scene does not fit the display list\n");
+        exit(1);
+    }
+}
+
+static void put_text(uint16_t id, uint16_t x, uint16_t y, const char* text, Rect* replaced)
+{
+    DisplayItem item = { .id = id, .type = DLIST_ITEM_TEXT, .x = x, .y = y, .length = strlen(text) + 1 };
+
+    put_item(&item, text, replaced);
+}
+
+static void build_scene()
+{
+    static const uint8_t icon[32 * 4] = { 0 };
+    Rect replaced;
+
+    for (int row = 0; row < 16; row++) {
+        char text[41] = { 0 };
+
+        for (int i = 0; i < 40; i++) {
+            text[i] = 0x20 + (row * 40 + i) % 95;
+        }
+        put_text(0, 0, row * 24, text, &replaced);
+    }
+
+    put_item(&(DisplayItem) { .type = DLIST_ITEM_LINE, .x = 0, .y = 400, .x2 = 799, .y2 = 400 }, NULL, &replaced);
+    put_item(&(DisplayItem) { .type = DLIST_ITEM_LINE, .x = 650, .y = 0, .x2 = 560, .y2 = 470 }, NULL, &replaced);
+    put_item(&(DisplayItem) { .type = DLIST_ITEM_FILL, .x = 660, .y = 20, .width = 120, .height = 120, .color = 2 },
+        NULL, &replaced);
+    put_item(&(DisplayItem) { .id = ICON_ID, .type = DLIST_ITEM_BITMAP, .x = 700, .y = 60, .width = 32, .height = 32,
+                 .length = sizeof(icon) },
+        icon, &replaced);
+    put_text(CLOCK_ID, 610, 430, "12:00", &replaced);
+}
+
+static void render_full(uint8_t* buffer, uint8_t plane)
+{
+    Raster raster = { .buffer = buffer, .width = DISPLAY_WIDTH, .height = DISPLAY_HEIGHT, .stride = DISPLAY_STRIDE };
+
+    dlist_render(&list, &raster, plane, NULL);
+}
+
+/**
+ * What display_redraw() and epaper_render_area() do for the black/white plane.
+ */
+static void render_area(const Rect* area)
+{
+    Rect clip = { .x = area->x & ~7, .y = area->y, .h = area->h };
+
+    clip.w = ((area->x + area->w + 7) & ~7) - clip.x;
+
+    for (uint16_t y = clip.y; y < clip.y + clip.h; y += STRIP_ROWS) {
+        Raster band = {
+            .buffer = strip,
+            .width = DISPLAY_WIDTH,
+            .height = MIN(STRIP_ROWS, clip.y + clip.h - y),
+            .stride = DISPLAY_STRIDE,
+            .top = y,
+        };
+
+        dlist_render(&list, &band, EPAPER_PLANE_BLACK, &clip);
+
+        for (uint16_t row = 0; row < band.height; row++) {
+            memcpy(framebuffer + (y + row) * DISPLAY_STRIDE + clip.x / 8, strip + row * DISPLAY_STRIDE + clip.x / 8,
+                clip.w / 8);
+        }
+    }
+}
+
+static void update_clock(const char* text)
+{
+    Rect replaced;
+
+    put_text(CLOCK_ID, 610, 430, text, &replaced);
+    render_area(&replaced);
+    render_area(&dlist_find(&list, CLOCK_ID)->bounds);
+}
+
+static bool check(const char* what)
+{
+    render_full(reference, EPAPER_PLANE_BLACK);
+    if (memcmp(framebuffer, reference, sizeof(reference)) != 0) {
+        fprintf(stderr, "%s: redrawn area differs from a full replay\n", what);
+        return false;
+    }
+
+    return true;
+}
+
+int main()
+{
+    static const char* times[] = { "12:01", "9:59", "23:59:58" };
+    Rect removed;
+
+    dlist_init(&list, LIST_SIZE);
+    build_scene();
+    render_full(framebuffer, EPAPER_PLANE_BLACK);
+
+    for (size_t i = 0; i < sizeof(times) / sizeof(times[0]); i++) {
+        update_clock(times[i]);
+        if (!check("update")) {
+            return 1;
+        }
+    }
+
+    dlist_remove(&list, ICON_ID, &removed);
+    render_area(&removed);
+    if (!check("remove")) {
+        return 1;
+    }
+
+    size_t size = dlist_serialize(&list, serialized, sizeof(serialized));
+    uint16_t count = list.count;
+
+    if (!size || !dlist_deserialize(&list, serialized, size) || list.count != count || !check("round trip")) {
+        fprintf(stderr, "display list does not survive serialization\n");
+        return 1;
+    }
+
+    uint64_t updates = 0;
+    uint64_t frames = 0;
+    double start = now_seconds();
+
+    do {
+        update_clock(times[updates++ % 3]);
+    } while (now_seconds() - start < BENCH_SECONDS);
+    double update_us = (now_seconds() - start) * 1e6 / updates;
+
+    start = now_seconds();
+    do {
+        render_full(framebuffer, EPAPER_PLANE_BLACK);
+        frames++;
+    } while (now_seconds() - start < BENCH_SECONDS);
+    double full_us = (now_seconds() - start) * 1e6 / frames;
+
+    printf("%u items, %zu B serialized  update one item %7.1f us  full redraw %7.1f us  %5.1fx\n", list.count, size,
+        update_us, full_us, full_us / update_us);
+
+    return 0;
+}
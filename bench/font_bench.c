@@ -0,0 +1,140 @@
+/**
+ * Flash footprint and text rendering throughput of raw and RLE-encoded fonts.
+ *
+ * The RLE fonts are generated from fonts/fonts.js by tools/fontconv -z. Both draw the same screens through
+ * raster_draw_glyph(), the RLE fonts with the glyph cache at several sizes, and the frames are compared before
+ * timing. "dashboard" reuses a few dozen glyphs; "all" cycles through all 95, which no LRU cache smaller than
+ * the font can hold.
+ */
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "font.h"
+#include "glyph_cache.h"
+#include "raster.h"
+#include "utf8.h"
+
+#define WIDTH 800
+#define HEIGHT 480
+#define STRIDE (WIDTH / 8)
+#define BENCH_SECONDS 0.5
+
+extern Font font_ubuntu_mono_16x24_rle;
+extern Font font_jetbrains_mono_16x24_rle;
+
+static uint8_t frame_raw[STRIDE * HEIGHT];
+static uint8_t frame[STRIDE * HEIGHT];
+static char screen_dashboard[HEIGHT / 24][51];
+static char screen_all[HEIGHT / 24][51];
+
+static double now_seconds()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static uint32_t draw_screen(uint8_t* buffer, char lines[][51], const Font* font)
+{
+    Raster raster = { .buffer = buffer, .width = WIDTH, .height = HEIGHT, .stride = STRIDE };
+    uint32_t glyphs = 0;
+
+    for (int row = 0; row < HEIGHT / 24; row++) {
+        const char* text = lines[row];
+        uint32_t x = 0;
+        uint32_t c;
+
+        while ((c = utf8_next(&text)) != 0 && x < WIDTH) {
+            const Glyph* glyph = font_get_glyph(font, c);
+            raster_draw_glyph(&raster, x, row * font->line_height, font, glyph);
+            x += glyph->advance;
+            glyphs++;
+        }
+    }
+
+    return glyphs;
+}
+
+static double glyphs_per_second(char lines[][51], const Font* font)
+{
+    uint64_t glyphs = 0;
+    double start = now_seconds();
+    double elapsed;
+
+    do {
+        glyphs += draw_screen(frame, lines, font);
+        elapsed = now_seconds() - start;
+    } while (elapsed < BENCH_SECONDS);
+
+    return glyphs / elapsed;
+}
+
+static size_t footprint(const Font* font)
+{
+    return font->size + font->num_glyphs * sizeof(Glyph) + font->num_ranges * sizeof(FontRange);
+}
+
+static int run(const char* name, char lines[][51], const Font* raw, const Font* rle)
+{
+    const uint8_t limits[] = { GLYPH_CACHE_SLOTS, 8, 0 };
+
+    draw_screen(frame_raw, lines, raw);
+    printf("%-10s raw          %9.0f glyphs/s\n", name, glyphs_per_second(lines, raw));
+
+    for (size_t i = 0; i < sizeof(limits) / sizeof(limits[0]); i++) {
+        glyph_cache_stats stats;
+
+        glyph_cache_set_limit(limits[i]);
+        memset(frame, 0, sizeof(frame));
+        draw_screen(frame, lines, rle);
+
+        if (memcmp(frame, frame_raw, sizeof(frame)) != 0) {
+            fprintf(stderr, "%s: RLE output differs from the raw font\n", name);
+            return 1;
+        }
+
+        glyph_cache_reset_stats();
+        double rate = glyphs_per_second(lines, rle);
+        glyph_cache_get_stats(&stats);
+
+        printf("%-10s rle cache %2u %9.0f glyphs/s  %5.1f%% hits\n", name, limits[i], rate,
+            100.0 * stats.hits / (stats.hits + stats.misses));
+    }
+
+    return 0;
+}
+
+int main()
+{
+    const char* dashboard = "Sensor 00  21.5 C  40 %  OK";
+    glyph_cache_stats stats;
+
+    for (int row = 0; row < HEIGHT / 24; row++) {
+        snprintf(screen_dashboard[row], sizeof(screen_dashboard[row]), "%.7s%02d%s", dashboard, row, dashboard + 9);
+        for (int i = 0; i < 50; i++) {
+            screen_all[row][i] = 0x20 + (row * 50 + i) % 95;
+        }
+        screen_all[row][50] = '\0';
+    }
+
+    printf("%-16s raw %5zu B  rle %5zu B  bitmap %5u -> %5u B\n", font_ubuntu_mono_16x24.name,
+        footprint(&font_ubuntu_mono_16x24), footprint(&font_ubuntu_mono_16x24_rle), font_ubuntu_mono_16x24.size,
+        font_ubuntu_mono_16x24_rle.size);
+    printf("%-16s raw %5zu B  rle %5zu B  bitmap %5u -> %5u B\n", font_jetbrains_mono_16x24.name,
+        footprint(&font_jetbrains_mono_16x24), footprint(&font_jetbrains_mono_16x24_rle),
+        font_jetbrains_mono_16x24.size, font_jetbrains_mono_16x24_rle.size);
+
+    if (run("dashboard", screen_dashboard, &font_jetbrains_mono_16x24, &font_jetbrains_mono_16x24_rle) ||
+        run("all", screen_all, &font_jetbrains_mono_16x24, &font_jetbrains_mono_16x24_rle) ||
+        run("all", screen_all, &font_ubuntu_mono_16x24, &font_ubuntu_mono_16x24_rle)) {
+        return 1;
+    }
+
+    glyph_cache_get_stats(&stats);
+    printf("\nglyph cache      %u slots of %u B, %u B of DRAM\n", GLYPH_CACHE_SLOTS, GLYPH_CACHE_SLOT_SIZE,
+        stats.memory_bytes);
+
+    return 0;
+}
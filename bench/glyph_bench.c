@@ -0,0 +1,143 @@
+/**
+ * Per-font table sizes and the cost of a code point to glyph lookup, plus UTF-8 decoding throughput.
+ *
+ * Lookups are timed on the built-in fonts (one ASCII range, so hits take the first-range check and misses one
+ * binary search step) and on a synthetic font with many ranges, against a linear scan of the same ranges.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "font.h"
+#include "utf8.h"
+
+#define SPARSE_RANGES 64
+#define SPARSE_RANGE_SIZE 32
+#define LOOKUPS 4096
+#define BENCH_SECONDS 0.5
+
+static FontRange sparse_ranges[SPARSE_RANGES];
+static Glyph sparse_glyphs[SPARSE_RANGES * SPARSE_RANGE_SIZE + 1];
+static Font sparse_font = {
+    .version = FONT_VERSION,
+    .num_glyphs = SPARSE_RANGES * SPARSE_RANGE_SIZE + 1,
+    .num_ranges = SPARSE_RANGES,
+    .fallback = SPARSE_RANGES * SPARSE_RANGE_SIZE,
+    .name = "sparse",
+    .ranges = sparse_ranges,
+    .glyphs = sparse_glyphs,
+};
+
+static uint32_t lookups[LOOKUPS];
+static volatile uintptr_t sink;
+
+static double now_seconds()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static const Glyph* linear_get_glyph(const Font* font, uint32_t c)
+{
+    for (uint16_t i = 0; i < font->num_ranges; i++) {
+        const FontRange* range = &font->ranges[i];
+
+        if (c - range->first < range->count) {
+            return &font->glyphs[range->glyph_index + c - range->first];
+        }
+    }
+
+    return &font->glyphs[font->fallback];
+}
+
+static double ns_per_lookup(const Font* font, const Glyph* (*get_glyph)(const Font*, uint32_t))
+{
+    uint64_t count = 0;
+    double start = now_seconds();
+    double elapsed;
+
+    do {
+        for (int i = 0; i < LOOKUPS; i++) {
+            sink += (uintptr_t) get_glyph(font, lookups[i]);
+        }
+        count += LOOKUPS;
+        elapsed = now_seconds() - start;
+    } while (elapsed < BENCH_SECONDS);
+
+    return elapsed / count * 1e9;
+}
+
+static void fill_lookups(uint32_t first, uint32_t count)
+{
+    for (int i = 0; i < LOOKUPS; i++) {
+        lookups[i] = first + rand() % count;
+    }
+}
+
+static void report_font(const Font* font)
+{
+    printf("%-16s %5u glyphs  %3u ranges  index %5zu B  glyph table %6zu B  bitmap %6u B\n", font->name,
+        font->num_glyphs, font->num_ranges, font->num_ranges * sizeof(FontRange), font->num_glyphs * sizeof(Glyph),
+        font->size);
+}
+
+static double utf8_mb_per_second(const char* text)
+{
+    size_t length = strlen(text);
+    uint64_t bytes = 0;
+    double start = now_seconds();
+    double elapsed;
+
+    do {
+        const char* p = text;
+        uint32_t c;
+
+        while ((c = utf8_next(&p)) != 0) {
+            sink += c;
+        }
+        bytes += length;
+        elapsed = now_seconds() - start;
+    } while (elapsed < BENCH_SECONDS);
+
+    return bytes / elapsed / 1e6;
+}
+
+int main()
+{
+    for (int i = 0; i < SPARSE_RANGES; i++) {
+        sparse_ranges[i] = (FontRange) { .first = 0x80 + i * 0x100, .count = SPARSE_RANGE_SIZE,
+            .glyph_index = i * SPARSE_RANGE_SIZE };
+    }
+
+    report_font(&font_ubuntu_mono_16x24);
+    report_font(&font_jetbrains_mono_16x24);
+    report_font(&sparse_font);
+    putchar('\n');
+
+    fill_lookups(0x20, 95);
+    printf("builtin ascii    %6.2f ns/lookup\n", ns_per_lookup(&font_jetbrains_mono_16x24, font_get_glyph));
+
+    fill_lookups(0x80, 0x10000);
+    printf("builtin missing  %6.2f ns/lookup\n", ns_per_lookup(&font_jetbrains_mono_16x24, font_get_glyph));
+
+    for (int i = 0; i < LOOKUPS; i++) {
+        lookups[i] = sparse_ranges[rand() % SPARSE_RANGES].first + rand() % SPARSE_RANGE_SIZE;
+    }
+    for (int i = 0; i < LOOKUPS; i++) {
+        if (font_get_glyph(&sparse_font, lookups[i]) != linear_get_glyph(&sparse_font, lookups[i])) {
+            fprintf(stderr, "U+%04X: binary search and linear scan disagree\n", lookups[i]);
+            return 1;
+        }
+    }
+    printf("sparse binary    %6.2f ns/lookup\n", ns_per_lookup(&sparse_font, font_get_glyph));
+    printf("sparse linear    %6.2f ns/lookup\n", ns_per_lookup(&sparse_font, linear_get_glyph));
+    putchar('\n');
+
+    printf("utf8 ascii       %6.1f MB/s\n", utf8_mb_per_second("Temperature 21.5 C  Humidity 40 %  Sensor 12 OK"));
+    printf("utf8 mixed       %6.1f MB/s\n", utf8_mb_per_second("Température 21,5 °C  Prix 12 €  Zürich → Łódź"));
+
+    return 0;
+}
@@ -0,0 +1,7 @@
+#pragma once
+
+// Host stand-in for the FreeRTOS types that appear in the firmware headers
+
+#include <stdint.h>
+
+typedef uint32_t TickType_t;
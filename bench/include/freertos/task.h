@@ -0,0 +1,5 @@
+#pragma once
+
+// Host stand-in for the FreeRTOS types that appear in the firmware headers
+
+typedef void* TaskHandle_t;
@@ -0,0 +1,123 @@
+/**
+ * Cost of laying out a paragraph with layout_text(), against a naive word wrapper that measures every candidate
+ * line again from its start.
+ *
+ * Both wrap the same text into boxes of several widths, all wider than its longest word so neither has to break
+ * inside one; their line breaks are compared before timing. Results
+ * are per laid out glyph, so they do not depend on the paragraph length.
+ */
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "font.h"
+#include "layout.h"
+
+#define BENCH_SECONDS 0.5
+#define MAX_LINES 64
+
+static const char paragraph[] =
+    "The quick brown fox jumps over the lazy dog while the display refreshes in the background. "
+    "Partial updates keep the rest of the panel untouched, so only the box that changed has to be sent. "
+    "Text that does not fit is cut off with an ellipsis at the end of the last line.";
+
+typedef struct line_log {
+    uint16_t count;
+    uint16_t offsets[MAX_LINES];
+    uint32_t glyphs;
+} line_log;
+
+static double now_seconds()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void log_line(const LayoutLine* line, void* ctx)
+{
+    line_log* log = ctx;
+
+    if (log->count < MAX_LINES) {
+        log->offsets[log->count++] = line->text - paragraph;
+    }
+    log->glyphs += line->length;
+}
+
+static void layout_paragraph(const Rect* box, line_log* log)
+{
+    const LayoutOptions options = { .align = LAYOUT_ALIGN_LEFT, .flags = LAYOUT_WRAP };
+    Rect used;
+
+    layout_text(&font_jetbrains_mono_16x24, paragraph, box, &options, log_line, log, &used);
+}
+
+// Greedy wrapping at single spaces, measuring the whole line with strlen() and layout_measure() for every word
+static void naive_paragraph(const Rect* box, line_log* log)
+{
+    const Font* font = &font_jetbrains_mono_16x24;
+    const char* start = paragraph;
+
+    while (*start) {
+        const char* end = strchr(start, ' ');
+        end = end ? end : start + strlen(start);
+
+        while (*end) {
+            const char* next = strchr(end + 1, ' ');
+            next = next ? next : end + strlen(end);
+
+            if (layout_measure(font, start, next - start) > box->w) {
+                break;
+            }
+            end = next;
+        }
+
+        log_line(&(LayoutLine) { .text = start, .length = end - start }, log);
+        start = *end ? end + 1 : end;
+    }
+}
+
+static double ns_per_glyph(void (*layout)(const Rect*, line_log*), const Rect* box)
+{
+    uint64_t glyphs = 0;
+    double start = now_seconds();
+    double elapsed;
+
+    do {
+        line_log log = { 0 };
+        layout(box, &log);
+        glyphs += log.glyphs;
+        elapsed = now_seconds() - start;
+    } while (elapsed < BENCH_SECONDS);
+
+    return elapsed * 1e9 / glyphs;
+}
+
+int main()
+{
+    const uint16_t widths[] = { 240, 400, 800 };
+
+    for (size_t i = 0; i < sizeof(widths) / sizeof(widths[0]); i++) {
+        Rect box = { .w = widths[i], .h = 480 };
+        line_log layout_log = { 0 };
+        line_log naive_log = { 0 };
+
+        layout_paragraph(&box, &layout_log);
+        naive_paragraph(&box, &naive_log);
+
+        if (layout_log.count != naive_log.count
+            || memcmp(layout_log.offsets, naive_log.offsets, layout_log.count * sizeof(uint16_t)) != 0) {
+            fprintf(stderr, "w=%u: layout_text() breaks lines differently from the naive wrapper\n", box.w);
+            return 1;
+        }
+
+        double naive = ns_per_glyph(naive_paragraph, &box);
+        double layout = ns_per_glyph(layout_paragraph, &box);
+
+        printf("w=%3u  %2u lines  naive %6.1f ns/glyph  layout_text %6.1f ns/glyph  %5.1fx\n", box.w,
+            layout_log.count, naive, layout, naive / layout);
+    }
+
+    return 0;
+}
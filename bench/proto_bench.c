@@ -0,0 +1,224 @@
+/**
+ * Parse throughput and peak memory of the JSON and binary draw request formats.
+ *
+ * Both paths mirror the HTTP handlers: JSON copies the body into one buffer, builds the cJSON tree and
+ * converts every op; binary feeds the body through proto_parser in HTTP_STREAM_CHUNK_SIZE chunks.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "cJSON.h"
+
+#include "proto.h"
+
+// Same as HTTP_STREAM_CHUNK_SIZE in http.c
+#define CHUNK_SIZE 256
+#define DASHBOARD_LINES 15
+#define BENCH_SECONDS 1.0
+
+static const char* dashboard_text = "Temperature 21.5 C  Humidity 40 %";
+
+static size_t heap_current;
+static size_t heap_peak;
+
+static void* counting_malloc(size_t size)
+{
+    size_t* block = malloc(sizeof(size_t) + size);
+
+    if (!block) {
+        return NULL;
+    }
+
+    *block = size;
+    heap_current += size;
+    if (heap_current > heap_peak) {
+        heap_peak = heap_current;
+    }
+
+    return block + 1;
+}
+
+static void counting_free(void* ptr)
+{
+    if (!ptr) {
+        return;
+    }
+
+    size_t* block = (size_t*) ptr - 1;
+    heap_current -= *block;
+    free(block);
+}
+
+static double now_seconds()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static size_t build_json(char* out, size_t size)
+{
+    size_t n = snprintf(out, size, "{\"refresh\":true,\"ops\":[{\"op\":\"clear\"}");
+
+    for (int i = 0; i < DASHBOARD_LINES; i++) {
+        n += snprintf(out + n, size - n, ",{\"op\":\"text\",\"text\":\"%s\",\"x\":20,\"y\":%d}", dashboard_text, 20 + i * 30);
+    }
+    n += snprintf(out + n, size - n, ",{\"op\":\"line\",\"x1\":20,\"y1\":470,\"x2\":780,\"y2\":470,\"color\":0}]}");
+
+    return n;
+}
+
+static size_t put_command(uint8_t* out, uint8_t opcode, uint16_t length)
+{
+    out[0] = opcode;
+    out[1] = length & 0xff;
+    out[2] = length >> 8;
+
+    return PROTO_COMMAND_HEADER_SIZE;
+}
+
+static size_t put_u16(uint8_t* out, uint16_t value)
+{
+    out[0] = value & 0xff;
+    out[1] = value >> 8;
+
+    return 2;
+}
+
+static size_t build_binary(uint8_t* out)
+{
+    size_t text_length = strlen(dashboard_text);
+    size_t n = 0;
+
+    out[n++] = PROTO_MAGIC_0;
+    out[n++] = PROTO_MAGIC_1;
+    out[n++] = PROTO_VERSION;
+    out[n++] = 0;
+
+    n += put_command(out + n, PROTO_OP_CLEAR, 0);
+
+    for (int i = 0; i < DASHBOARD_LINES; i++) {
+        n += put_command(out + n, PROTO_OP_TEXT, 4 + text_length);
+        n += put_u16(out + n, 20);
+        n += put_u16(out + n, 20 + i * 30);
+        memcpy(out + n, dashboard_text, text_length);
+        n += text_length;
+    }
+
+    n += put_command(out + n, PROTO_OP_LINE, 9);
+    n += put_u16(out + n, 20);
+    n += put_u16(out + n, 470);
+    n += put_u16(out + n, 780);
+    n += put_u16(out + n, 470);
+    out[n++] = 0;
+
+    return n;
+}
+
+static uint32_t commands_seen;
+
+static void count_command(const display_command* command, void* ctx)
+{
+    commands_seen++;
+}
+
+static int parse_json(const char* body, size_t length)
+{
+    char* content = counting_malloc(length + 1);
+    memcpy(content, body, length);
+    content[length] = '\0';
+
+    cJSON* root = cJSON_Parse(content);
+    const cJSON* ops_json = cJSON_GetObjectItem(root, "ops");
+    int count = cJSON_GetArraySize(ops_json);
+    display_command* commands = counting_malloc(count * sizeof(display_command));
+    const cJSON* op_json;
+    int i = 0;
+
+    cJSON_ArrayForEach(op_json, ops_json)
+    {
+        if (proto_parse_json_op(op_json, &commands[i])) {
+            i++;
+        }
+    }
+
+    commands_seen += i;
+
+    counting_free(commands);
+    cJSON_Delete(root);
+    counting_free(content);
+
+    return i;
+}
+
+static int parse_binary(const uint8_t* body, size_t length)
+{
+    proto_parser parser;
+
+    proto_parser_init(&parser, count_command, NULL);
+
+    for (size_t offset = 0; offset < length; offset += CHUNK_SIZE) {
+        size_t n = length - offset < CHUNK_SIZE ? length - offset : CHUNK_SIZE;
+
+        if (!proto_parser_feed(&parser, body + offset, n)) {
+            return -1;
+        }
+    }
+
+    return proto_parser_finish(&parser) ? (int) parser.commands : -1;
+}
+
+static void report(const char* name, size_t body_length, int commands, uint32_t iterations, double elapsed, size_t peak)
+{
+    printf("%-7s body %5zu B  %3d cmds  %8.1f us/req  %7.1f MB/s  %9.0f cmds/s  peak %6zu B\n", name, body_length,
+        commands, elapsed / iterations * 1e6, body_length * iterations / elapsed / 1e6, commands * iterations / elapsed,
+        peak);
+}
+
+int main()
+{
+    static char json[16384];
+    static uint8_t binary[4096];
+    cJSON_Hooks hooks = { .malloc_fn = counting_malloc, .free_fn = counting_free };
+
+    cJSON_InitHooks(&hooks);
+
+    size_t json_length = build_json(json, sizeof(json));
+    size_t binary_length = build_binary(binary);
+
+    int json_commands = parse_json(json, json_length);
+    int binary_commands = parse_binary(binary, binary_length);
+
+    if (json_commands != binary_commands) {
+        fprintf(stderr, "format mismatch: json %d, binary %d commands\n", json_commands, binary_commands);
+        return 1;
+    }
+
+    uint32_t iterations = 0;
+    double start = now_seconds();
+    double elapsed;
+
+    heap_peak = 0;
+    do {
+        parse_json(json, json_length);
+        iterations++;
+        elapsed = now_seconds() - start;
+    } while (elapsed < BENCH_SECONDS);
+    report("json", json_length, json_commands, iterations, elapsed, heap_peak);
+
+    iterations = 0;
+    start = now_seconds();
+    do {
+        parse_binary(binary, binary_length);
+        iterations++;
+        elapsed = now_seconds() - start;
+    } while (elapsed < BENCH_SECONDS);
+    // No heap: the parser, one chunk and the held-back command live on the handler's stack
+    report("binary", binary_length, binary_commands, iterations, elapsed,
+        sizeof(proto_parser) + CHUNK_SIZE + sizeof(display_command));
+
+    return 0;
+}
@@ -0,0 +1,276 @@
+/**
+ * Pixels per second of the span-based shapes in shape.c and raster.c against drawing them pixel by pixel.
+ *
+ * The per-pixel versions are what the firmware did before: Bresenham lines through a set-pixel call, and
+ * rectangles, circles and polygons as a set-pixel call for every pixel found inside. Both draw the same scene
+ * for each workload and the frames are compared before timing.
+ */
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "raster.h"
+#include "shape.h"
+
+#define WIDTH 800
+#define HEIGHT 480
+#define STRIDE (WIDTH / 8)
+#define BENCH_SECONDS 0.3
+
+static uint8_t frame_legacy[STRIDE * HEIGHT];
+static uint8_t frame_span[STRIDE * HEIGHT];
+static const Raster raster = { .buffer = frame_span, .width = WIDTH, .height = HEIGHT, .stride = STRIDE };
+
+static const ShapePoint star[] = {
+    { 400, 40 }, { 460, 200 }, { 640, 200 }, { 500, 300 }, { 560, 460 },
+    { 400, 360 }, { 240, 460 }, { 300, 300 }, { 160, 200 }, { 340, 200 },
+};
+
+static double now_seconds()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void legacy_put_pixel(int32_t x, int32_t y)
+{
+    if (x < 0 || y < 0 || x >= WIDTH || y >= HEIGHT) {
+        return;
+    }
+
+    frame_legacy[y * STRIDE + (x / 8)] &= ~(0x80u >> (x % 8));
+}
+
+static void legacy_line(int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+{
+    int32_t dx = abs(x2 - x1);
+    int32_t sx = x1 < x2 ? 1 : -1;
+    int32_t dy = -abs(y2 - y1);
+    int32_t sy = y1 < y2 ? 1 : -1;
+    int32_t err = dx + dy;
+
+    while (1) {
+        legacy_put_pixel(x1, y1);
+        if (x1 == x2 && y1 == y2)
+            break;
+        int32_t e2 = 2 * err;
+        if (e2 >= dy) {
+            err += dy;
+            x1 += sx;
+        }
+        if (e2 <= dx) {
+            err += dx;
+            y1 += sy;
+        }
+    }
+}
+
+static void legacy_hlines()
+{
+    for (int32_t y = 0; y < HEIGHT; y += 2) {
+        legacy_line(3, y, WIDTH - 4, y);
+    }
+}
+
+static void span_hlines()
+{
+    for (int32_t y = 0; y < HEIGHT; y += 2) {
+        raster_draw_line(&raster, 3, y, WIDTH - 4, y, 0);
+    }
+}
+
+static void legacy_vlines()
+{
+    for (int32_t x = 0; x < WIDTH; x += 2) {
+        legacy_line(x, 5, x, HEIGHT - 6);
+    }
+}
+
+static void span_vlines()
+{
+    for (int32_t x = 0; x < WIDTH; x += 2) {
+        raster_draw_line(&raster, x, 5, x, HEIGHT - 6, 0);
+    }
+}
+
+// Lines from every 16th pixel of the top edge to every 16th of the bottom edge, in both directions
+static void legacy_mesh()
+{
+    for (int32_t x = 0; x < WIDTH; x += 16) {
+        legacy_line(x, 0, WIDTH - 1 - x, HEIGHT - 1);
+        legacy_line(0, x * HEIGHT / WIDTH, WIDTH - 1, HEIGHT - 1 - x * HEIGHT / WIDTH);
+    }
+}
+
+static void span_mesh()
+{
+    for (int32_t x = 0; x < WIDTH; x += 16) {
+        raster_draw_line(&raster, x, 0, WIDTH - 1 - x, HEIGHT - 1, 0);
+        raster_draw_line(&raster, 0, x * HEIGHT / WIDTH, WIDTH - 1, HEIGHT - 1 - x * HEIGHT / WIDTH, 0);
+    }
+}
+
+static void legacy_rects()
+{
+    for (int32_t i = 0; i < 8; i++) {
+        for (int32_t y = 20 + i * 50; y < 20 + i * 50 + 40; y++) {
+            for (int32_t x = 13 + i * 7; x < 13 + i * 7 + 700; x++) {
+                legacy_put_pixel(x, y);
+            }
+        }
+    }
+}
+
+static void span_rects()
+{
+    for (int32_t i = 0; i < 8; i++) {
+        Shape rect = { .type = SHAPE_RECT, .flags = SHAPE_FILLED, .x = 13 + i * 7, .y = 20 + i * 50, .width = 700,
+            .height = 40 };
+        shape_draw(&raster, &rect, 0);
+    }
+}
+
+static void legacy_circles()
+{
+    for (int32_t i = 0; i < 6; i++) {
+        int32_t cx = 70 + i * 130;
+        int32_t cy = 240;
+        int32_t r = 30 + i * 8;
+
+        for (int32_t dy = -r; dy <= r; dy++) {
+            for (int32_t dx = -r; dx <= r; dx++) {
+                if (dx * dx + dy * dy <= r * r + r) {
+                    legacy_put_pixel(cx + dx, cy + dy);
+                }
+            }
+        }
+    }
+}
+
+static void span_circles()
+{
+    for (int32_t i = 0; i < 6; i++) {
+        Shape circle = { .type = SHAPE_CIRCLE, .flags = SHAPE_FILLED, .x = 70 + i * 130, .y = 240,
+            .radius = 30 + i * 8 };
+        shape_draw(&raster, &circle, 0);
+    }
+}
+
+/**
+ * Whether the center of pixel (px, py) is inside the polygon, in doubled coordinates so it is exact: a crossing
+ * at or left of the center counts, as in the scanline fill.
+ */
+static bool legacy_inside(const ShapePoint* points, size_t count, int32_t px, int32_t py)
+{
+    int64_t cx = 2 * px + 1;
+    int64_t cy = 2 * py + 1;
+    bool inside = false;
+
+    for (size_t i = 0; i < count; i++) {
+        size_t j = (i + 1) % count;
+        int64_t xi = 2 * points[i].x;
+        int64_t yi = 2 * points[i].y;
+        int64_t xj = 2 * points[j].x;
+        int64_t yj = 2 * points[j].y;
+
+        if ((yi <= cy) == (yj <= cy)) {
+            continue;
+        }
+
+        // cx >= xi + (cy - yi) * (xj - xi) / (yj - yi)
+        int64_t lhs = (cx - xi) * (yj - yi);
+        int64_t rhs = (cy - yi) * (xj - xi);
+        if (yj - yi > 0 ? lhs >= rhs : lhs <= rhs) {
+            inside = !inside;
+        }
+    }
+
+    return inside;
+}
+
+static void legacy_polygon()
+{
+    for (int32_t y = 0; y < HEIGHT; y++) {
+        for (int32_t x = 0; x < WIDTH; x++) {
+            if (legacy_inside(star, sizeof(star) / sizeof(star[0]), x, y)) {
+                legacy_put_pixel(x, y);
+            }
+        }
+    }
+}
+
+static void span_polygon()
+{
+    Shape polygon = { .type = SHAPE_POLYGON, .flags = SHAPE_FILLED, .points = star,
+        .count = sizeof(star) / sizeof(star[0]) };
+
+    shape_draw(&raster, &polygon, 0);
+}
+
+static double time_draw(void (*draw)(), uint8_t* frame)
+{
+    uint64_t runs = 0;
+    double start = now_seconds();
+    double elapsed;
+
+    do {
+        memset(frame, 0xff, STRIDE * HEIGHT);
+        draw();
+        runs++;
+        elapsed = now_seconds() - start;
+    } while (elapsed < BENCH_SECONDS);
+
+    return elapsed / runs;
+}
+
+static uint32_t ink_pixels(const uint8_t* frame)
+{
+    uint32_t count = 0;
+
+    for (size_t i = 0; i < STRIDE * HEIGHT; i++) {
+        count += 8 - __builtin_popcount(frame[i]);
+    }
+
+    return count;
+}
+
+int main()
+{
+    static const struct {
+        const char* name;
+        void (*legacy)();
+        void (*span)();
+    } workloads[] = {
+        { "hlines", legacy_hlines, span_hlines },
+        { "vlines", legacy_vlines, span_vlines },
+        { "line mesh", legacy_mesh, span_mesh },
+        { "rects", legacy_rects, span_rects },
+        { "circles", legacy_circles, span_circles },
+        { "polygon", legacy_polygon, span_polygon },
+    };
+
+    for (size_t i = 0; i < sizeof(workloads) / sizeof(workloads[0]); i++) {
+        memset(frame_legacy, 0xff, sizeof(frame_legacy));
+        memset(frame_span, 0xff, sizeof(frame_span));
+        workloads[i].legacy();
+        workloads[i].span();
+
+        if (memcmp(frame_legacy, frame_span, sizeof(frame_span)) != 0) {
+            fprintf(stderr, "%s: span drawing differs from the per-pixel one\n", workloads[i].name);
+            return 1;
+        }
+
+        uint32_t pixels = ink_pixels(frame_span);
+        double legacy = time_draw(workloads[i].legacy, frame_legacy);
+        double span = time_draw(workloads[i].span, frame_span);
+
+        printf("%-10s %7u px  per pixel %8.1f Mpx/s  spans %8.1f Mpx/s  %6.1fx\n", workloads[i].name, pixels,
+            pixels / legacy / 1e6, pixels / span / 1e6, legacy / span);
+    }
+
+    return 0;
+}
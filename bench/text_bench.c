@@ -0,0 +1,149 @@
+/**
+ * Glyphs per second for a full screen of text: the old per-pixel loop against the word blitter in raster.c.
+ *
+ * Both renderers draw the same 20 x 50 glyph screen, once byte aligned and once shifted by 3 pixels, and the
+ * resulting frames are compared before timing.
+ */
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "font.h"
+#include "raster.h"
+
+#define WIDTH 800
+#define HEIGHT 480
+#define STRIDE (WIDTH / 8)
+#define BENCH_SECONDS 0.5
+
+static uint8_t frame_legacy[STRIDE * HEIGHT];
+static uint8_t frame_blit[STRIDE * HEIGHT];
+static char lines[HEIGHT / 24][51];
+static uint16_t origin_x;
+
+static double now_seconds()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void legacy_put_pixel(uint16_t x, uint16_t y, uint8_t color)
+{
+    if (x >= WIDTH || y >= HEIGHT) {
+        return;
+    }
+
+    if (color == 1) {
+        frame_legacy[y * STRIDE + (x / 8)] |= 0x80u >> (x % 8);
+    } else {
+        frame_legacy[y * STRIDE + (x / 8)] &= ~(0x80u >> (x % 8));
+    }
+}
+
+// epaper_draw_text() before the blitter, on the glyph-major font format, minus logging and damage tracking
+static void legacy_draw_text(uint16_t pos_x, uint16_t pos_y, const char* text, const Font* font)
+{
+    uint16_t pen_x = pos_x;
+
+    for (uint16_t i = 0; i < strlen(text); i++) {
+        const Glyph* glyph = font_get_glyph(font, (uint8_t) text[i]);
+        const uint8_t* bitmap = font->bitmap + glyph->offset;
+        size_t row_bytes = font_glyph_row_bytes(glyph);
+
+        for (uint16_t y = 0; y < font->line_height; y++) {
+            for (uint16_t x = 0; x < glyph->advance; x++) {
+                int16_t gx = x - glyph->x_offset;
+                int16_t gy = y - glyph->y_offset;
+                uint8_t pixel = 0;
+
+                if (gx >= 0 && gx < glyph->width && gy >= 0 && gy < glyph->height) {
+                    pixel = (bitmap[gy * row_bytes + gx / 8] >> (7 - gx % 8)) & 0x01;
+                }
+
+                legacy_put_pixel(pen_x + x, pos_y + y, !pixel);
+            }
+        }
+
+        pen_x += glyph->advance;
+    }
+}
+
+// epaper_draw_text() with the blitter, minus logging and damage tracking
+static void blit_draw_text(uint16_t pos_x, uint16_t pos_y, const char* text, const Font* font)
+{
+    Raster raster = { .buffer = frame_blit, .width = WIDTH, .height = HEIGHT, .stride = STRIDE };
+    size_t length = strlen(text);
+    uint32_t x = pos_x;
+
+    for (size_t i = 0; i < length; i++) {
+        if (x >= WIDTH) {
+            break;
+        }
+
+        const Glyph* glyph = font_get_glyph(font, (uint8_t) text[i]);
+        raster_draw_glyph(&raster, x, pos_y, font, glyph);
+        x += glyph->advance;
+    }
+}
+
+static uint32_t draw_screen(void (*draw_text)(uint16_t, uint16_t, const char*, const Font*))
+{
+    uint32_t glyphs = 0;
+
+    for (int row = 0; row < HEIGHT / 24; row++) {
+        draw_text(origin_x, row * 24, lines[row], &font_jetbrains_mono_16x24);
+        glyphs += strlen(lines[row]);
+    }
+
+    return glyphs;
+}
+
+static double glyphs_per_second(void (*draw_text)(uint16_t, uint16_t, const char*, const Font*))
+{
+    uint64_t glyphs = 0;
+    double start = now_seconds();
+    double elapsed;
+
+    do {
+        glyphs += draw_screen(draw_text);
+        elapsed = now_seconds() - start;
+    } while (elapsed < BENCH_SECONDS);
+
+    return glyphs / elapsed;
+}
+
+int main()
+{
+    const uint16_t origins[] = { 0, 3 };
+
+    for (int row = 0; row < HEIGHT / 24; row++) {
+        for (int i = 0; i < 50; i++) {
+            lines[row][i] = 0x20 + (row * 50 + i) % 95;
+        }
+        lines[row][50] = '\0';
+    }
+
+    for (size_t i = 0; i < sizeof(origins) / sizeof(origins[0]); i++) {
+        origin_x = origins[i];
+
+        memset(frame_legacy, 0xff, sizeof(frame_legacy));
+        memset(frame_blit, 0xff, sizeof(frame_blit));
+        draw_screen(legacy_draw_text);
+        draw_screen(blit_draw_text);
+
+        if (memcmp(frame_legacy, frame_blit, sizeof(frame_blit)) != 0) {
+            fprintf(stderr, "x=%u: blitter output differs from the per-pixel loop\n", origin_x);
+            return 1;
+        }
+
+        double before = glyphs_per_second(legacy_draw_text);
+        double after = glyphs_per_second(blit_draw_text);
+
+        printf("x=%u  per-pixel %10.0f glyphs/s  blitter %10.0f glyphs/s  %5.1fx\n", origin_x, before, after,
+            after / before);
+    }
+
+    return 0;
+}
@@ -0,0 +1,532 @@
+/**
+ * The ESP-IDF drivers and services the firmware uses: GPIO with edge interrupts, the SPI master, the high
+ * resolution timer, logging and heap_caps, which counts every allocation against a nominal heap. Pins and SPI
+ * transfers are handed to the hooks in sim.h, where the panel model picks them up.
+ */
+#include <errno.h>
+#include <malloc.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/param.h>
+#include <time.h>
+
+#include "driver/gpio.h"
+#include "driver/spi_master.h"
+
+#include "esp_err.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_rom_sys.h"
+#include "esp_timer.h"
+
+#include "sim.h"
+
+#define SIM_GPIO_COUNT 40
+#define SIM_SPI_MAX_QUEUE 8
+#define SIM_LOG_MAX_TAGS 8
+
+// Roughly what an ESP32 without PSRAM has left for the application once Wi-Fi is up
+#ifndef SIM_HEAP_SIZE
+#define SIM_HEAP_SIZE (160 * 1024)
+#endif
+
+/**
+ * Transactions stay queued until their result is fetched, which is when their buffer is read: a buffer reused
+ * too early shows up on the panel.
+ */
+struct sim_spi_device {
+    int clock_speed_hz;
+    int queue_size;
+    spi_transaction_t* queue[SIM_SPI_MAX_QUEUE];
+    uint64_t levels[SIM_SPI_MAX_QUEUE];
+    int head;
+    int count;
+};
+
+struct sim_log_tag {
+    char tag[32];
+    esp_log_level_t level;
+};
+
+esp_log_level_t sim_log_level = ESP_LOG_INFO;
+
+static pthread_mutex_t log_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct sim_log_tag log_tags[SIM_LOG_MAX_TAGS];
+static int log_tag_count;
+
+// Bytes handed out by malloc() and friends, and the most that ever were
+static size_t heap_used;
+static size_t heap_peak;
+
+static int64_t start_us;
+
+static pthread_mutex_t gpio_lock = PTHREAD_MUTEX_INITIALIZER;
+static uint64_t output_levels;
+// Inputs idle high: the buttons are pulled up and BUSY_N is high while the controller is idle
+static uint64_t input_levels = ~0ULL;
+static uint64_t input_pins;
+static gpio_int_type_t intr_types[SIM_GPIO_COUNT];
+static gpio_isr_t isr_handlers[SIM_GPIO_COUNT];
+static void* isr_args[SIM_GPIO_COUNT];
+static bool isr_service_installed;
+static sim_gpio_fn gpio_handler;
+static void* gpio_handler_ctx;
+
+static pthread_mutex_t spi_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct sim_spi_device spi_device;
+static sim_spi_fn spi_handler;
+static void* spi_handler_ctx;
+static sim_spi_stats spi_stats;
+static uint64_t spi_wire_ns;
+
+static int64_t monotonic_us()
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (int64_t) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/**
+ * Starts the clock; call before anything else.
+ */
+void sim_init()
+{
+    start_us = monotonic_us();
+}
+
+int64_t esp_timer_get_time(void)
+{
+    return monotonic_us() - start_us;
+}
+
+void esp_rom_delay_us(uint32_t us)
+{
+    struct timespec ts = { .tv_sec = us / 1000000, .tv_nsec = (us % 1000000) * 1000 };
+
+    while (nanosleep(&ts, &ts) != 0 && errno == EINTR) {
+    }
+}
+
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+void __real_free(void* ptr);
+
+static void heap_count(void* ptr, bool allocated)
+{
+    size_t size = ptr ? malloc_usable_size(ptr) : 0;
+
+    if (!allocated) {
+        __atomic_sub_fetch(&heap_used, size, __ATOMIC_RELAXED);
+        return;
+    }
+
+    size_t used = __atomic_add_fetch(&heap_used, size, __ATOMIC_RELAXED);
+    size_t peak = __atomic_load_n(&heap_peak, __ATOMIC_RELAXED);
+
+    while (used > peak && !__atomic_compare_exchange_n(&heap_peak, &peak, used, true, __ATOMIC_RELAXED,
+        __ATOMIC_RELAXED)) {
+    }
+}
+
+/**
+ * The Makefile links with --wrap for these, so every allocation made by the firmware, cJSON and the simulator
+ * itself is counted; the C library's own allocations are not.
+ */
+void* __wrap_malloc(size_t size)
+{
+    void* ptr = __real_malloc(size);
+
+    heap_count(ptr, true);
+
+    return ptr;
+}
+
+void* __wrap_calloc(size_t count, size_t size)
+{
+    void* ptr = __real_calloc(count, size);
+
+    heap_count(ptr, true);
+
+    return ptr;
+}
+
+void* __wrap_realloc(void* ptr, size_t size)
+{
+    heap_count(ptr, false);
+
+    void* moved = __real_realloc(ptr, size);
+
+    // On failure the old block stays allocated
+    heap_count(moved ? moved : (size ? ptr : NULL), true);
+
+    return moved;
+}
+
+void __wrap_free(void* ptr)
+{
+    heap_count(ptr, false);
+    __real_free(ptr);
+}
+
+void* heap_caps_malloc(size_t size, uint32_t caps)
+{
+    return malloc(size);
+}
+
+void heap_caps_free(void* ptr)
+{
+    free(ptr);
+}
+
+size_t heap_caps_get_free_size(uint32_t caps)
+{
+    size_t used = __atomic_load_n(&heap_used, __ATOMIC_RELAXED);
+
+    return used < SIM_HEAP_SIZE ? SIM_HEAP_SIZE - used : 0;
+}
+
+/**
+ * The nominal heap does not fragment.
+ */
+size_t heap_caps_get_largest_free_block(uint32_t caps)
+{
+    return heap_caps_get_free_size(caps);
+}
+
+size_t heap_caps_get_minimum_free_size(uint32_t caps)
+{
+    size_t peak = __atomic_load_n(&heap_peak, __ATOMIC_RELAXED);
+
+    return peak < SIM_HEAP_SIZE ? SIM_HEAP_SIZE - peak : 0;
+}
+
+const char* esp_err_to_name(esp_err_t code)
+{
+    switch (code) {
+    case ESP_OK:
+        return "ESP_OK";
+    case ESP_FAIL:
+        return "ESP_FAIL";
+    case ESP_ERR_NO_MEM:
+        return "ESP_ERR_NO_MEM";
+    case ESP_ERR_INVALID_ARG:
+        return "ESP_ERR_INVALID_ARG";
+    case ESP_ERR_INVALID_STATE:
+        return "ESP_ERR_INVALID_STATE";
+    case ESP_ERR_INVALID_SIZE:
+        return "ESP_ERR_INVALID_SIZE";
+    case ESP_ERR_NOT_FOUND:
+        return "ESP_ERR_NOT_FOUND";
+    case ESP_ERR_TIMEOUT:
+        return "ESP_ERR_TIMEOUT";
+    default:
+        return "UNKNOWN ERROR";
+    }
+}
+
+/**
+ * "*" sets the level of every tag without one of its own.
+ */
+void esp_log_level_set(const char* tag, esp_log_level_t level)
+{
+    pthread_mutex_lock(&log_lock);
+
+    if (strcmp(tag, "*") == 0) {
+        sim_log_level = level;
+    } else {
+        int i = 0;
+
+        while (i < log_tag_count && strcmp(log_tags[i].tag, tag) != 0) {
+            i++;
+        }
+        if (i < SIM_LOG_MAX_TAGS) {
+            snprintf(log_tags[i].tag, sizeof(log_tags[i].tag), "%s", tag);
+            log_tags[i].level = level;
+            log_tag_count = MAX(log_tag_count, i + 1);
+        }
+    }
+
+    pthread_mutex_unlock(&log_lock);
+}
+
+esp_log_level_t esp_log_level_get(const char* tag)
+{
+    esp_log_level_t level;
+
+    pthread_mutex_lock(&log_lock);
+
+    level = sim_log_level;
+    for (int i = 0; i < log_tag_count; i++) {
+        if (strcmp(log_tags[i].tag, tag) == 0) {
+            level = log_tags[i].level;
+        }
+    }
+
+    pthread_mutex_unlock(&log_lock);
+
+    return level;
+}
+
+void sim_log(esp_log_level_t level, const char* tag, const char* format, ...)
+{
+    static const char letters[] = "NEWIDV";
+    va_list args;
+
+    if (level > esp_log_level_get(tag)) {
+        return;
+    }
+
+    va_start(args, format);
+    flockfile(stderr);
+    fprintf(stderr, "%c (%lld) %s: ", letters[level], (long long) (esp_timer_get_time() / 1000), tag);
+    vfprintf(stderr, format, args);
+    fputc('\n', stderr);
+    funlockfile(stderr);
+    va_end(args);
+}
+
+esp_err_t gpio_config(const gpio_config_t* config)
+{
+    pthread_mutex_lock(&gpio_lock);
+
+    for (int pin = 0; pin < SIM_GPIO_COUNT; pin++) {
+        if (!(config->pin_bit_mask & (1ULL << pin))) {
+            continue;
+        }
+
+        if (config->mode == GPIO_MODE_INPUT) {
+            input_pins |= 1ULL << pin;
+        } else {
+            input_pins &= ~(1ULL << pin);
+        }
+        intr_types[pin] = config->intr_type;
+    }
+
+    pthread_mutex_unlock(&gpio_lock);
+
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_level(gpio_num_t pin, uint32_t level)
+{
+    if (pin < 0 || pin >= SIM_GPIO_COUNT) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pthread_mutex_lock(&gpio_lock);
+    if (level) {
+        output_levels |= 1ULL << pin;
+    } else {
+        output_levels &= ~(1ULL << pin);
+    }
+    sim_gpio_fn handler = gpio_handler;
+    void* ctx = gpio_handler_ctx;
+    pthread_mutex_unlock(&gpio_lock);
+
+    if (handler) {
+        handler(pin, level != 0, ctx);
+    }
+
+    return ESP_OK;
+}
+
+int gpio_get_level(gpio_num_t pin)
+{
+    if (pin < 0 || pin >= SIM_GPIO_COUNT) {
+        return 0;
+    }
+
+    pthread_mutex_lock(&gpio_lock);
+    uint64_t levels = input_pins & (1ULL << pin) ? input_levels : output_levels;
+    pthread_mutex_unlock(&gpio_lock);
+
+    return (levels >> pin) & 1;
+}
+
+esp_err_t gpio_install_isr_service(int flags)
+{
+    pthread_mutex_lock(&gpio_lock);
+    bool installed = isr_service_installed;
+    isr_service_installed = true;
+    pthread_mutex_unlock(&gpio_lock);
+
+    return installed ? ESP_ERR_INVALID_STATE : ESP_OK;
+}
+
+esp_err_t gpio_isr_handler_add(gpio_num_t pin, gpio_isr_t handler, void* args)
+{
+    if (pin < 0 || pin >= SIM_GPIO_COUNT) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pthread_mutex_lock(&gpio_lock);
+    bool installed = isr_service_installed;
+    if (installed) {
+        isr_handlers[pin] = handler;
+        isr_args[pin] = args;
+    }
+    pthread_mutex_unlock(&gpio_lock);
+
+    return installed ? ESP_OK : ESP_ERR_INVALID_STATE;
+}
+
+void sim_set_gpio_handler(sim_gpio_fn handler, void* ctx)
+{
+    pthread_mutex_lock(&gpio_lock);
+    gpio_handler = handler;
+    gpio_handler_ctx = ctx;
+    pthread_mutex_unlock(&gpio_lock);
+}
+
+/**
+ * Drives an input pin from outside, running its interrupt handler on the caller's thread when the edge matches.
+ */
+void sim_gpio_set_input(int pin, uint32_t level)
+{
+    if (pin < 0 || pin >= SIM_GPIO_COUNT) {
+        return;
+    }
+
+    pthread_mutex_lock(&gpio_lock);
+    uint32_t before = (input_levels >> pin) & 1;
+    level = level != 0;
+    if (level) {
+        input_levels |= 1ULL << pin;
+    } else {
+        input_levels &= ~(1ULL << pin);
+    }
+
+    gpio_int_type_t type = intr_types[pin];
+    bool fire = isr_handlers[pin] && level != before
+        && (type == GPIO_INTR_ANYEDGE || (type == GPIO_INTR_POSEDGE && level) || (type == GPIO_INTR_NEGEDGE && !level));
+    gpio_isr_t handler = isr_handlers[pin];
+    void* args = isr_args[pin];
+    pthread_mutex_unlock(&gpio_lock);
+
+    if (fire) {
+        handler(args);
+    }
+}
+
+esp_err_t spi_bus_initialize(spi_host_device_t host, const spi_bus_config_t* config, int dma_channel)
+{
+    return ESP_OK;
+}
+
+/**
+ * There is one device; adding it again, as every init does, reconfigures it.
+ */
+esp_err_t spi_bus_add_device(spi_host_device_t host, const spi_device_interface_config_t* config,
+    spi_device_handle_t* handle)
+{
+    if (config->queue_size > SIM_SPI_MAX_QUEUE) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pthread_mutex_lock(&spi_lock);
+    spi_device = (struct sim_spi_device) { .clock_speed_hz = config->clock_speed_hz, .queue_size = config->queue_size };
+    pthread_mutex_unlock(&spi_lock);
+
+    *handle = &spi_device;
+
+    return ESP_OK;
+}
+
+static uint64_t output_snapshot()
+{
+    pthread_mutex_lock(&gpio_lock);
+    uint64_t levels = output_levels;
+    pthread_mutex_unlock(&gpio_lock);
+
+    return levels;
+}
+
+static void spi_deliver(spi_device_handle_t handle, const spi_transaction_t* trans, uint64_t levels)
+{
+    size_t length = trans->length / 8;
+
+    pthread_mutex_lock(&spi_lock);
+    spi_stats.transactions++;
+    spi_stats.bytes += length;
+    if (handle->clock_speed_hz > 0) {
+        spi_wire_ns += (uint64_t) trans->length * 1000000000 / handle->clock_speed_hz;
+    }
+    sim_spi_fn handler = spi_handler;
+    void* ctx = spi_handler_ctx;
+    pthread_mutex_unlock(&spi_lock);
+
+    if (handler && length > 0) {
+        handler(trans->tx_buffer, length, levels, ctx);
+    }
+}
+
+esp_err_t spi_device_polling_transmit(spi_device_handle_t handle, spi_transaction_t* trans)
+{
+    spi_deliver(handle, trans, output_snapshot());
+
+    return ESP_OK;
+}
+
+esp_err_t spi_device_queue_trans(spi_device_handle_t handle, spi_transaction_t* trans, TickType_t timeout)
+{
+    uint64_t levels = output_snapshot();
+
+    pthread_mutex_lock(&spi_lock);
+    if (handle->count == handle->queue_size) {
+        // Nothing completes until a result is fetched, so waiting would not help
+        pthread_mutex_unlock(&spi_lock);
+        return ESP_ERR_TIMEOUT;
+    }
+
+    int tail = (handle->head + handle->count) % handle->queue_size;
+
+    handle->queue[tail] = trans;
+    handle->levels[tail] = levels;
+    handle->count++;
+    pthread_mutex_unlock(&spi_lock);
+
+    return ESP_OK;
+}
+
+esp_err_t spi_device_get_trans_result(spi_device_handle_t handle, spi_transaction_t** trans, TickType_t timeout)
+{
+    pthread_mutex_lock(&spi_lock);
+    if (handle->count == 0) {
+        pthread_mutex_unlock(&spi_lock);
+        return ESP_ERR_TIMEOUT;
+    }
+
+    spi_transaction_t* done = handle->queue[handle->head];
+    uint64_t levels = handle->levels[handle->head];
+
+    handle->head = (handle->head + 1) % handle->queue_size;
+    handle->count--;
+    pthread_mutex_unlock(&spi_lock);
+
+    spi_deliver(handle, done, levels);
+    *trans = done;
+
+    return ESP_OK;
+}
+
+void sim_set_spi_handler(sim_spi_fn handler, void* ctx)
+{
+    pthread_mutex_lock(&spi_lock);
+    spi_handler = handler;
+    spi_handler_ctx = ctx;
+    pthread_mutex_unlock(&spi_lock);
+}
+
+void sim_get_spi_stats(sim_spi_stats* stats)
+{
+    pthread_mutex_lock(&spi_lock);
+    *stats = spi_stats;
+    stats->wire_us = spi_wire_ns / 1000;
+    pthread_mutex_unlock(&spi_lock);
+}
@@ -0,0 +1,195 @@
+/**
+ * The "frames" data partition of partitions.csv as NOR flash: erases set whole sectors to 0xff and writes can
+ * only clear bits. A write that would have to set a bit again is counted as a violation and logged, since the
+ * flash would keep the AND of the old and the new data.
+ *
+ * The partition lives in memory, or in a file that keeps it from one run to the next like a power cycle does.
+ */
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "esp_rom_crc.h"
+
+#include "sim.h"
+
+#define SIM_FLASH_SECTOR_SIZE 4096
+// As in partitions.csv
+#define SIM_FLASH_PARTITION_ADDRESS 0x110000
+#define SIM_FLASH_PARTITION_SIZE 0xf0000
+#define SIM_FLASH_SECTORS (SIM_FLASH_PARTITION_SIZE / SIM_FLASH_SECTOR_SIZE)
+
+static const char* TAG = "flash.c";
+
+static const esp_partition_t frames_partition = {
+    .type = 0x40,
+    .subtype = 0x00,
+    .address = SIM_FLASH_PARTITION_ADDRESS,
+    .size = SIM_FLASH_PARTITION_SIZE,
+    .erase_size = SIM_FLASH_SECTOR_SIZE,
+    .label = "frames",
+};
+
+// Mapped outside the heap that heap_caps counts, like flash
+static uint8_t* flash;
+static uint32_t sector_erases[SIM_FLASH_SECTORS];
+static sim_flash_stats stats;
+
+/**
+ * Backs the partition with the file at `path`, creating it erased, or with memory for NULL. Must come before the
+ * firmware looks for the partition.
+ */
+bool sim_flash_open(const char* path)
+{
+    int fd = -1;
+    bool created = true;
+
+    if (path) {
+        struct stat st;
+
+        fd = open(path, O_RDWR | O_CREAT, 0644);
+        if (fd < 0 || fstat(fd, &st) != 0) {
+            fprintf(stderr, "cannot open %s\n", path);
+            return false;
+        }
+
+        created = st.st_size != SIM_FLASH_PARTITION_SIZE;
+        if (created && ftruncate(fd, SIM_FLASH_PARTITION_SIZE) != 0) {
+            fprintf(stderr, "cannot resize %s\n", path);
+            close(fd);
+            return false;
+        }
+    }
+
+    void* mapped = mmap(NULL, SIM_FLASH_PARTITION_SIZE, PROT_READ | PROT_WRITE,
+        path ? MAP_SHARED : MAP_PRIVATE | MAP_ANONYMOUS, fd, 0);
+
+    if (fd >= 0) {
+        close(fd);
+    }
+    if (mapped == MAP_FAILED) {
+        fprintf(stderr, "cannot map the flash partition\n");
+        return false;
+    }
+
+    flash = mapped;
+    if (created) {
+        memset(flash, 0xff, SIM_FLASH_PARTITION_SIZE);
+    }
+
+    return true;
+}
+
+void sim_flash_get_stats(sim_flash_stats* out)
+{
+    *out = stats;
+}
+
+const esp_partition_t* esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype,
+    const char* label)
+{
+    if (type != frames_partition.type || subtype != frames_partition.subtype
+        || (label && strcmp(label, frames_partition.label) != 0)) {
+        return NULL;
+    }
+
+    if (!flash && !sim_flash_open(NULL)) {
+        return NULL;
+    }
+
+    return &frames_partition;
+}
+
+static bool in_partition(const esp_partition_t* partition, size_t offset, size_t size)
+{
+    return partition == &frames_partition && offset <= partition->size && size <= partition->size - offset;
+}
+
+esp_err_t esp_partition_mmap(const esp_partition_t* partition, size_t offset, size_t size,
+    esp_partition_mmap_memory_t memory, const void** out_ptr, esp_partition_mmap_handle_t* out_handle)
+{
+    if (!in_partition(partition, offset, size)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    *out_ptr = flash + offset;
+    *out_handle = 1;
+
+    return ESP_OK;
+}
+
+void esp_partition_munmap(esp_partition_mmap_handle_t handle)
+{
+}
+
+esp_err_t esp_partition_erase_range(const esp_partition_t* partition, size_t offset, size_t size)
+{
+    if (!in_partition(partition, offset, size) || offset % SIM_FLASH_SECTOR_SIZE || size % SIM_FLASH_SECTOR_SIZE) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memset(flash + offset, 0xff, size);
+
+    for (size_t sector = offset / SIM_FLASH_SECTOR_SIZE; sector < (offset + size) / SIM_FLASH_SECTOR_SIZE;
+         sector++) {
+        stats.erases++;
+        if (++sector_erases[sector] > stats.max_sector_erases) {
+            stats.max_sector_erases = sector_erases[sector];
+        }
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_write(const esp_partition_t* partition, size_t dst_offset, const void* src, size_t size)
+{
+    const uint8_t* data = src;
+    bool unerased = false;
+
+    if (!in_partition(partition, dst_offset, size)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    for (size_t i = 0; i < size; i++) {
+        unerased |= (data[i] & ~flash[dst_offset + i]) != 0;
+        flash[dst_offset + i] &= data[i];
+    }
+
+    if (unerased) {
+        stats.violations++;
+        ESP_LOGW(TAG, "write of %zu bytes at 0x%zx over data that was not erased", size, dst_offset);
+    }
+
+    stats.bytes_written += size;
+
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t* partition, size_t src_offset, void* dst, size_t size)
+{
+    if (!in_partition(partition, src_offset, size)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memcpy(dst, flash + src_offset, size);
+
+    return ESP_OK;
+}
+
+uint32_t esp_rom_crc32_le(uint32_t crc, uint8_t const* buf, uint32_t len)
+{
+    crc = ~crc;
+    while (len--) {
+        crc ^= *buf++;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xedb88320 & -(crc & 1));
+        }
+    }
+
+    return ~crc;
+}
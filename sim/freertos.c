@@ -0,0 +1,410 @@
+/**
+ * FreeRTOS on POSIX threads, as much of it as the firmware uses.
+ *
+ * Every queue, semaphore and event group shares a single lock, which keeps the bookkeeping for sim_wait_idle()
+ * simple: the firmware is idle once every task is blocked without a timeout on a queue that is empty.
+ */
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/event_groups.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#include "esp_timer.h"
+
+#include "sim.h"
+
+struct sim_task {
+    TaskFunction_t code;
+    void* parameters;
+    char name[16];
+    uint32_t stack_depth;
+    pthread_t thread;
+};
+
+/**
+ * Fixed-size items in a ring; semaphores have items of size 0 and only count.
+ */
+struct sim_queue {
+    uint8_t* items;
+    UBaseType_t length;
+    UBaseType_t item_size;
+    UBaseType_t count;
+    UBaseType_t head;
+    // Tasks blocked on this queue without a timeout
+    uint16_t idle_waiters;
+    pthread_cond_t changed;
+    struct sim_queue* next;
+};
+
+struct sim_event_group {
+    EventBits_t bits;
+    pthread_cond_t changed;
+};
+
+static pthread_mutex_t sim_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t idle_changed;
+static pthread_condattr_t cond_attr;
+static struct sim_queue* queues;
+static uint16_t task_count;
+// Tasks blocked on a queue without a timeout
+static uint16_t idle_tasks;
+static pthread_once_t cond_attr_once = PTHREAD_ONCE_INIT;
+static __thread struct sim_task* current_task;
+
+/**
+ * Condition variables wait on the monotonic clock, like the deadlines computed for them.
+ */
+static void cond_attr_init()
+{
+    pthread_condattr_init(&cond_attr);
+    pthread_condattr_setclock(&cond_attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&idle_changed, &cond_attr);
+}
+
+static void sim_cond_init(pthread_cond_t* cond)
+{
+    pthread_once(&cond_attr_once, cond_attr_init);
+    pthread_cond_init(cond, &cond_attr);
+}
+
+static struct timespec deadline_after(TickType_t ticks)
+{
+    struct timespec ts;
+    uint64_t ns = (uint64_t) ticks * portTICK_PERIOD_MS * 1000000;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    ts.tv_sec += ns / 1000000000;
+    ts.tv_nsec += ns % 1000000000;
+    if (ts.tv_nsec >= 1000000000) {
+        ts.tv_sec++;
+        ts.tv_nsec -= 1000000000;
+    }
+
+    return ts;
+}
+
+/**
+ * Waits on `cond` with sim_lock held until signaled or `deadline`; returns false once the deadline has passed.
+ * Without a timeout, a task counts as idle while it waits on `queue`.
+ */
+static bool sim_wait(pthread_cond_t* cond, TickType_t timeout, const struct timespec* deadline,
+    struct sim_queue* queue)
+{
+    if (timeout != portMAX_DELAY) {
+        return pthread_cond_timedwait(cond, &sim_lock, deadline) != ETIMEDOUT;
+    }
+
+    bool counted = current_task && queue;
+
+    if (counted) {
+        queue->idle_waiters++;
+        idle_tasks++;
+        pthread_cond_broadcast(&idle_changed);
+    }
+
+    pthread_cond_wait(cond, &sim_lock);
+
+    if (counted) {
+        queue->idle_waiters--;
+        idle_tasks--;
+    }
+
+    return true;
+}
+
+static void* task_main(void* arg)
+{
+    current_task = arg;
+    current_task->code(current_task->parameters);
+
+    pthread_mutex_lock(&sim_lock);
+    task_count--;
+    pthread_cond_broadcast(&idle_changed);
+    pthread_mutex_unlock(&sim_lock);
+
+    return NULL;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t code, const char* name, uint32_t stack_depth, void* parameters,
+    UBaseType_t priority, TaskHandle_t* handle)
+{
+    struct sim_task* task = calloc(1, sizeof(*task));
+
+    if (!task) {
+        return pdFAIL;
+    }
+
+    task->code = code;
+    task->parameters = parameters;
+    strncpy(task->name, name, sizeof(task->name) - 1);
+    task->stack_depth = stack_depth;
+
+    pthread_mutex_lock(&sim_lock);
+    task_count++;
+    pthread_mutex_unlock(&sim_lock);
+
+    if (pthread_create(&task->thread, NULL, task_main, task) != 0) {
+        pthread_mutex_lock(&sim_lock);
+        task_count--;
+        pthread_mutex_unlock(&sim_lock);
+        free(task);
+        return pdFAIL;
+    }
+
+    pthread_detach(task->thread);
+    pthread_setname_np(task->thread, task->name);
+    if (handle) {
+        *handle = task;
+    }
+
+    return pdPASS;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t code, const char* name, uint32_t stack_depth, void* parameters,
+    UBaseType_t priority, TaskHandle_t* handle, BaseType_t core)
+{
+    return xTaskCreate(code, name, stack_depth, parameters, priority, handle);
+}
+
+char* pcTaskGetName(TaskHandle_t task)
+{
+    return task->name;
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task)
+{
+    return task->stack_depth;
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    uint64_t ns = (uint64_t) ticks * portTICK_PERIOD_MS * 1000000;
+    struct timespec ts = { .tv_sec = ns / 1000000000, .tv_nsec = ns % 1000000000 };
+
+    while (nanosleep(&ts, &ts) != 0 && errno == EINTR) {
+    }
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    return esp_timer_get_time() / 1000 / portTICK_PERIOD_MS;
+}
+
+TickType_t xTaskGetTickCountFromISR(void)
+{
+    return xTaskGetTickCount();
+}
+
+static QueueHandle_t queue_create(UBaseType_t length, UBaseType_t item_size, UBaseType_t count)
+{
+    struct sim_queue* queue = calloc(1, sizeof(*queue));
+
+    if (!queue) {
+        return NULL;
+    }
+
+    queue->items = item_size ? malloc((size_t) length * item_size) : NULL;
+    if (item_size && !queue->items) {
+        free(queue);
+        return NULL;
+    }
+    queue->length = length;
+    queue->item_size = item_size;
+    queue->count = count;
+    sim_cond_init(&queue->changed);
+
+    pthread_mutex_lock(&sim_lock);
+    queue->next = queues;
+    queues = queue;
+    pthread_mutex_unlock(&sim_lock);
+
+    return queue;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size)
+{
+    return queue_create(length, item_size, 0);
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void)
+{
+    return queue_create(1, 0, 0);
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    return queue_create(1, 0, 1);
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t timeout)
+{
+    struct timespec deadline = deadline_after(timeout);
+
+    pthread_mutex_lock(&sim_lock);
+
+    while (queue->count == queue->length) {
+        if (timeout == 0 || !sim_wait(&queue->changed, timeout, &deadline, NULL)) {
+            if (queue->count == queue->length) {
+                pthread_mutex_unlock(&sim_lock);
+                return pdFAIL;
+            }
+        }
+    }
+
+    if (queue->item_size) {
+        UBaseType_t tail = (queue->head + queue->count) % queue->length;
+
+        memcpy(queue->items + (size_t) tail * queue->item_size, item, queue->item_size);
+    }
+    queue->count++;
+    pthread_cond_broadcast(&queue->changed);
+
+    pthread_mutex_unlock(&sim_lock);
+
+    return pdPASS;
+}
+
+BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void* item, BaseType_t* higher_priority_task_woken)
+{
+    if (higher_priority_task_woken) {
+        *higher_priority_task_woken = pdFALSE;
+    }
+
+    return xQueueSend(queue, item, 0);
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t timeout)
+{
+    struct timespec deadline = deadline_after(timeout);
+
+    pthread_mutex_lock(&sim_lock);
+
+    while (queue->count == 0) {
+        if (timeout == 0 || !sim_wait(&queue->changed, timeout, &deadline, queue)) {
+            if (queue->count == 0) {
+                pthread_mutex_unlock(&sim_lock);
+                return pdFAIL;
+            }
+        }
+    }
+
+    if (queue->item_size) {
+        memcpy(item, queue->items + (size_t) queue->head * queue->item_size, queue->item_size);
+    }
+    queue->head = (queue->head + 1) % queue->length;
+    queue->count--;
+    pthread_cond_broadcast(&queue->changed);
+
+    pthread_mutex_unlock(&sim_lock);
+
+    return pdPASS;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue)
+{
+    pthread_mutex_lock(&sim_lock);
+    UBaseType_t count = queue->count;
+    pthread_mutex_unlock(&sim_lock);
+
+    return count;
+}
+
+EventGroupHandle_t xEventGroupCreate(void)
+{
+    struct sim_event_group* group = calloc(1, sizeof(*group));
+
+    if (group) {
+        sim_cond_init(&group->changed);
+    }
+
+    return group;
+}
+
+EventBits_t xEventGroupSetBits(EventGroupHandle_t group, EventBits_t bits)
+{
+    pthread_mutex_lock(&sim_lock);
+    group->bits |= bits;
+    bits = group->bits;
+    pthread_cond_broadcast(&group->changed);
+    pthread_mutex_unlock(&sim_lock);
+
+    return bits;
+}
+
+EventBits_t xEventGroupClearBits(EventGroupHandle_t group, EventBits_t bits)
+{
+    pthread_mutex_lock(&sim_lock);
+    EventBits_t before = group->bits;
+    group->bits &= ~bits;
+    pthread_mutex_unlock(&sim_lock);
+
+    return before;
+}
+
+/**
+ * Unlike FreeRTOS, bits set and cleared again while the caller is not scheduled are missed; the firmware
+ * re-checks on a timeout, so this only delays a waiter.
+ */
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t group, EventBits_t bits, BaseType_t clear_on_exit,
+    BaseType_t wait_for_all, TickType_t timeout)
+{
+    struct timespec deadline = deadline_after(timeout);
+
+    pthread_mutex_lock(&sim_lock);
+
+    while (wait_for_all ? (group->bits & bits) != bits : !(group->bits & bits)) {
+        if (timeout == 0 || !sim_wait(&group->changed, timeout, &deadline, NULL)) {
+            break;
+        }
+    }
+
+    EventBits_t value = group->bits;
+
+    if (clear_on_exit) {
+        group->bits &= ~bits;
+    }
+
+    pthread_mutex_unlock(&sim_lock);
+
+    return value;
+}
+
+static bool sim_is_idle()
+{
+    if (idle_tasks < task_count) {
+        return false;
+    }
+
+    // A task that was just given something to do has not been scheduled yet
+    for (struct sim_queue* queue = queues; queue; queue = queue->next) {
+        if (queue->idle_waiters > 0 && queue->count > 0) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Blocks until every task waits for work without a timeout: queued commands have been drawn and refreshed.
+ */
+void sim_wait_idle()
+{
+    pthread_once(&cond_attr_once, cond_attr_init);
+    pthread_mutex_lock(&sim_lock);
+
+    while (!sim_is_idle()) {
+        pthread_cond_wait(&idle_changed, &sim_lock);
+    }
+
+    pthread_mutex_unlock(&sim_lock);
+}
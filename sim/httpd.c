@@ -0,0 +1,428 @@
+/**
+ * esp_http_server for the simulator: handlers are registered as on the device and requests are dispatched to
+ * them one at a time, like the server's single task does. Requests come from the simulator's script or from a
+ * plain HTTP/1.1 socket on localhost; responses are collected and handed over once the handler returns.
+ */
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netinet/in.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/param.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "esp_http_server.h"
+#include "esp_log.h"
+
+#include "sim.h"
+
+// Largest request head read from the socket
+#define SIM_HTTPD_MAX_HEAD 8192
+
+static const char* TAG = "httpd";
+
+/**
+ * What a handler has sent so far; kept in req->aux.
+ */
+typedef struct sim_response {
+    const sim_request* request;
+    size_t received;
+    char status[48];
+    char headers[512];
+    char type[64];
+    uint8_t* body;
+    size_t length;
+    size_t capacity;
+    bool sent;
+} sim_response;
+
+static httpd_uri_t* handlers;
+static uint16_t handler_count;
+static uint16_t max_handlers;
+static bool started;
+
+esp_err_t httpd_start(httpd_handle_t* handle, const httpd_config_t* config)
+{
+    if (started) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    handlers = calloc(config->max_uri_handlers, sizeof(httpd_uri_t));
+    if (!handlers) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    max_handlers = config->max_uri_handlers;
+    started = true;
+    *handle = &handlers;
+
+    return ESP_OK;
+}
+
+esp_err_t httpd_register_uri_handler(httpd_handle_t handle, const httpd_uri_t* uri_handler)
+{
+    for (uint16_t i = 0; i < handler_count; i++) {
+        if (handlers[i].method == uri_handler->method && strcmp(handlers[i].uri, uri_handler->uri) == 0) {
+            return ESP_ERR_INVALID_STATE;
+        }
+    }
+
+    if (handler_count == max_handlers) {
+        ESP_LOGE(TAG, "no slot left for %s, raise max_uri_handlers", uri_handler->uri);
+        return ESP_ERR_NO_MEM;
+    }
+
+    handlers[handler_count++] = *uri_handler;
+
+    return ESP_OK;
+}
+
+int httpd_req_recv(httpd_req_t* req, char* buf, size_t buf_len)
+{
+    sim_response* response = req->aux;
+    const sim_request* request = response->request;
+    size_t wanted = MIN(buf_len, request->content_length - response->received);
+
+    if (wanted == 0) {
+        return 0;
+    }
+
+    if (response->received < request->length) {
+        wanted = MIN(wanted, request->length - response->received);
+        memcpy(buf, request->body + response->received, wanted);
+        response->received += wanted;
+        return wanted;
+    }
+
+    if (request->fd < 0) {
+        return HTTPD_SOCK_ERR_FAIL;
+    }
+
+    ssize_t ret = recv(request->fd, buf, wanted, 0);
+
+    if (ret <= 0) {
+        return ret == 0 ? 0 : HTTPD_SOCK_ERR_FAIL;
+    }
+    response->received += ret;
+
+    return ret;
+}
+
+esp_err_t httpd_req_get_hdr_value_str(httpd_req_t* req, const char* field, char* value, size_t value_size)
+{
+    const sim_request* request = ((sim_response*) req->aux)->request;
+
+    if (strcasecmp(field, "Content-Type") != 0 || !request->content_type) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    snprintf(value, value_size, "%s", request->content_type);
+
+    return ESP_OK;
+}
+
+esp_err_t httpd_req_get_url_query_str(httpd_req_t* req, char* buf, size_t buf_len)
+{
+    const char* query = strchr(req->uri, '?');
+
+    if (!query) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    snprintf(buf, buf_len, "%s", query + 1);
+
+    return ESP_OK;
+}
+
+/**
+ * Values are copied as they are, without URL decoding, like the device does.
+ */
+esp_err_t httpd_query_key_value(const char* query, const char* key, char* value, size_t value_size)
+{
+    size_t key_length = strlen(key);
+
+    for (const char* at = query; at && *at; at = strchr(at, '&') ? strchr(at, '&') + 1 : NULL) {
+        if (strncmp(at, key, key_length) != 0 || at[key_length] != '=') {
+            continue;
+        }
+
+        const char* start = at + key_length + 1;
+        size_t length = strcspn(start, "&");
+
+        snprintf(value, value_size, "%.*s", (int) length, start);
+
+        return ESP_OK;
+    }
+
+    return ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t httpd_resp_set_status(httpd_req_t* req, const char* status)
+{
+    sim_response* response = req->aux;
+
+    snprintf(response->status, sizeof(response->status), "%s", status);
+
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_set_type(httpd_req_t* req, const char* type)
+{
+    sim_response* response = req->aux;
+
+    snprintf(response->type, sizeof(response->type), "%s", type);
+
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_set_hdr(httpd_req_t* req, const char* field, const char* value)
+{
+    sim_response* response = req->aux;
+    size_t used = strlen(response->headers);
+
+    snprintf(response->headers + used, sizeof(response->headers) - used, "%s: %s\r\n", field, value);
+
+    return ESP_OK;
+}
+
+static esp_err_t response_append(sim_response* response, const char* buf, size_t length)
+{
+    if (response->sent) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    if (response->length + length > response->capacity) {
+        size_t capacity = MAX(response->capacity * 2, response->length + length);
+        uint8_t* body = realloc(response->body, capacity);
+
+        if (!body) {
+            return ESP_ERR_NO_MEM;
+        }
+        response->body = body;
+        response->capacity = capacity;
+    }
+
+    memcpy(response->body + response->length, buf, length);
+    response->length += length;
+
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_send(httpd_req_t* req, const char* buf, ssize_t buf_len)
+{
+    sim_response* response = req->aux;
+    esp_err_t err = response_append(response, buf, buf_len == HTTPD_RESP_USE_STRLEN ? strlen(buf) : buf_len);
+
+    response->sent = true;
+
+    return err;
+}
+
+esp_err_t httpd_resp_send_chunk(httpd_req_t* req, const char* buf, ssize_t buf_len)
+{
+    sim_response* response = req->aux;
+
+    if (!buf || buf_len == 0) {
+        response->sent = true;
+        return ESP_OK;
+    }
+
+    return response_append(response, buf, buf_len == HTTPD_RESP_USE_STRLEN ? strlen(buf) : buf_len);
+}
+
+esp_err_t httpd_resp_send_err(httpd_req_t* req, httpd_err_code_t error, const char* message)
+{
+    static const char* const statuses[] = {
+        [HTTPD_500_INTERNAL_SERVER_ERROR] = "500 Internal Server Error",
+        [HTTPD_501_METHOD_NOT_IMPLEMENTED] = "501 Method Not Implemented",
+        [HTTPD_505_VERSION_NOT_SUPPORTED] = "505 Version Not Supported",
+        [HTTPD_400_BAD_REQUEST] = "400 Bad Request",
+        [HTTPD_401_UNAUTHORIZED] = "401 Unauthorized",
+        [HTTPD_403_FORBIDDEN] = "403 Forbidden",
+        [HTTPD_404_NOT_FOUND] = "404 Not Found",
+        [HTTPD_405_METHOD_NOT_ALLOWED] = "405 Method Not Allowed",
+        [HTTPD_408_REQ_TIMEOUT] = "408 Request Timeout",
+        [HTTPD_411_LENGTH_REQUIRED] = "411 Length Required",
+        [HTTPD_414_URI_TOO_LONG] = "414 URI Too Long",
+        [HTTPD_431_REQ_HDR_FIELDS_TOO_LARGE] = "431 Request Header Fields Too Large",
+    };
+
+    httpd_resp_set_status(req, statuses[error]);
+    httpd_resp_set_type(req, "text/plain");
+
+    return httpd_resp_send(req, message ? message : statuses[error], HTTPD_RESP_USE_STRLEN);
+}
+
+static const httpd_uri_t* find_handler(httpd_method_t method, const char* uri)
+{
+    size_t path_length = strcspn(uri, "?");
+
+    for (uint16_t i = 0; i < handler_count; i++) {
+        if (handlers[i].method == method && strlen(handlers[i].uri) == path_length
+            && strncmp(handlers[i].uri, uri, path_length) == 0) {
+            return &handlers[i];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Runs the handler for `request` and passes its response to `respond`. Returns false when the handler failed,
+ * in which case the device would close the connection; `respond` is only called if a response was sent.
+ */
+bool sim_httpd_handle(const sim_request* request, sim_response_fn respond, void* ctx)
+{
+    sim_response response = { .request = request, .status = "200 OK", .type = "text/html" };
+    httpd_req_t req = { .method = request->method, .content_len = request->content_length, .aux = &response };
+    const httpd_uri_t* handler = find_handler(request->method, request->uri);
+    char headers[sizeof(response.headers) + sizeof(response.type) + 16];
+    esp_err_t err;
+
+    snprintf((char*) req.uri, sizeof(req.uri), "%s", request->uri);
+
+    if (handler) {
+        req.user_ctx = handler->user_ctx;
+        err = handler->handler(&req);
+    } else {
+        err = httpd_resp_send_err(&req, HTTPD_404_NOT_FOUND, "Nothing matches the given URI");
+    }
+
+    if (response.sent) {
+        snprintf(headers, sizeof(headers), "Content-Type: %s\r\n%s", response.type, response.headers);
+        respond(response.status, headers, response.body, response.length, ctx);
+    }
+    free(response.body);
+
+    return err == ESP_OK;
+}
+
+static bool send_all(int fd, const void* data, size_t length)
+{
+    const uint8_t* at = data;
+
+    while (length > 0) {
+        ssize_t ret = send(fd, at, length, MSG_NOSIGNAL);
+
+        if (ret < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ret <= 0) {
+            return false;
+        }
+        at += ret;
+        length -= ret;
+    }
+
+    return true;
+}
+
+static void socket_respond(const char* status, const char* headers, const uint8_t* body, size_t length, void* ctx)
+{
+    int fd = *(int*) ctx;
+    char head[1024];
+    int head_length = snprintf(head, sizeof(head), "HTTP/1.1 %s\r\n%sContent-Length: %zu\r\nConnection: close\r\n\r\n",
+        status, headers, length);
+
+    if (send_all(fd, head, MIN((size_t) head_length, sizeof(head) - 1))) {
+        send_all(fd, body, length);
+    }
+}
+
+/**
+ * Reads the request head and runs the request; the body is left on the socket for httpd_req_recv().
+ */
+static void serve_connection(int fd)
+{
+    char head[SIM_HTTPD_MAX_HEAD + 1];
+    size_t length = 0;
+    char* end = NULL;
+
+    while (!end && length < SIM_HTTPD_MAX_HEAD) {
+        ssize_t ret = recv(fd, head + length, SIM_HTTPD_MAX_HEAD - length, 0);
+
+        if (ret <= 0) {
+            return;
+        }
+        length += ret;
+        head[length] = '\0';
+        end = strstr(head, "\r\n\r\n");
+    }
+
+    if (!end) {
+        return;
+    }
+
+    char method[8];
+    char uri[HTTPD_MAX_URI_LEN + 1];
+    char content_type[64] = "";
+    size_t content_length = 0;
+
+    *end = '\0';
+    if (sscanf(head, "%7s %512s", method, uri) != 2) {
+        return;
+    }
+
+    for (char* line = strstr(head, "\r\n"); line; line = strstr(line + 2, "\r\n")) {
+        if (strncasecmp(line + 2, "Content-Type:", 13) == 0) {
+            sscanf(line + 15, " %63[^\r;]", content_type);
+        } else if (strncasecmp(line + 2, "Content-Length:", 15) == 0) {
+            content_length = strtoul(line + 17, NULL, 10);
+        }
+    }
+
+    const char* body = end + 4;
+    sim_request request = {
+        .method = strcmp(method, "POST") == 0 ? HTTP_POST : strcmp(method, "PUT") == 0 ? HTTP_PUT : HTTP_GET,
+        .uri = uri,
+        .content_type = content_type[0] ? content_type : NULL,
+        .content_length = content_length,
+        .body = (const uint8_t*) body,
+        .length = MIN(length - (body - head), content_length),
+        .fd = fd,
+    };
+
+    sim_httpd_handle(&request, socket_respond, &fd);
+}
+
+/**
+ * Serves HTTP on localhost:`port`, one connection at a time, until `stop` is set. Returns false when the port
+ * cannot be opened.
+ */
+bool sim_httpd_serve(uint16_t port, volatile bool* stop)
+{
+    struct sockaddr_in address = { .sin_family = AF_INET, .sin_port = htons(port) };
+    int server = socket(AF_INET, SOCK_STREAM, 0);
+    int reuse = 1;
+
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    setsockopt(server, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    if (server < 0 || bind(server, (struct sockaddr*) &address, sizeof(address)) != 0 || listen(server, 4) != 0) {
+        ESP_LOGE(TAG, "cannot listen on port %u: %s", port, strerror(errno));
+        if (server >= 0) {
+            close(server);
+        }
+        return false;
+    }
+
+    ESP_LOGI(TAG, "serving on http://127.0.0.1:%u/", port);
+
+    while (!*stop) {
+        int fd = accept(server, NULL, NULL);
+
+        if (fd < 0) {
+            continue;
+        }
+
+        serve_connection(fd);
+        close(fd);
+    }
+
+    close(server);
+
+    return true;
+}
@@ -0,0 +1,5 @@
+#pragma once
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define DMA_ATTR
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+#include "esp_err.h"
+
+// Requests are served one at a time from the simulator's main thread, see ../../httpd.c
+
+#define HTTPD_MAX_URI_LEN 512
+#define HTTPD_RESP_USE_STRLEN -1
+#define HTTPD_SOCK_ERR_FAIL -1
+#define HTTPD_SOCK_ERR_INVALID -2
+#define HTTPD_SOCK_ERR_TIMEOUT -3
+
+typedef enum {
+    HTTP_DELETE = 0,
+    HTTP_GET = 1,
+    HTTP_HEAD = 2,
+    HTTP_POST = 3,
+    HTTP_PUT = 4,
+} httpd_method_t;
+
+typedef enum {
+    HTTPD_500_INTERNAL_SERVER_ERROR = 0,
+    HTTPD_501_METHOD_NOT_IMPLEMENTED,
+    HTTPD_505_VERSION_NOT_SUPPORTED,
+    HTTPD_400_BAD_REQUEST,
+    HTTPD_401_UNAUTHORIZED,
+    HTTPD_403_FORBIDDEN,
+    HTTPD_404_NOT_FOUND,
+    HTTPD_405_METHOD_NOT_ALLOWED,
+    HTTPD_408_REQ_TIMEOUT,
+    HTTPD_411_LENGTH_REQUIRED,
+    HTTPD_414_URI_TOO_LONG,
+    HTTPD_431_REQ_HDR_FIELDS_TOO_LARGE,
+} httpd_err_code_t;
+
+typedef void* httpd_handle_t;
+
+typedef struct httpd_req {
+    httpd_handle_t handle;
+    int method;
+    const char uri[HTTPD_MAX_URI_LEN + 1];
+    size_t content_len;
+    void* aux;
+    void* user_ctx;
+    void* sess_ctx;
+} httpd_req_t;
+
+typedef struct httpd_uri {
+    const char* uri;
+    httpd_method_t method;
+    esp_err_t (*handler)(httpd_req_t* req);
+    void* user_ctx;
+} httpd_uri_t;
+
+typedef struct httpd_config {
+    unsigned task_priority;
+    size_t stack_size;
+    int core_id;
+    uint16_t server_port;
+    uint16_t max_open_sockets;
+    uint16_t max_uri_handlers;
+    uint16_t max_resp_headers;
+    bool lru_purge_enable;
+} httpd_config_t;
+
+#define HTTPD_DEFAULT_CONFIG()                                                                                     \
+    {                                                                                                              \
+        .task_priority = 5, .stack_size = 4096, .core_id = 0x7fffffff, .server_port = 80, .max_open_sockets = 7, \
+        .max_uri_handlers = 8, .max_resp_headers = 8, .lru_purge_enable = false,                                  \
+    }
+
+esp_err_t httpd_start(httpd_handle_t* handle, const httpd_config_t* config);
+esp_err_t httpd_register_uri_handler(httpd_handle_t handle, const httpd_uri_t* uri_handler);
+
+int httpd_req_recv(httpd_req_t* req, char* buf, size_t buf_len);
+esp_err_t httpd_req_get_hdr_value_str(httpd_req_t* req, const char* field, char* value, size_t value_size);
+esp_err_t httpd_req_get_url_query_str(httpd_req_t* req, char* buf, size_t buf_len);
+esp_err_t httpd_query_key_value(const char* query, const char* key, char* value, size_t value_size);
+
+esp_err_t httpd_resp_set_status(httpd_req_t* req, const char* status);
+esp_err_t httpd_resp_set_type(httpd_req_t* req, const char* type);
+esp_err_t httpd_resp_set_hdr(httpd_req_t* req, const char* field, const char* value);
+esp_err_t httpd_resp_send(httpd_req_t* req, const char* buf, ssize_t buf_len);
+esp_err_t httpd_resp_send_chunk(httpd_req_t* req, const char* buf, ssize_t buf_len);
+esp_err_t httpd_resp_send_err(httpd_req_t* req, httpd_err_code_t error, const char* message);
@@ -0,0 +1,6 @@
+#pragma once
+
+#include <stdint.h>
+
+// CRC-32 as the ROM computes it: pass 0, or the result for the data before
+uint32_t esp_rom_crc32_le(uint32_t crc, uint8_t const* buf, uint32_t len);
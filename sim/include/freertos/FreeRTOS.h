@@ -0,0 +1,41 @@
+#pragma once
+
+// Host stand-in for FreeRTOS: tasks are threads, queues, semaphores and event groups are built on one lock and
+// condition variables, see ../../freertos.c. Ticks run at CONFIG_FREERTOS_HZ of sdkconfig.esp32dev.
+
+#include <assert.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdFAIL pdFALSE
+#define pdPASS pdTRUE
+
+#define configTICK_RATE_HZ 100
+#define portTICK_PERIOD_MS (1000 / configTICK_RATE_HZ)
+#define portMAX_DELAY ((TickType_t) 0xffffffff)
+#define pdMS_TO_TICKS(ms) ((TickType_t) (((uint64_t) (ms) * configTICK_RATE_HZ) / 1000))
+#define pdTICKS_TO_MS(ticks) ((TickType_t) (((uint64_t) (ticks) * 1000) / configTICK_RATE_HZ))
+
+// The spinlock taken by taskENTER_CRITICAL()
+typedef pthread_mutex_t portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED PTHREAD_MUTEX_INITIALIZER
+
+#define configASSERT(x) assert(x)
+#define portYIELD_FROM_ISR(...) \
+    do {                        \
+    } while (0)
+
+#ifndef BIT0
+#define BIT0 0x00000001
+#define BIT1 0x00000002
+#define BIT2 0x00000004
+#define BIT3 0x00000008
+#endif
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+
+// Like FreeRTOS, a semaphore is a queue of empty items; a mutex starts out given and is not recursive
+typedef QueueHandle_t SemaphoreHandle_t;
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void);
+SemaphoreHandle_t xSemaphoreCreateMutex(void);
+
+#define xSemaphoreTake(semaphore, timeout) xQueueReceive((semaphore), NULL, (timeout))
+#define xSemaphoreGive(semaphore) xQueueSend((semaphore), NULL, 0)
+#define xSemaphoreGiveFromISR(semaphore, woken) xQueueSendFromISR((semaphore), NULL, (woken))
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct sim_task* TaskHandle_t;
+typedef void (*TaskFunction_t)(void* parameters);
+
+#define taskENTER_CRITICAL(mux) pthread_mutex_lock(mux)
+#define taskEXIT_CRITICAL(mux) pthread_mutex_unlock(mux)
+
+BaseType_t xTaskCreate(TaskFunction_t code, const char* name, uint32_t stack_depth, void* parameters,
+    UBaseType_t priority, TaskHandle_t* handle);
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t code, const char* name, uint32_t stack_depth, void* parameters,
+    UBaseType_t priority, TaskHandle_t* handle, BaseType_t core);
+
+void vTaskDelay(TickType_t ticks);
+TickType_t xTaskGetTickCount(void);
+TickType_t xTaskGetTickCountFromISR(void);
+
+char* pcTaskGetName(TaskHandle_t task);
+// The host does not track stack use: reports the whole stack as never touched
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task);
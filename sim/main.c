@@ -0,0 +1,396 @@
+/**
+ * Runs the firmware's display task, button task and HTTP handlers on the host against a simulated panel.
+ *
+ *   epaper_sim [-o dir] [-P] [-b scale] [-i ms] [-f file] [-s] [-v | -q] [-p port | script ...]
+ *
+ *   -o dir    write every refresh as dir/frame-NNNN.ppm, the command log as dir/commands.log and the final
+ *             screen as dir/screen.ppm
+ *   -P        also write the controller RAM planes of every refresh as PBM
+ *   -b scale  hold BUSY_N low for this fraction of the modeled time of each panel operation (default 0)
+ *   -i ms     keep the controller awake this long after a refresh (default EPAPER_IDLE_SLEEP_MS); a wait
+ *             includes it, since the display task is not idle until the controller is asleep
+ *   -f file   keep the flash partition holding the screen slots in this file, so that a later run starts with
+ *             them like the device after a power cycle (the panel starts out white though)
+ *   -s        exit with status 1 when the flash or the panel saw a command it would have ignored or misread
+ *   -p port   serve the HTTP API on 127.0.0.1:port until interrupted, e.g. for curl
+ *
+ * Scripts ("-" or none: stdin) hold one step per line:
+ *
+ *   GET <uri> [> file]         runs a request, optionally saving the response body
+ *   POST <uri> @file           posts a file; .bin and .raw files as application/octet-stream, others as JSON
+ *   POST <uri> <body>          posts the rest of the line as JSON
+ *   button <1-3>               presses a button; presses 300 ms apart or less are debounced as on the device
+ *   wait                       waits until the display task has applied and refreshed everything queued
+ *   sleep <ms>
+ *   save <file>                writes what the screen shows as a PPM
+ *
+ * Every script ends with an implicit wait. Lines starting with # are comments.
+ */
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "esp_log.h"
+
+#include "button.h"
+#include "display.h"
+#include "epaper.h"
+#include "http.h"
+#include "metrics.h"
+#include "panel.h"
+#include "sim.h"
+
+// Longest script line, and largest file a script posts
+#define SIM_MAX_LINE 16384
+#define SIM_MAX_FILE (1024 * 1024)
+
+static volatile bool stop_serving;
+
+static void on_interrupt(int signal)
+{
+    stop_serving = true;
+}
+
+static uint8_t* read_file(const char* path, size_t* length)
+{
+    FILE* file = fopen(path, "rb");
+    uint8_t* data = file ? malloc(SIM_MAX_FILE) : NULL;
+
+    if (!data) {
+        if (file) {
+            fclose(file);
+        }
+        return NULL;
+    }
+
+    *length = fread(data, 1, SIM_MAX_FILE, file);
+    fclose(file);
+
+    return data;
+}
+
+static bool has_suffix(const char* text, const char* suffix)
+{
+    size_t length = strlen(text);
+    size_t suffix_length = strlen(suffix);
+
+    return length >= suffix_length && strcmp(text + length - suffix_length, suffix) == 0;
+}
+
+/**
+ * Prints a one-line summary of the response, and saves its body to the path in `ctx` if there is one.
+ */
+static void print_response(const char* status, const char* headers, const uint8_t* body, size_t length, void* ctx)
+{
+    const char* save_path = ctx;
+    const char* ticket = strstr(headers, "X-Display-Ticket: ");
+    bool printable = length <= 80;
+
+    for (size_t i = 0; i < length && printable; i++) {
+        printable = body[i] >= 0x20 && body[i] < 0x7f;
+    }
+
+    printf("  %s", status);
+    if (ticket) {
+        printf(", ticket %.*s", (int) strcspn(ticket + 18, "\r"), ticket + 18);
+    }
+    if (printable) {
+        printf(", \"%.*s\"\n", (int) length, body);
+    } else {
+        printf(", %zu bytes\n", length);
+    }
+
+    if (save_path) {
+        FILE* file = fopen(save_path, "wb");
+
+        if (!file || fwrite(body, 1, length, file) != length) {
+            fprintf(stderr, "cannot write %s\n", save_path);
+        }
+        if (file) {
+            fclose(file);
+        }
+    }
+}
+
+static bool run_request(httpd_method_t method, char* args)
+{
+    char* uri = strtok(args, " \t");
+    char* rest = uri ? strtok(NULL, "") : NULL;
+    sim_request request = { .method = method, .uri = uri, .fd = -1 };
+    uint8_t* file_data = NULL;
+    const char* save_path = NULL;
+
+    if (!uri) {
+        return false;
+    }
+
+    rest = rest ? rest + strspn(rest, " \t") : NULL;
+
+    if (method == HTTP_GET && rest && rest[0] == '>') {
+        save_path = strtok(rest + 1, " \t");
+    } else if (method == HTTP_POST && rest && rest[0] == '@') {
+        file_data = read_file(rest + 1, &request.length);
+        if (!file_data) {
+            fprintf(stderr, "cannot read %s\n", rest + 1);
+            return false;
+        }
+        request.body = file_data;
+        request.content_type = has_suffix(rest, ".bin") || has_suffix(rest, ".raw") ? "application/octet-stream"
+                                                                                      : "application/json";
+    } else if (method == HTTP_POST && rest) {
+        request.body = (const uint8_t*) rest;
+        request.length = strlen(rest);
+        request.content_type = "application/json";
+    }
+    request.content_length = request.length;
+
+    printf("%s %s\n", method == HTTP_POST ? "POST" : "GET", uri);
+    if (!sim_httpd_handle(&request, print_response, (void*) save_path)) {
+        printf("  handler failed\n");
+    }
+    free(file_data);
+
+    return true;
+}
+
+static bool press_button(int button)
+{
+    static const int pins[] = { BUTTON1_PIN, BUTTON2_PIN, BUTTON3_PIN };
+
+    if (button < 1 || button > 3) {
+        return false;
+    }
+
+    printf("button %d\n", button);
+    sim_gpio_set_input(pins[button - 1], 0);
+    sim_gpio_set_input(pins[button - 1], 1);
+
+    return true;
+}
+
+static bool run_line(char* line)
+{
+    char* command = strtok(line, " \t\r\n");
+    char* args = command ? strtok(NULL, "\r\n") : NULL;
+
+    if (!command || command[0] == '#') {
+        return true;
+    }
+
+    if (strcmp(command, "GET") == 0 && args) {
+        return run_request(HTTP_GET, args);
+    }
+    if (strcmp(command, "POST") == 0 && args) {
+        return run_request(HTTP_POST, args);
+    }
+    if (strcmp(command, "button") == 0 && args) {
+        return press_button(atoi(args));
+    }
+    if (strcmp(command, "wait") == 0) {
+        sim_wait_idle();
+        return true;
+    }
+    if (strcmp(command, "sleep") == 0 && args) {
+        usleep(atoi(args) * 1000);
+        return true;
+    }
+    if (strcmp(command, "save") == 0 && args) {
+        sim_wait_idle();
+        return panel_save(strtok(args, " \t"));
+    }
+
+    return false;
+}
+
+static bool run_script(const char* path)
+{
+    FILE* file = strcmp(path, "-") == 0 ? stdin : fopen(path, "r");
+    char* line = malloc(SIM_MAX_LINE);
+    unsigned number = 0;
+    bool ok = true;
+
+    if (!file || !line) {
+        fprintf(stderr, "cannot read %s\n", path);
+        free(line);
+        return false;
+    }
+
+    while (fgets(line, SIM_MAX_LINE, file)) {
+        number++;
+        if (!run_line(line)) {
+            fprintf(stderr, "%s:%u: cannot run this line\n", path, number);
+            ok = false;
+            break;
+        }
+    }
+
+    if (file != stdin) {
+        fclose(file);
+    }
+    free(line);
+    sim_wait_idle();
+
+    return ok;
+}
+
+static void print_report()
+{
+    panel_stats panel;
+    sim_spi_stats spi;
+    display_stats display;
+    epaper_refresh_stats refresh;
+    epaper_busy_stats busy;
+    power_stats power;
+    sim_flash_stats flash;
+
+    panel_get_stats(&panel);
+    sim_get_spi_stats(&spi);
+    display_get_stats(&display);
+    epaper_get_refresh_stats(&refresh);
+    epaper_get_busy_stats(&busy);
+    epaper_get_power_stats(&power);
+    sim_flash_get_stats(&flash);
+
+    printf("\npanel:   %lu commands, %llu data bytes, %lu reset(s), %lu full and %lu partial refresh(es), "
+           "%lu deep sleep(s), %.1f s busy, %lu violation(s)\n",
+        (unsigned long) panel.commands, (unsigned long long) panel.data_bytes, (unsigned long) panel.resets,
+        (unsigned long) panel.full_refreshes, (unsigned long) panel.partial_refreshes,
+        (unsigned long) panel.deep_sleeps, panel.busy_us / 1e6, (unsigned long) panel.violations);
+    printf("spi:     %lu transactions, %llu bytes, %.1f ms on the wire\n", (unsigned long) spi.transactions,
+        (unsigned long long) spi.bytes, spi.wire_us / 1e3);
+    printf("display: %lu commands in %lu batches, %lu dropped, %u items in %lu bytes, %lu unlisted\n",
+        (unsigned long) display.commands, (unsigned long) display.batches, (unsigned long) display.dropped,
+        display.items, (unsigned long) display.list_bytes, (unsigned long) display.unlisted);
+    printf("epaper:  %lu full, %lu partial, %lu skipped, %lu banded refresh(es); %lu BUSY waits, %lu timeouts\n",
+        (unsigned long) refresh.full, (unsigned long) refresh.partial, (unsigned long) refresh.skipped,
+        (unsigned long) refresh.banded, (unsigned long) busy.waits, (unsigned long) busy.timeouts);
+    printf("power:   %s;", power_state_name(power.state));
+    for (int i = 0; i < POWER_TRANSITION_COUNT; i++) {
+        printf("%s %lu %s, last %.1f ms", i > 0 ? "," : "", (unsigned long) power.transitions[i].count,
+            power_transition_name(i), power.transitions[i].last_us / 1e3);
+    }
+    printf("\n");
+    printf("flash:   %lu sector erases, at most %lu of one sector, %llu bytes written, %lu violation(s)\n",
+        (unsigned long) flash.erases, (unsigned long) flash.max_sector_erases,
+        (unsigned long long) flash.bytes_written, (unsigned long) flash.violations);
+}
+
+static void usage()
+{
+    fprintf(stderr,
+        "usage: epaper_sim [-o dir] [-P] [-b scale] [-i ms] [-f file] [-s] [-v | -q] [-p port | script ...]\n");
+    exit(2);
+}
+
+int main(int argc, char** argv)
+{
+    panel_options options = { 0 };
+    const char* dir = NULL;
+    bool strict = false;
+    int port = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "o:Pb:i:f:sp:vq")) != -1) {
+        switch (opt) {
+        case 'o':
+            dir = optarg;
+            break;
+        case 'P':
+            options.planes = true;
+            break;
+        case 'b':
+            options.busy_scale = atof(optarg);
+            break;
+        case 'i':
+            epaper_set_idle_timeout(atoi(optarg));
+            break;
+        case 'f':
+            if (!sim_flash_open(optarg)) {
+                return 2;
+            }
+            break;
+        case 's':
+            strict = true;
+            break;
+        case 'p':
+            port = atoi(optarg);
+            break;
+        case 'v':
+            sim_log_level = ESP_LOG_DEBUG;
+            break;
+        case 'q':
+            sim_log_level = ESP_LOG_WARN;
+            break;
+        default:
+            usage();
+        }
+    }
+
+    if (dir) {
+        char path[512];
+
+        snprintf(path, sizeof(path), "%s/commands.log", dir);
+        options.dir = dir;
+        options.log = fopen(path, "w");
+        if (!options.log) {
+            fprintf(stderr, "cannot write %s\n", path);
+            return 2;
+        }
+    }
+
+    sim_init();
+    panel_init(&options);
+
+    // app_main() without Wi-Fi: the HTTP server starts right away instead of once connected
+    TaskHandle_t button_task = NULL;
+    TaskHandle_t display_task = NULL;
+
+    button_create_task(&button_task);
+    display_create_task(&display_task);
+    metrics_watch_task(button_task);
+    metrics_watch_task(display_task);
+    http_server_init();
+    sim_wait_idle();
+
+    bool ok = true;
+
+    if (port) {
+        struct sigaction action = { .sa_handler = on_interrupt };
+
+        sigaction(SIGINT, &action, NULL);
+        sigaction(SIGTERM, &action, NULL);
+        ok = sim_httpd_serve(port, &stop_serving);
+        sim_wait_idle();
+    } else if (optind == argc) {
+        ok = run_script("-");
+    }
+
+    for (int i = optind; i < argc && ok && !port; i++) {
+        ok = run_script(argv[i]);
+    }
+
+    panel_finish();
+
+    if (dir) {
+        char path[512];
+
+        snprintf(path, sizeof(path), "%s/screen.ppm", dir);
+        panel_save(path);
+        fclose(options.log);
+    }
+
+    print_report();
+
+    panel_stats panel;
+    sim_flash_stats flash;
+    panel_get_stats(&panel);
+    sim_flash_get_stats(&flash);
+
+    if (!ok) {
+        return 2;
+    }
+
+    return strict && (panel.violations || flash.violations) ? 1 : 0;
+}
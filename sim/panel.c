@@ -0,0 +1,545 @@
+/**
+ * A UC8179 800x480 black/white/red controller as far as epaper.c drives it.
+ *
+ * Commands and their data arrive over the SPI hook with the DC and CS levels they were sent with. Image data
+ * (0x10 black/white, 0x13 red) fills controller RAM, inside the partial window (0x90) while partial mode
+ * (0x91) is on; a refresh (0x12) copies RAM to the screen, within the window in partial mode, and writes the
+ * screen out as a PPM. BUSY_N follows the modeled duration of each operation, scaled by the busy_scale option.
+ *
+ * Anything the controller would ignore or misread is counted as a violation and logged: commands while BUSY_N
+ * is low or while in deep sleep, refreshes while the charge pump is off, data past the end of the window.
+ *
+ * RAM polarity follows the firmware's VCOM and data interval setting: black/white 1 = white, red 1 = red.
+ */
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include "driver/gpio.h"
+
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "epaper.h"
+#include "panel.h"
+#include "sim.h"
+
+// Rough figures for the operations that hold BUSY_N low, in ms
+#ifndef PANEL_RESET_MS
+#define PANEL_RESET_MS 2
+#endif
+#ifndef PANEL_POWER_ON_MS
+#define PANEL_POWER_ON_MS 100
+#endif
+#ifndef PANEL_POWER_OFF_MS
+#define PANEL_POWER_OFF_MS 50
+#endif
+// A black/white/red refresh, partial or not
+#ifndef PANEL_REFRESH_MS
+#define PANEL_REFRESH_MS 15000
+#endif
+
+// Most parameter bytes kept for the log
+#define PANEL_MAX_PARAMS 16
+
+static const char* TAG = "panel";
+
+typedef struct panel_window {
+    uint16_t x_byte;
+    uint16_t y;
+    uint16_t width_bytes;
+    uint16_t height;
+} panel_window;
+
+static const panel_window full_window = { .width_bytes = DISPLAY_STRIDE, .height = DISPLAY_HEIGHT };
+
+static pthread_mutex_t panel_lock = PTHREAD_MUTEX_INITIALIZER;
+static panel_options options;
+static panel_stats stats;
+
+static uint8_t bw_ram[DISPLAY_BUFFER_SIZE];
+static uint8_t red_ram[DISPLAY_BUFFER_SIZE];
+static uint8_t bw_screen[DISPLAY_BUFFER_SIZE];
+static uint8_t red_screen[DISPLAY_BUFFER_SIZE];
+
+static bool powered;
+static bool deep_sleep;
+static bool partial_mode;
+static panel_window window;
+
+// The command being received, its parameters and the image data written for it
+static bool has_command;
+static uint8_t command;
+static uint8_t params[PANEL_MAX_PARAMS];
+static uint32_t param_count;
+static uint32_t data_cursor;
+static bool overflowed;
+static int64_t command_us;
+
+// Something was sent since the controller went to sleep; reported once per sleep
+static bool woken_in_sleep;
+static bool reset_low;
+static int64_t busy_until_us;
+
+static const char* command_name(uint8_t command)
+{
+    switch (command) {
+    case 0x00:
+        return "PSR panel setting";
+    case 0x01:
+        return "PWR power setting";
+    case 0x02:
+        return "POF power off";
+    case 0x04:
+        return "PON power on";
+    case 0x06:
+        return "BTST booster soft start";
+    case 0x07:
+        return "DSLP deep sleep";
+    case 0x10:
+        return "DTM1 black/white data";
+    case 0x12:
+        return "DRF display refresh";
+    case 0x13:
+        return "DTM2 red data";
+    case 0x15:
+        return "DUSPI dual SPI";
+    case 0x50:
+        return "CDI VCOM and data interval";
+    case 0x60:
+        return "TCON";
+    case 0x61:
+        return "TRES resolution";
+    case 0x90:
+        return "PTL partial window";
+    case 0x91:
+        return "PTIN partial in";
+    case 0x92:
+        return "PTOUT partial out";
+    case 0xe0:
+        return "CCSET cascade setting";
+    case 0xe5:
+        return "TSSET force temperature";
+    default:
+        return "?";
+    }
+}
+
+static void __attribute__((format(printf, 1, 2))) violation(const char* format, ...)
+{
+    char message[96];
+    va_list args;
+
+    va_start(args, format);
+    vsnprintf(message, sizeof(message), format, args);
+    va_end(args);
+    stats.violations++;
+    sim_log(ESP_LOG_WARN, TAG, "%s", message);
+    if (options.log) {
+        fprintf(options.log, "%12lld us  !! %s\n", (long long) esp_timer_get_time(), message);
+    }
+}
+
+static void* busy_release(void* arg)
+{
+    int64_t until_us = (int64_t) (intptr_t) arg;
+
+    // A later operation may have pushed the release out
+    while (true) {
+        int64_t remaining = until_us - esp_timer_get_time();
+
+        if (remaining > 0) {
+            struct timespec ts = { .tv_sec = remaining / 1000000, .tv_nsec = (remaining % 1000000) * 1000 };
+            nanosleep(&ts, NULL);
+        }
+
+        pthread_mutex_lock(&panel_lock);
+        bool later = busy_until_us > until_us;
+        until_us = busy_until_us;
+        pthread_mutex_unlock(&panel_lock);
+
+        if (!later) {
+            break;
+        }
+    }
+
+    sim_gpio_set_input(PANEL_BUSY_PIN, 1);
+
+    return NULL;
+}
+
+/**
+ * Holds BUSY_N low for the scaled duration of an operation that takes `ms`.
+ */
+static void panel_busy(uint32_t ms)
+{
+    stats.busy_us += (uint64_t) ms * 1000;
+
+    int64_t scaled_us = (int64_t) (ms * 1000 * options.busy_scale);
+    pthread_t thread;
+
+    if (scaled_us <= 0) {
+        return;
+    }
+
+    busy_until_us = esp_timer_get_time() + scaled_us;
+    sim_gpio_set_input(PANEL_BUSY_PIN, 0);
+
+    if (pthread_create(&thread, NULL, busy_release, (void*) (intptr_t) busy_until_us) == 0) {
+        pthread_detach(thread);
+    } else {
+        sim_gpio_set_input(PANEL_BUSY_PIN, 1);
+    }
+}
+
+static bool panel_is_busy()
+{
+    return gpio_get_level(PANEL_BUSY_PIN) == 0;
+}
+
+static bool write_pbm(const char* path, const uint8_t* plane, bool invert)
+{
+    FILE* file = fopen(path, "wb");
+
+    if (!file) {
+        return false;
+    }
+
+    // PBM is 1 = black, MSB first, rows padded to bytes like the planes
+    fprintf(file, "P4\n%d %d\n", DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    for (size_t i = 0; i < DISPLAY_BUFFER_SIZE; i++) {
+        fputc(invert ? ~plane[i] & 0xff : plane[i], file);
+    }
+
+    return fclose(file) == 0;
+}
+
+static bool write_ppm(const char* path, const uint8_t* bw, const uint8_t* red)
+{
+    FILE* file = fopen(path, "wb");
+
+    if (!file) {
+        return false;
+    }
+
+    fprintf(file, "P6\n%d %d\n255\n", DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    for (size_t i = 0; i < DISPLAY_BUFFER_SIZE; i++) {
+        for (uint8_t bit = 0x80; bit; bit >>= 1) {
+            static const uint8_t black[3] = { 0, 0, 0 };
+            static const uint8_t white[3] = { 255, 255, 255 };
+            static const uint8_t red_pixel[3] = { 200, 0, 0 };
+
+            fwrite(red[i] & bit ? red_pixel : bw[i] & bit ? white : black, 1, 3, file);
+        }
+    }
+
+    return fclose(file) == 0;
+}
+
+static void panel_dump_frame()
+{
+    char path[512];
+    uint32_t frame = stats.full_refreshes + stats.partial_refreshes;
+
+    if (!options.dir) {
+        return;
+    }
+
+    snprintf(path, sizeof(path), "%s/frame-%04lu.ppm", options.dir, (unsigned long) frame);
+    if (!write_ppm(path, bw_screen, red_screen)) {
+        sim_log(ESP_LOG_ERROR, TAG, "cannot write %s", path);
+    }
+
+    if (options.planes) {
+        snprintf(path, sizeof(path), "%s/frame-%04lu-black.pbm", options.dir, (unsigned long) frame);
+        write_pbm(path, bw_ram, true);
+        snprintf(path, sizeof(path), "%s/frame-%04lu-red.pbm", options.dir, (unsigned long) frame);
+        write_pbm(path, red_ram, false);
+    }
+}
+
+static void panel_refresh()
+{
+    const panel_window* area = partial_mode ? &window : &full_window;
+
+    if (!powered) {
+        violation("refresh with the charge pump off");
+        return;
+    }
+
+    for (uint16_t row = 0; row < area->height; row++) {
+        size_t offset = (size_t) (area->y + row) * DISPLAY_STRIDE + area->x_byte;
+
+        memcpy(bw_screen + offset, bw_ram + offset, area->width_bytes);
+        memcpy(red_screen + offset, red_ram + offset, area->width_bytes);
+    }
+
+    if (partial_mode) {
+        stats.partial_refreshes++;
+    } else {
+        stats.full_refreshes++;
+    }
+
+    panel_dump_frame();
+    panel_busy(PANEL_REFRESH_MS);
+}
+
+/**
+ * Logs the command that was being received and checks that it got the data it needs.
+ */
+static void panel_end_command()
+{
+    if (!has_command) {
+        return;
+    }
+
+    if (options.log) {
+        fprintf(options.log, "%12lld us  0x%02x %-28s", (long long) command_us, command, command_name(command));
+        if (command == 0x10 || command == 0x13) {
+            fprintf(options.log, " %lu bytes", (unsigned long) data_cursor);
+        } else {
+            for (uint32_t i = 0; i < param_count && i < PANEL_MAX_PARAMS; i++) {
+                fprintf(options.log, " %02x", params[i]);
+            }
+        }
+        fputc('\n', options.log);
+    }
+
+    if (command == 0x90 && param_count < 9) {
+        violation("partial window cut short");
+    }
+
+    has_command = false;
+}
+
+static void panel_set_window()
+{
+    uint16_t x_start = (params[0] << 8 | params[1]) & ~7;
+    uint16_t x_end = (params[2] << 8 | params[3]) | 7;
+    uint16_t y_start = params[4] << 8 | params[5];
+    uint16_t y_end = params[6] << 8 | params[7];
+
+    if (x_end >= DISPLAY_WIDTH || y_end >= DISPLAY_HEIGHT || x_start > x_end || y_start > y_end) {
+        violation("partial window outside the screen");
+        window = full_window;
+        return;
+    }
+
+    window = (panel_window) {
+        .x_byte = x_start / 8,
+        .y = y_start,
+        .width_bytes = (x_end + 1 - x_start) / 8,
+        .height = y_end + 1 - y_start,
+    };
+}
+
+static void panel_command(uint8_t value)
+{
+    panel_end_command();
+
+    if (deep_sleep) {
+        if (!woken_in_sleep) {
+            violation("command 0x%02x in deep sleep, ignored like everything up to a reset", value);
+            woken_in_sleep = true;
+        }
+        return;
+    }
+    if (panel_is_busy()) {
+        violation("command 0x%02x while BUSY_N is low", value);
+    }
+
+    has_command = true;
+    command = value;
+    command_us = esp_timer_get_time();
+    param_count = 0;
+    data_cursor = 0;
+    overflowed = false;
+    stats.commands++;
+
+    switch (command) {
+    case 0x02:
+        powered = false;
+        panel_busy(PANEL_POWER_OFF_MS);
+        break;
+    case 0x04:
+        powered = true;
+        panel_busy(PANEL_POWER_ON_MS);
+        break;
+    case 0x12:
+        panel_refresh();
+        break;
+    case 0x91:
+        partial_mode = true;
+        break;
+    case 0x92:
+        partial_mode = false;
+        break;
+    default:
+        break;
+    }
+}
+
+static void panel_image_data(const uint8_t* data, size_t length)
+{
+    uint8_t* ram = command == 0x10 ? bw_ram : red_ram;
+    const panel_window* area = partial_mode ? &window : &full_window;
+    uint32_t size = (uint32_t) area->width_bytes * area->height;
+
+    for (size_t i = 0; i < length; i++, data_cursor++) {
+        if (data_cursor >= size) {
+            if (!overflowed) {
+                violation("image data (0x%02x) past the end of the window", command);
+                overflowed = true;
+            }
+            continue;
+        }
+
+        uint32_t row = data_cursor / area->width_bytes;
+        uint32_t column = data_cursor % area->width_bytes;
+
+        ram[(area->y + row) * DISPLAY_STRIDE + area->x_byte + column] = data[i];
+    }
+}
+
+static void panel_data(const uint8_t* data, size_t length)
+{
+    if (deep_sleep) {
+        return;
+    }
+    if (!has_command) {
+        violation("data without a command (0x%02x)", data[0]);
+        return;
+    }
+
+    stats.data_bytes += length;
+
+    if (command == 0x10 || command == 0x13) {
+        panel_image_data(data, length);
+        return;
+    }
+
+    for (size_t i = 0; i < length; i++, param_count++) {
+        if (param_count < PANEL_MAX_PARAMS) {
+            params[param_count] = data[i];
+        }
+        if (command == 0x90 && param_count == 8) {
+            panel_set_window();
+        }
+        if (command == 0x07 && param_count == 0 && data[i] == 0xa5) {
+            panel_end_command();
+            deep_sleep = true;
+            woken_in_sleep = false;
+            stats.deep_sleeps++;
+        }
+    }
+}
+
+static void panel_spi(const uint8_t* data, size_t length, uint64_t levels, void* ctx)
+{
+    pthread_mutex_lock(&panel_lock);
+
+    if (levels & (1ULL << PANEL_CS_PIN)) {
+        violation("transfer with CS (GPIO %d) high", PANEL_CS_PIN);
+    } else if (reset_low) {
+        violation("transfer while RESET (GPIO %d) is low", PANEL_RESET_PIN);
+    } else if (levels & (1ULL << PANEL_DC_PIN)) {
+        panel_data(data, length);
+    } else {
+        for (size_t i = 0; i < length; i++) {
+            panel_command(data[i]);
+        }
+    }
+
+    pthread_mutex_unlock(&panel_lock);
+}
+
+/**
+ * A reset pulse wakes the controller from deep sleep with its registers at their defaults; RAM does not survive
+ * it and is scrambled, so refreshing an area that was not sent again shows up in the frames.
+ */
+static void panel_gpio(int pin, uint32_t level, void* ctx)
+{
+    if (pin != PANEL_RESET_PIN) {
+        return;
+    }
+
+    pthread_mutex_lock(&panel_lock);
+
+    if (!level) {
+        reset_low = true;
+    } else if (reset_low) {
+        reset_low = false;
+        panel_end_command();
+        deep_sleep = false;
+        powered = false;
+        partial_mode = false;
+        window = full_window;
+        for (size_t i = 0; i < DISPLAY_BUFFER_SIZE; i++) {
+            bw_ram[i] = (i / DISPLAY_STRIDE) & 1 ? 0xaa : 0x55;
+            red_ram[i] = 0;
+        }
+        stats.resets++;
+        if (options.log) {
+            fprintf(options.log, "%12lld us  reset\n", (long long) esp_timer_get_time());
+        }
+        panel_busy(PANEL_RESET_MS);
+    }
+
+    pthread_mutex_unlock(&panel_lock);
+}
+
+void panel_init(const panel_options* panel_options)
+{
+    options = *panel_options;
+    window = full_window;
+    memset(bw_screen, 0xff, sizeof(bw_screen));
+    memset(red_screen, 0, sizeof(red_screen));
+
+    sim_set_spi_handler(panel_spi, NULL);
+    sim_set_gpio_handler(panel_gpio, NULL);
+}
+
+/**
+ * Logs the command still being received.
+ */
+void panel_finish()
+{
+    pthread_mutex_lock(&panel_lock);
+    panel_end_command();
+    if (options.log) {
+        fflush(options.log);
+    }
+    pthread_mutex_unlock(&panel_lock);
+}
+
+void panel_get_stats(panel_stats* out)
+{
+    pthread_mutex_lock(&panel_lock);
+    *out = stats;
+    pthread_mutex_unlock(&panel_lock);
+}
+
+/**
+ * Copies what the screen shows into two DISPLAY_BUFFER_SIZE planes, in the controller's RAM polarity.
+ */
+void panel_get_screen(uint8_t* bw, uint8_t* red)
+{
+    pthread_mutex_lock(&panel_lock);
+    memcpy(bw, bw_screen, sizeof(bw_screen));
+    memcpy(red, red_screen, sizeof(red_screen));
+    pthread_mutex_unlock(&panel_lock);
+}
+
+/**
+ * Writes what the screen shows as a PPM.
+ */
+bool panel_save(const char* path)
+{
+    pthread_mutex_lock(&panel_lock);
+    bool saved = write_ppm(path, bw_screen, red_screen);
+    pthread_mutex_unlock(&panel_lock);
+
+    return saved;
+}
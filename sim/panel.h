@@ -0,0 +1,46 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifndef ___PANEL_H
+#define ___PANEL_H
+
+// Pins as epaper.c wires the controller
+#define PANEL_CS_PIN 5
+#define PANEL_DC_PIN 19
+#define PANEL_RESET_PIN 16
+#define PANEL_BUSY_PIN 4
+
+typedef struct panel_options {
+    // Where every refresh is written as frame-NNNN.ppm; NULL writes no frames
+    const char* dir;
+    // Also write the black/white and red RAM as frame-NNNN-black.pbm and frame-NNNN-red.pbm
+    bool planes;
+    // BUSY_N is held low for this fraction of the modeled time of each operation; 0 releases it at once
+    double busy_scale;
+    // Receives a line per command; may be NULL
+    FILE* log;
+} panel_options;
+
+typedef struct panel_stats {
+    uint32_t commands;
+    uint64_t data_bytes;
+    uint32_t resets;
+    uint32_t full_refreshes;
+    uint32_t partial_refreshes;
+    uint32_t deep_sleeps;
+    // Time the controller would have held BUSY_N low
+    uint64_t busy_us;
+    // Commands the controller would have ignored or misread, see the log
+    uint32_t violations;
+} panel_stats;
+
+void panel_init(const panel_options* options);
+void panel_finish();
+void panel_get_stats(panel_stats* stats);
+void panel_get_screen(uint8_t* bw, uint8_t* red);
+bool panel_save(const char* path);
+
+#endif
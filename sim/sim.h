@@ -0,0 +1,74 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_http_server.h"
+
+#ifndef ___SIM_H
+#define ___SIM_H
+
+/**
+ * Called with the bytes of every SPI transaction once it completes, together with the GPIO output levels
+ * (bit n = pin n) at the time it was started; queued transactions are read from their buffers only then.
+ */
+typedef void (*sim_spi_fn)(const uint8_t* data, size_t length, uint64_t levels, void* ctx);
+
+/**
+ * Called whenever firmware code drives an output pin.
+ */
+typedef void (*sim_gpio_fn)(int pin, uint32_t level, void* ctx);
+
+typedef struct sim_spi_stats {
+    uint32_t transactions;
+    uint64_t bytes;
+    // Time the transactions take on the wire at the device's clock speed
+    uint64_t wire_us;
+} sim_spi_stats;
+
+void sim_init();
+
+void sim_set_spi_handler(sim_spi_fn handler, void* ctx);
+void sim_set_gpio_handler(sim_gpio_fn handler, void* ctx);
+void sim_gpio_set_input(int pin, uint32_t level);
+void sim_get_spi_stats(sim_spi_stats* stats);
+
+void sim_wait_idle();
+
+/**
+ * Receives the complete response to a request; `headers` are "Name: value\r\n" lines.
+ */
+typedef void (*sim_response_fn)(const char* status, const char* headers, const uint8_t* body, size_t length,
+    void* ctx);
+
+/**
+ * A request to hand to the registered handlers. The first `length` bytes of the body are in `body`; the rest of
+ * its `content_length` bytes is read from `fd` when it is not negative.
+ */
+typedef struct sim_request {
+    httpd_method_t method;
+    const char* uri;
+    const char* content_type;
+    size_t content_length;
+    const uint8_t* body;
+    size_t length;
+    int fd;
+} sim_request;
+
+typedef struct sim_flash_stats {
+    uint32_t erases;
+    // Erases of the most erased sector
+    uint32_t max_sector_erases;
+    uint64_t bytes_written;
+    // Writes that would have had to set bits which were not erased
+    uint32_t violations;
+} sim_flash_stats;
+
+bool sim_flash_open(const char* path);
+void sim_flash_get_stats(sim_flash_stats* stats);
+
+bool sim_httpd_handle(const sim_request* request, sim_response_fn respond, void* ctx);
+bool sim_httpd_serve(uint16_t port, volatile bool* stop);
+
+#endif
@@ -0,0 +1,250 @@
+/**
+ * Runs the firmware's benchmark workloads (src/benchmark.h) on the host, with SPI mocked and no panel attached,
+ * and compares the results with a stored baseline.
+ *
+ *   epaper_benchmark [-t ms] [-j] [-o file] [-i file] [-b baseline [-r percent] [-w]]
+ *
+ *   -t ms       run each workload for at least this long (default BENCHMARK_MIN_TIME_MS)
+ *   -j          write JSON instead of CSV
+ *   -o file     write the results to file instead of stdout
+ *   -i file     read CSV results from file instead of running, e.g. those of GET /benchmark on the device
+ *   -b file     compare with the CSV baseline in file; exits with status 1 on a regression
+ *   -r percent  how much fewer ops/s still pass (default 20)
+ *   -w          write the results to the baseline file instead of comparing
+ *
+ * A workload regresses when its ops/s drop by more than the tolerance, or when it sends more SPI transactions or
+ * bytes or takes more heap than in the baseline: those do not depend on the machine and must not grow at all.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "esp_log.h"
+
+#include "benchmark.h"
+#include "epaper.h"
+#include "sim.h"
+
+// Workloads a results file may hold, including ones this build does not know
+#define SUITE_MAX_RESULTS 32
+#define SUITE_MAX_LINE 256
+#define SUITE_MAX_NAME 32
+
+typedef struct suite_results {
+    benchmark_result results[SUITE_MAX_RESULTS];
+    char names[SUITE_MAX_RESULTS][SUITE_MAX_NAME];
+    size_t count;
+} suite_results;
+
+static bool read_results(const char* path, suite_results* out)
+{
+    FILE* file = fopen(path, "r");
+    char line[SUITE_MAX_LINE];
+
+    if (!file) {
+        fprintf(stderr, "cannot read %s\n", path);
+        return false;
+    }
+
+    out->count = 0;
+
+    while (fgets(line, sizeof(line), file) && out->count < SUITE_MAX_RESULTS) {
+        benchmark_result* result = &out->results[out->count];
+        char* name = out->names[out->count];
+        unsigned long ops, transactions, bytes, heap;
+        unsigned long long elapsed_us;
+
+        // The header, and anything else that is not a result, does not parse
+        if (sscanf(line, "%31[^,],%lu,%llu,%lf,%lu,%lu,%lu", name, &ops, &elapsed_us, &result->ops_per_sec,
+                &transactions, &bytes, &heap) != 7) {
+            continue;
+        }
+
+        result->name = name;
+        result->ops = ops;
+        result->elapsed_us = elapsed_us;
+        result->spi_transactions = transactions;
+        result->spi_bytes = bytes;
+        result->peak_heap_bytes = heap;
+        out->count++;
+    }
+
+    fclose(file);
+
+    return true;
+}
+
+static bool write_results(const char* path, const suite_results* results, benchmark_format format)
+{
+    static char output[4096];
+    size_t length = benchmark_format_results(results->results, results->count, format, output, sizeof(output));
+    FILE* file = path ? fopen(path, "w") : stdout;
+
+    if (!file || length == 0 || fwrite(output, 1, length, file) != length) {
+        fprintf(stderr, "cannot write %s\n", path ? path : "the results");
+        if (file && file != stdout) {
+            fclose(file);
+        }
+        return false;
+    }
+
+    if (file != stdout) {
+        fclose(file);
+    }
+
+    return true;
+}
+
+static const benchmark_result* find_result(const suite_results* results, const char* name)
+{
+    for (size_t i = 0; i < results->count; i++) {
+        if (strcmp(results->results[i].name, name) == 0) {
+            return &results->results[i];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Prints the metric next to its baseline, unless it is one that does not depend on the machine and is unchanged.
+ */
+static bool compare_metric(const char* workload, const char* metric, double baseline, double now, bool regressed,
+    bool exact)
+{
+    double change = baseline != 0 ? (now - baseline) * 100 / baseline : 0;
+
+    if (!exact || now != baseline) {
+        fprintf(stderr, "%-12s %-17s %12.1f %12.1f %+7.1f%%%s\n", workload, metric, baseline, now, change,
+            regressed ? "  REGRESSION" : "");
+    }
+
+    return !regressed;
+}
+
+/**
+ * Prints every metric next to its baseline and returns false if any of them regressed.
+ */
+static bool compare_results(const suite_results* baseline, const suite_results* results, double tolerance)
+{
+    bool ok = true;
+
+    fprintf(stderr, "%-12s %-17s %12s %12s %8s\n", "workload", "metric", "baseline", "now", "change");
+
+    for (size_t i = 0; i < baseline->count; i++) {
+        const benchmark_result* before = &baseline->results[i];
+        const benchmark_result* now = find_result(results, before->name);
+
+        if (!now) {
+            fprintf(stderr, "%-12s missing  REGRESSION\n", before->name);
+            ok = false;
+            continue;
+        }
+
+        ok &= compare_metric(before->name, "ops_per_sec", before->ops_per_sec, now->ops_per_sec,
+            now->ops_per_sec < before->ops_per_sec * (1 - tolerance / 100), false);
+        ok &= compare_metric(before->name, "spi_transactions", before->spi_transactions, now->spi_transactions,
+            now->spi_transactions > before->spi_transactions, true);
+        ok &= compare_metric(before->name, "spi_bytes", before->spi_bytes, now->spi_bytes,
+            now->spi_bytes > before->spi_bytes, true);
+        ok &= compare_metric(before->name, "peak_heap_bytes", before->peak_heap_bytes, now->peak_heap_bytes,
+            now->peak_heap_bytes > before->peak_heap_bytes, true);
+    }
+
+    for (size_t i = 0; i < results->count; i++) {
+        if (!find_result(baseline, results->results[i].name)) {
+            fprintf(stderr, "%-12s not in the baseline\n", results->results[i].name);
+        }
+    }
+
+    return ok;
+}
+
+static void usage()
+{
+    fprintf(stderr, "usage: epaper_benchmark [-t ms] [-j] [-o file] [-i file] [-b baseline [-r percent] [-w]]\n");
+    exit(2);
+}
+
+int main(int argc, char** argv)
+{
+    static suite_results results;
+    static suite_results baseline;
+    uint32_t min_time_ms = BENCHMARK_MIN_TIME_MS;
+    benchmark_format format = BENCHMARK_FORMAT_CSV;
+    const char* output_path = NULL;
+    const char* input_path = NULL;
+    const char* baseline_path = NULL;
+    double tolerance = 20;
+    bool write_baseline = false;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "t:jo:i:b:r:w")) != -1) {
+        switch (opt) {
+        case 't':
+            min_time_ms = atoi(optarg);
+            break;
+        case 'j':
+            format = BENCHMARK_FORMAT_JSON;
+            break;
+        case 'o':
+            output_path = optarg;
+            break;
+        case 'i':
+            input_path = optarg;
+            break;
+        case 'b':
+            baseline_path = optarg;
+            break;
+        case 'r':
+            tolerance = atof(optarg);
+            break;
+        case 'w':
+            write_baseline = true;
+            break;
+        default:
+            usage();
+        }
+    }
+
+    if (optind != argc || (write_baseline && !baseline_path)) {
+        usage();
+    }
+
+    if (input_path) {
+        if (!read_results(input_path, &results)) {
+            return 2;
+        }
+    } else {
+        sim_init();
+        sim_log_level = ESP_LOG_WARN;
+        epaper_setup();
+
+        results.count = benchmark_run(min_time_ms, results.results, SUITE_MAX_RESULTS);
+        if (results.count == 0) {
+            fprintf(stderr, "the benchmark is not part of this build\n");
+            return 2;
+        }
+    }
+
+    if (write_baseline) {
+        return write_results(baseline_path, &results, BENCHMARK_FORMAT_CSV) ? 0 : 2;
+    }
+
+    if (!input_path || output_path) {
+        if (!write_results(output_path, &results, format)) {
+            return 2;
+        }
+    }
+
+    if (!baseline_path) {
+        return 0;
+    }
+
+    if (!read_results(baseline_path, &baseline)) {
+        return 2;
+    }
+
+    return compare_results(&baseline, &results, tolerance) ? 0 : 1;
+}
@@ -0,0 +1,702 @@
+/**
+ * Host tests of the firmware's modules, against the simulated panel with BUSY_N released at once.
+ *
+ *   epaper_tests [test ...]
+ *
+ * Runs the named tests, or all of them, and exits with status 1 when a check fails.
+ */
+#include <stdio.h>
+#include <string.h>
+
+#include "esp_log.h"
+#include "esp_partition.h"
+
+#include "damage.h"
+#include "display.h"
+#include "epaper.h"
+#include "font.h"
+#include "http.h"
+#include "panel.h"
+#include "power.h"
+#include "sim.h"
+#include "slots.h"
+
+typedef struct test_case {
+    const char* name;
+    void (*run)();
+} test_case;
+
+static const char* current_test;
+static unsigned failures;
+
+#define CHECK(condition)                                                                                        \
+    do {                                                                                                        \
+        if (!(condition)) {                                                                                     \
+            printf("%s: %s:%d: %s\n", current_test, __FILE__, __LINE__, #condition);                            \
+            failures++;                                                                                         \
+        }                                                                                                       \
+    } while (0)
+
+static bool has_rect(const DamageList* list, uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+    for (uint8_t i = 0; i < list->count; i++) {
+        const Rect* rect = &list->rects[i];
+
+        if (rect->x == x && rect->y == y && rect->w == w && rect->h == h) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Checks that the damage list holds exactly this one rectangle.
+ */
+#define CHECK_DAMAGE(x, y, w, h)                                                                                \
+    do {                                                                                                        \
+        CHECK(epaper_get_damage()->count == 1);                                                                 \
+        CHECK(has_rect(epaper_get_damage(), x, y, w, h));                                                       \
+    } while (0)
+
+static void damage_start()
+{
+    epaper_clear();
+    epaper_reset_damage();
+}
+
+static void test_damage_text()
+{
+    const Font* font = &font_ubuntu_mono_16x24;
+    uint16_t width = font_get_glyph(font, 'H')->advance + font_get_glyph(font, 'i')->advance;
+
+    damage_start();
+    epaper_draw_text(10, 20, "Hi", &font_ubuntu_mono_16x24, COLOR_BLACK);
+    CHECK_DAMAGE(10, 20, width, font->line_height);
+
+    // Clipped at the right edge like the glyphs
+    damage_start();
+    epaper_draw_text(DISPLAY_WIDTH - 8, 0, "Hi", &font_ubuntu_mono_16x24, COLOR_RED);
+    CHECK_DAMAGE(DISPLAY_WIDTH - 8, 0, 8, font->line_height);
+
+    damage_start();
+    epaper_draw_text(10, 20, "", &font_ubuntu_mono_16x24, COLOR_BLACK);
+    CHECK(damage_is_empty(epaper_get_damage()));
+}
+
+static void test_damage_line()
+{
+    damage_start();
+    epaper_draw_line(5, 5, 50, 30, COLOR_BLACK);
+    CHECK_DAMAGE(5, 5, 46, 26);
+
+    damage_start();
+    epaper_draw_line(50, 30, 5, 5, COLOR_BLACK);
+    CHECK_DAMAGE(5, 5, 46, 26);
+
+    damage_start();
+    epaper_draw_line(0, 100, DISPLAY_WIDTH - 1, 100, COLOR_RED);
+    CHECK_DAMAGE(0, 100, DISPLAY_WIDTH, 1);
+}
+
+static void test_damage_fill_rect()
+{
+    damage_start();
+    epaper_fill_rect(100, 100, 50, 40, COLOR_BLACK);
+    CHECK_DAMAGE(100, 100, 50, 40);
+
+    damage_start();
+    epaper_fill_rect(DISPLAY_WIDTH - 20, DISPLAY_HEIGHT - 10, 50, 40, COLOR_RED);
+    CHECK_DAMAGE(DISPLAY_WIDTH - 20, DISPLAY_HEIGHT - 10, 20, 10);
+
+    damage_start();
+    epaper_fill_rect(DISPLAY_WIDTH, 0, 10, 10, COLOR_BLACK);
+    epaper_fill_rect(10, 10, 0, 10, COLOR_BLACK);
+    CHECK(damage_is_empty(epaper_get_damage()));
+}
+
+static void test_damage_bitmap()
+{
+    static const uint8_t bitmap[] = { 0xff, 0xf0, 0x80, 0x10 };
+
+    damage_start();
+    epaper_draw_bitmap(16, 8, 12, 2, bitmap, COLOR_BLACK);
+    CHECK_DAMAGE(16, 8, 12, 2);
+
+    // Not byte aligned, and clipped at the bottom right corner
+    damage_start();
+    epaper_draw_bitmap(DISPLAY_WIDTH - 5, DISPLAY_HEIGHT - 1, 12, 2, bitmap, COLOR_RED);
+    CHECK_DAMAGE(DISPLAY_WIDTH - 5, DISPLAY_HEIGHT - 1, 5, 1);
+}
+
+static void test_damage_clear()
+{
+    damage_start();
+    epaper_fill_rect(100, 100, 50, 40, COLOR_BLACK);
+    epaper_clear();
+    CHECK_DAMAGE(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+}
+
+static void test_damage_merge()
+{
+    damage_start();
+    epaper_fill_rect(0, 0, 10, 10, COLOR_BLACK);
+    epaper_fill_rect(100, 0, 10, 10, COLOR_BLACK);
+    CHECK(epaper_get_damage()->count == 2);
+    CHECK(has_rect(epaper_get_damage(), 0, 0, 10, 10));
+    CHECK(has_rect(epaper_get_damage(), 100, 0, 10, 10));
+
+    // Sharing an edge with the first merges them, and the grown rectangle then overlaps the second
+    epaper_draw_line(10, 5, 100, 5, COLOR_BLACK);
+    CHECK_DAMAGE(0, 0, 110, 10);
+
+    // Inside what is damaged already
+    epaper_fill_rect(20, 2, 5, 5, COLOR_RED);
+    CHECK_DAMAGE(0, 0, 110, 10);
+}
+
+static void test_damage_overflow()
+{
+    damage_start();
+    epaper_set_damage_limit(2);
+    epaper_fill_rect(0, 0, 10, 10, COLOR_BLACK);
+    epaper_fill_rect(100, 0, 10, 10, COLOR_BLACK);
+    epaper_fill_rect(700, 400, 10, 10, COLOR_BLACK);
+
+    // The third one merges with the rectangle whose union grows the least
+    CHECK(epaper_get_damage()->count == 2);
+    CHECK(has_rect(epaper_get_damage(), 0, 0, 10, 10));
+    CHECK(has_rect(epaper_get_damage(), 100, 0, 610, 410));
+
+    // Lowering the limit merges what is over it
+    epaper_set_damage_limit(1);
+    CHECK_DAMAGE(0, 0, 710, 410);
+
+    damage_start();
+    epaper_set_pixel(0, 0, COLOR_BLACK);
+    epaper_set_pixel(DISPLAY_WIDTH - 1, DISPLAY_HEIGHT - 1, COLOR_BLACK);
+    CHECK_DAMAGE(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+
+    epaper_set_damage_limit(DAMAGE_MAX_RECTS);
+    damage_start();
+    for (uint16_t i = 0; i <= DAMAGE_MAX_RECTS; i++) {
+        epaper_fill_rect(i * 20, i * 20, 10, 10, COLOR_BLACK);
+    }
+    CHECK(epaper_get_damage()->count == DAMAGE_MAX_RECTS);
+    CHECK(has_rect(epaper_get_damage(), (DAMAGE_MAX_RECTS - 1) * 20, (DAMAGE_MAX_RECTS - 1) * 20, 30, 30));
+
+    epaper_set_damage_limit(EPAPER_DAMAGE_LIMIT);
+}
+
+/**
+ * Whether the panel shows the black/white plane of the framebuffer, on a white screen.
+ */
+static bool panel_shows_frame()
+{
+    static uint8_t bw[DISPLAY_BUFFER_SIZE];
+    static uint8_t red[DISPLAY_BUFFER_SIZE];
+
+    panel_get_screen(bw, red);
+
+    return memcmp(bw, epaper_get_buffer(), DISPLAY_BUFFER_SIZE) == 0;
+}
+
+static void test_refresh_outside_damage()
+{
+    uint8_t* buffer = epaper_get_buffer();
+
+    epaper_clear_screen();
+    epaper_fill_rect(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT, COLOR_BLACK);
+    epaper_clear_screen();
+    CHECK(panel_shows_frame());
+
+    // Written behind the drawing API's back: away from the damage, and in the damaged rows next to it
+    epaper_fill_rect(100, 100, 40, 40, COLOR_BLACK);
+    buffer[300 * DISPLAY_STRIDE + 50] = 0x00;
+    buffer[120 * DISPLAY_STRIDE + 70] = 0x0f;
+    epaper_refresh_damage();
+    CHECK(panel_shows_frame());
+
+    epaper_refresh_damage();
+    CHECK(panel_shows_frame());
+}
+
+/**
+ * Whether the panel shows the red plane of the framebuffer; the controller's red RAM is 1 = red.
+ */
+static bool panel_shows_red()
+{
+    static uint8_t bw[DISPLAY_BUFFER_SIZE];
+    static uint8_t red[DISPLAY_BUFFER_SIZE];
+    const uint8_t* frame = epaper_get_red_buffer();
+
+    panel_get_screen(bw, red);
+
+    for (size_t i = 0; i < DISPLAY_BUFFER_SIZE; i++) {
+        if (red[i] != (frame ? (uint8_t) ~frame[i] : 0)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void test_red_dirty()
+{
+    epaper_refresh_stats before, after;
+
+    epaper_clear_screen();
+    epaper_fill_rect(10, 10, 20, 20, COLOR_RED);
+    epaper_refresh_damage();
+    CHECK(panel_shows_red());
+
+    // Black drawing away from the red pixels leaves the red plane alone: drawing the same again changes nothing
+    epaper_fill_rect(400, 300, 10, 10, COLOR_BLACK);
+    epaper_draw_line(400, 200, 500, 250, COLOR_BLACK);
+    epaper_refresh_damage();
+    epaper_get_refresh_stats(&before);
+    epaper_fill_rect(400, 300, 10, 10, COLOR_BLACK);
+    epaper_draw_line(400, 200, 500, 250, COLOR_BLACK);
+    epaper_refresh_damage();
+    epaper_get_refresh_stats(&after);
+    CHECK(after.skipped == before.skipped + 1);
+
+    // Over them it clears red, which the frame diff does not see
+    epaper_draw_line(0, 20, 100, 20, COLOR_BLACK);
+    epaper_refresh_damage();
+    epaper_get_refresh_stats(&before);
+    CHECK(before.partial == after.partial + 1);
+    CHECK(panel_shows_red());
+    CHECK(panel_shows_frame());
+}
+
+static void test_snapshot()
+{
+    static uint8_t expected[DISPLAY_BUFFER_SIZE];
+    epaper_snapshot snapshot;
+
+    epaper_clear_screen();
+    epaper_fill_rect(10, 10, 20, 20, COLOR_RED);
+    epaper_draw_text(50, 50, "kept", &font_ubuntu_mono_16x24, COLOR_BLACK);
+    epaper_refresh_damage();
+
+    // Drawn but not refreshed yet when the snapshot is taken
+    epaper_fill_rect(200, 200, 30, 30, COLOR_BLACK);
+    memcpy(expected, epaper_get_buffer(), DISPLAY_BUFFER_SIZE);
+
+    CHECK(epaper_snapshot_take(&snapshot));
+    epaper_draw_dummy();
+    epaper_fill_rect(600, 10, 40, 40, COLOR_RED);
+    epaper_transmit_frame();
+    epaper_snapshot_restore(&snapshot);
+
+    CHECK(memcmp(epaper_get_buffer(), expected, DISPLAY_BUFFER_SIZE) == 0);
+    CHECK_DAMAGE(200, 200, 30, 30);
+
+    epaper_refresh_damage();
+    CHECK(panel_shows_frame());
+    CHECK(panel_shows_red());
+}
+
+/**
+ * Damages the byte at `data` in the mapped "frames" partition the way worn flash does, by clearing its bits.
+ */
+static void slots_damage(const uint8_t* data)
+{
+    const esp_partition_t* partition
+        = esp_partition_find_first(SLOTS_PARTITION_TYPE, SLOTS_PARTITION_SUBTYPE, SLOTS_PARTITION_LABEL);
+    esp_partition_mmap_handle_t handle;
+    const void* mapped;
+    const uint8_t zero = 0;
+
+    esp_partition_mmap(partition, 0, partition->size, ESP_PARTITION_MMAP_DATA, &mapped, &handle);
+    esp_partition_write(partition, data - (const uint8_t*) mapped, &zero, 1);
+    esp_partition_munmap(handle);
+}
+
+static void test_slots_damaged_copy()
+{
+    static uint8_t plane[64];
+    slot_image image = { .black = plane, .plane_size = sizeof(plane) };
+    slot_image loaded;
+    slots_stats before, after;
+
+    CHECK(slots_init());
+    memset(plane, 0xff, sizeof(plane));
+    plane[0] = 0x0f;
+    CHECK(slots_save("damaged", &image));
+    plane[0] = 0xf0;
+    CHECK(slots_save("damaged", &image));
+    CHECK(slots_load("damaged", &loaded) && loaded.black[0] == 0xf0);
+
+    // The copy saved before the damaged one is the slot's content then
+    slots_get_stats(&before);
+    slots_damage(loaded.black + 1);
+    CHECK(slots_load("damaged", &loaded) && loaded.black[0] == 0x0f);
+    slots_get_stats(&after);
+    CHECK(after.loads == before.loads + 1);
+    CHECK(after.failures == before.failures);
+
+    // A save goes over the damaged copy and keeps the intact one, in case it is cut short
+    plane[0] = 0x3c;
+    CHECK(slots_save("damaged", &image));
+    CHECK(slots_load("damaged", &loaded) && loaded.black[0] == 0x3c);
+    slots_damage(loaded.black + 1);
+    CHECK(slots_load("damaged", &loaded) && loaded.black[0] == 0x0f);
+    slots_get_stats(&after);
+
+    slots_damage(loaded.black + 1);
+    CHECK(!slots_load("damaged", &loaded));
+    slots_get_stats(&before);
+    CHECK(before.failures == after.failures + 1);
+
+    // A save over a damaged slot makes it whole again
+    CHECK(slots_save("damaged", &image));
+    CHECK(slots_load("damaged", &loaded) && loaded.black[0] == 0x3c);
+    CHECK(slots_delete("damaged"));
+}
+
+/**
+ * Controller steps for the power machine that count their calls and fail on request, on a clock that only moves
+ * when told to.
+ */
+typedef struct fake_controller {
+    uint32_t calls[POWER_TRANSITION_COUNT];
+    bool fail[POWER_TRANSITION_COUNT];
+    int64_t now_us;
+} fake_controller;
+
+static bool fake_step(fake_controller* fake, power_transition transition)
+{
+    fake->calls[transition]++;
+    fake->now_us += 100;
+
+    return !fake->fail[transition];
+}
+
+// Init and wake run the same step; their calls are counted together under init
+static bool fake_init(void* ctx)
+{
+    return fake_step(ctx, POWER_TRANSITION_INIT);
+}
+
+static bool fake_power_on(void* ctx)
+{
+    return fake_step(ctx, POWER_TRANSITION_POWER_ON);
+}
+
+static bool fake_power_off(void* ctx)
+{
+    return fake_step(ctx, POWER_TRANSITION_POWER_OFF);
+}
+
+static bool fake_deep_sleep(void* ctx)
+{
+    return fake_step(ctx, POWER_TRANSITION_DEEP_SLEEP);
+}
+
+static int64_t fake_now_us(void* ctx)
+{
+    return ((fake_controller*) ctx)->now_us;
+}
+
+static void fake_setup(power_machine* machine, power_ops* ops, fake_controller* fake, uint32_t idle_timeout_ms)
+{
+    *fake = (fake_controller) { .now_us = 1000000 };
+    *ops = (power_ops) {
+        .init = fake_init,
+        .power_on = fake_power_on,
+        .power_off = fake_power_off,
+        .deep_sleep = fake_deep_sleep,
+        .now_us = fake_now_us,
+        .ctx = fake,
+    };
+    power_init(machine, ops, idle_timeout_ms);
+}
+
+static void test_power_transitions()
+{
+    power_machine machine;
+    power_ops ops;
+    fake_controller fake;
+    power_stats stats;
+
+    fake_setup(&machine, &ops, &fake, 1000);
+
+    // Nothing happens until the controller is first needed
+    CHECK(machine.state == POWER_STATE_OFF);
+    CHECK(fake.calls[POWER_TRANSITION_INIT] == 0);
+    CHECK(power_idle_remaining_ms(&machine) == POWER_IDLE_NEVER);
+    CHECK(!power_sleep(&machine));
+
+    CHECK(power_require(&machine, POWER_STATE_INITIALIZED));
+    CHECK(machine.state == POWER_STATE_POWERED);
+    CHECK(fake.calls[POWER_TRANSITION_INIT] == 1);
+    CHECK(power_require(&machine, POWER_STATE_POWERED));
+    CHECK(fake.calls[POWER_TRANSITION_INIT] == 1);
+
+    CHECK(power_release(&machine));
+    CHECK(machine.state == POWER_STATE_INITIALIZED);
+    CHECK(power_release(&machine));
+    CHECK(fake.calls[POWER_TRANSITION_POWER_OFF] == 1);
+
+    // Image data needs no charge pump, a refresh does
+    CHECK(power_require(&machine, POWER_STATE_INITIALIZED));
+    CHECK(fake.calls[POWER_TRANSITION_POWER_ON] == 0);
+    CHECK(power_require(&machine, POWER_STATE_POWERED));
+    CHECK(machine.state == POWER_STATE_POWERED);
+    CHECK(fake.calls[POWER_TRANSITION_POWER_ON] == 1);
+
+    CHECK(power_sleep(&machine));
+    CHECK(machine.state == POWER_STATE_DEEP_SLEEP);
+    CHECK(fake.calls[POWER_TRANSITION_POWER_OFF] == 2);
+    CHECK(fake.calls[POWER_TRANSITION_DEEP_SLEEP] == 1);
+    CHECK(!power_sleep(&machine));
+    CHECK(!power_require(&machine, POWER_STATE_DEEP_SLEEP));
+
+    CHECK(power_require(&machine, POWER_STATE_INITIALIZED));
+    CHECK(machine.state == POWER_STATE_POWERED);
+    CHECK(fake.calls[POWER_TRANSITION_INIT] == 2);
+
+    power_get_stats(&machine, &stats);
+    CHECK(stats.state == POWER_STATE_POWERED);
+    CHECK(stats.transitions[POWER_TRANSITION_INIT].count == 1);
+    CHECK(stats.transitions[POWER_TRANSITION_WAKE].count == 1);
+    CHECK(stats.transitions[POWER_TRANSITION_POWER_ON].count == 1);
+    CHECK(stats.transitions[POWER_TRANSITION_POWER_OFF].count == 2);
+    CHECK(stats.transitions[POWER_TRANSITION_DEEP_SLEEP].count == 1);
+    CHECK(stats.transitions[POWER_TRANSITION_WAKE].last_us == 100);
+    CHECK(stats.transitions[POWER_TRANSITION_POWER_OFF].total_us == 200);
+}
+
+static void test_power_idle_timeout()
+{
+    power_machine machine;
+    power_ops ops;
+    fake_controller fake;
+
+    fake_setup(&machine, &ops, &fake, 1000);
+    CHECK(power_require(&machine, POWER_STATE_POWERED));
+    CHECK(power_release(&machine));
+
+    // The timeout runs from the last use, not from the release
+    fake.now_us += 999000;
+    CHECK(power_idle_remaining_ms(&machine) == 1);
+    CHECK(!power_sleep_if_idle(&machine));
+    power_touch(&machine);
+    fake.now_us += 999000;
+    CHECK(!power_sleep_if_idle(&machine));
+    fake.now_us += 1000;
+    CHECK(power_idle_remaining_ms(&machine) == 0);
+    CHECK(power_sleep_if_idle(&machine));
+    CHECK(machine.state == POWER_STATE_DEEP_SLEEP);
+    CHECK(fake.calls[POWER_TRANSITION_POWER_OFF] == 1);
+    CHECK(power_idle_remaining_ms(&machine) == POWER_IDLE_NEVER);
+
+    power_set_idle_timeout(&machine, POWER_IDLE_NEVER);
+    CHECK(power_require(&machine, POWER_STATE_POWERED));
+    fake.now_us += 3600 * 1000000LL;
+    CHECK(power_idle_remaining_ms(&machine) == POWER_IDLE_NEVER);
+    CHECK(!power_sleep_if_idle(&machine));
+
+    power_set_idle_timeout(&machine, 0);
+    CHECK(power_sleep_if_idle(&machine));
+}
+
+static void test_power_failures()
+{
+    power_machine machine;
+    power_ops ops;
+    fake_controller fake;
+    power_stats stats;
+
+    fake_setup(&machine, &ops, &fake, 1000);
+
+    fake.fail[POWER_TRANSITION_INIT] = true;
+    CHECK(!power_require(&machine, POWER_STATE_POWERED));
+    CHECK(machine.state == POWER_STATE_OFF);
+    fake.fail[POWER_TRANSITION_INIT] = false;
+    CHECK(power_require(&machine, POWER_STATE_POWERED));
+
+    // A step that fails leaves the state unknown: the next use starts over with a reset
+    CHECK(power_release(&machine));
+    fake.fail[POWER_TRANSITION_POWER_ON] = true;
+    CHECK(!power_require(&machine, POWER_STATE_POWERED));
+    CHECK(machine.state == POWER_STATE_OFF);
+    CHECK(power_require(&machine, POWER_STATE_POWERED));
+    CHECK(fake.calls[POWER_TRANSITION_POWER_ON] == 1);
+    CHECK(fake.calls[POWER_TRANSITION_INIT] == 3);
+
+    fake.fail[POWER_TRANSITION_POWER_OFF] = true;
+    CHECK(!power_release(&machine));
+    CHECK(machine.state == POWER_STATE_OFF);
+    fake.fail[POWER_TRANSITION_POWER_OFF] = false;
+
+    fake.fail[POWER_TRANSITION_DEEP_SLEEP] = true;
+    CHECK(power_require(&machine, POWER_STATE_POWERED));
+    CHECK(!power_sleep(&machine));
+    CHECK(machine.state == POWER_STATE_OFF);
+    CHECK(power_idle_remaining_ms(&machine) == POWER_IDLE_NEVER);
+
+    power_get_stats(&machine, &stats);
+    CHECK(stats.transitions[POWER_TRANSITION_INIT].failures == 1);
+    CHECK(stats.transitions[POWER_TRANSITION_POWER_ON].failures == 1);
+    CHECK(stats.transitions[POWER_TRANSITION_POWER_OFF].failures == 1);
+    CHECK(stats.transitions[POWER_TRANSITION_DEEP_SLEEP].failures == 1);
+}
+
+/**
+ * The same on the simulated panel: a refresh after deep sleep wakes the controller, and one shortly after only
+ * switches the charge pump on again.
+ */
+static void test_power_epaper()
+{
+    power_stats before, after;
+    panel_stats panel;
+
+    epaper_deep_sleep();
+    epaper_get_power_stats(&before);
+    CHECK(before.state == POWER_STATE_DEEP_SLEEP);
+
+    epaper_fill_rect(300, 300, 16, 16, COLOR_BLACK);
+    epaper_refresh_damage();
+    epaper_get_power_stats(&after);
+    CHECK(after.transitions[POWER_TRANSITION_WAKE].count == before.transitions[POWER_TRANSITION_WAKE].count + 1);
+    CHECK(after.state == (EPAPER_POWER_OFF_AFTER_REFRESH ? POWER_STATE_INITIALIZED : POWER_STATE_POWERED));
+
+    epaper_fill_rect(340, 300, 16, 16, COLOR_BLACK);
+    epaper_refresh_damage();
+    epaper_get_power_stats(&before);
+    CHECK(before.transitions[POWER_TRANSITION_WAKE].count == after.transitions[POWER_TRANSITION_WAKE].count);
+    CHECK(before.transitions[POWER_TRANSITION_POWER_ON].count
+        == after.transitions[POWER_TRANSITION_POWER_ON].count + EPAPER_POWER_OFF_AFTER_REFRESH);
+    CHECK(panel_shows_frame());
+
+    panel_get_stats(&panel);
+    CHECK(panel.violations == 0);
+}
+
+static void ignore_response(const char* status, const char* headers, const uint8_t* body, size_t length, void* ctx)
+{
+}
+
+static bool framebuffer_black(uint16_t x, uint16_t y)
+{
+    return !(epaper_get_buffer()[y * (DISPLAY_WIDTH / 8) + x / 8] & (0x80 >> (x % 8)));
+}
+
+/**
+ * A frame uploaded with POST /framebuffer is not in the display list; replacing or removing an item over it must
+ * not wipe it. Starts the display task, so it has to be the last test.
+ */
+static void test_display_unlisted()
+{
+    static uint8_t frame[64 / 8 * 48];
+    sim_request upload = {
+        .method = HTTP_POST,
+        .uri = "/framebuffer?x=400&y=200&w=64&h=48&refresh=0",
+        .content_type = "application/octet-stream",
+        .content_length = sizeof(frame),
+        .body = frame,
+        .length = sizeof(frame),
+        .fd = -1,
+    };
+    display_command line = {
+        .type = DISPLAY_CMD_DRAW_LINE, .id = 7, .x = 400, .y = 210, .x2 = 463, .y2 = 230, .color = COLOR_BLACK
+    };
+    display_command away = {
+        .type = DISPLAY_CMD_DRAW_LINE, .id = 8, .x = 10, .y = 10, .x2 = 100, .y2 = 10, .color = COLOR_BLACK
+    };
+    display_command removal = { .type = DISPLAY_CMD_REMOVE, .id = 7 };
+    display_command clear = { .type = DISPLAY_CMD_CLEAR };
+
+    display_create_task(NULL);
+    http_server_init();
+    sim_wait_idle();
+    CHECK(display_wait(display_submit(&clear), 10000));
+
+    memset(frame, 0x00, sizeof(frame));
+    CHECK(sim_httpd_handle(&upload, ignore_response, NULL));
+    CHECK(display_wait(display_submit(&line), 10000));
+    CHECK(display_wait(display_submit(&away), 10000));
+
+    line.y = line.y2 = 240;
+    away.y = away.y2 = 20;
+    CHECK(display_wait(display_submit(&line), 10000));
+    CHECK(display_wait(display_submit(&away), 10000));
+
+    CHECK(display_lock_framebuffer(10000));
+    CHECK(framebuffer_black(401, 225));
+    CHECK(framebuffer_black(460, 212));
+    CHECK(!framebuffer_black(399, 225));
+    // Away from the upload, items are still redrawn in place
+    CHECK(!framebuffer_black(50, 10));
+    CHECK(framebuffer_black(50, 20));
+    display_unlock_framebuffer();
+
+    CHECK(display_wait(display_submit(&removal), 10000));
+    CHECK(display_lock_framebuffer(10000));
+    CHECK(framebuffer_black(401, 225));
+    CHECK(framebuffer_black(430, 240));
+    CHECK(panel_shows_frame());
+    display_unlock_framebuffer();
+}
+
+static const test_case tests[] = {
+    { "damage_text", test_damage_text },
+    { "damage_line", test_damage_line },
+    { "damage_fill_rect", test_damage_fill_rect },
+    { "damage_bitmap", test_damage_bitmap },
+    { "damage_clear", test_damage_clear },
+    { "damage_merge", test_damage_merge },
+    { "damage_overflow", test_damage_overflow },
+    { "refresh_outside_damage", test_refresh_outside_damage },
+    { "red_dirty", test_red_dirty },
+    { "snapshot", test_snapshot },
+    { "power_transitions", test_power_transitions },
+    { "power_idle_timeout", test_power_idle_timeout },
+    { "power_failures", test_power_failures },
+    { "power_epaper", test_power_epaper },
+    { "slots_damaged_copy", test_slots_damaged_copy },
+    { "display_unlisted", test_display_unlisted },
+};
+
+static bool selected(const char* name, int argc, char** argv)
+{
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], name) == 0) {
+            return true;
+        }
+    }
+
+    return argc == 1;
+}
+
+int main(int argc, char** argv)
+{
+    unsigned run = 0;
+
+    panel_options options = { 0 };
+
+    sim_init();
+    sim_log_level = ESP_LOG_WARN;
+    panel_init(&options);
+    epaper_setup();
+
+    for (size_t i = 0; i < sizeof(tests) / sizeof(tests[0]); i++) {
+        unsigned before = failures;
+
+        if (!selected(tests[i].name, argc, argv)) {
+            continue;
+        }
+
+        current_test = tests[i].name;
+        tests[i].run();
+        run++;
+        printf("%-24s %s\n", tests[i].name, failures == before ? "ok" : "FAILED");
+    }
+
+    printf("%u test(s), %u failed check(s)\n", run, failures);
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,200 @@
+#include <string.h>
+#include <sys/param.h>
+
+#include "band.h"
+#include "epaper.h"
+#include "font.h"
+#include "layout.h"
+
+// Rows of the dummy pattern before its two phases swap
+#define BAND_DUMMY_PHASE_ROWS 11
+
+typedef struct band_text_box {
+    const Raster* band;
+    const Font* font;
+    const Glyph* ellipsis;
+    uint8_t ellipsis_count;
+    bool ink;
+} band_text_box;
+
+/**
+ * Returns 0 where `color` puts ink on `plane` and 1 (white) where it leaves the plane clear. Red is white on
+ * the black/white plane and the only ink on the red plane.
+ */
+static inline uint8_t band_value(uint8_t color, uint8_t plane)
+{
+    if (plane == EPAPER_PLANE_RED) {
+        return color != COLOR_RED;
+    }
+
+    return color != COLOR_BLACK;
+}
+
+static inline bool band_holds_rows(const Raster* band, uint16_t y, uint16_t h)
+{
+    return y < band->top + band->height && y + h > band->top;
+}
+
+/**
+ * Draws a run of glyphs where the text is ink on this plane, and only clears its cells where it is not.
+ */
+static uint32_t band_draw_glyphs(const Raster* band, uint32_t x, uint16_t y, const char* text, const char* end,
+    const Font* font, bool ink)
+{
+    if (ink) {
+        return raster_draw_glyphs(band, x, y, text, end, font);
+    }
+
+    uint32_t width = layout_measure(font, text, end - text);
+
+    if (x < band->width) {
+        raster_fill_rect(band, x, y, MIN(width, band->width - x), font->line_height, 1);
+    }
+
+    return x + width;
+}
+
+static void band_draw_layout_line(const LayoutLine* line, void* ctx)
+{
+    const band_text_box* box = ctx;
+    const Font* font = box->font;
+
+    if (!band_holds_rows(box->band, line->y, font->line_height)) {
+        return;
+    }
+
+    uint32_t x = band_draw_glyphs(box->band, line->x, line->y, line->text, line->text + line->length, font, box->ink);
+
+    for (uint8_t i = 0; line->ellipsis && i < box->ellipsis_count && x < box->band->width; i++) {
+        if (box->ink) {
+            raster_draw_glyph(box->band, x, line->y, font, box->ellipsis);
+        } else {
+            raster_fill_rect(box->band, x, line->y, MIN(box->ellipsis->advance, box->band->width - x),
+                font->line_height, 1);
+        }
+        x += box->ellipsis->advance;
+    }
+}
+
+static void band_draw_text_box(const Raster* band, const DisplayItem* item, const char* text, const Font* font,
+    bool ink)
+{
+    Rect box = {
+        .x = item->x, .y = item->y, .w = MIN(item->width, DISPLAY_WIDTH - MIN(item->x, DISPLAY_WIDTH)),
+        .h = item->height
+    };
+    band_text_box ctx = { .band = band, .font = font, .ink = ink };
+    Rect used;
+
+    if (!band_holds_rows(band, box.y, box.h)) {
+        return;
+    }
+
+    ctx.ellipsis = layout_ellipsis_glyph(font, &ctx.ellipsis_count);
+    layout_text(font, text, &box, &item->layout, band_draw_layout_line, &ctx, &used);
+}
+
+/**
+ * Draws the test screen: a few lines of text, a line and a striped pattern over the right part of the screen.
+ */
+void band_draw_dummy(const Raster* raster)
+{
+    const Font* font = &font_jetbrains_mono_16x24;
+    static const struct {
+        uint16_t x;
+        uint16_t y;
+        const char* text;
+    } lines[] = {
+        { 20, 20, "Hello, world!" },
+        { 20, 60, "Give me" },
+        { 40, 90, "$1,000,000" },
+        { 20, 120, "please..." },
+    };
+
+    for (size_t i = 0; i < sizeof(lines) / sizeof(lines[0]); i++) {
+        if (band_holds_rows(raster, lines[i].y, font->line_height)) {
+            raster_draw_glyphs(raster, lines[i].x, lines[i].y, lines[i].text, lines[i].text + strlen(lines[i].text),
+                font);
+        }
+    }
+
+    raster_draw_line(raster, 20, DISPLAY_HEIGHT / 2, DISPLAY_HEIGHT / 2 - 20, DISPLAY_HEIGHT / 2, 0);
+
+    // Alternating black and white bytes, swapping phase every BAND_DUMMY_PHASE_ROWS rows
+    for (uint16_t row = 0; row < raster->height; row++) {
+        uint16_t y = raster->top + row;
+        uint8_t* dst = raster->buffer + row * raster->stride;
+        uint8_t even = (y / BAND_DUMMY_PHASE_ROWS) % 2 == 0 ? 0xff : 0x00;
+
+        for (uint16_t x = DISPLAY_HEIGHT / 16; x < DISPLAY_WIDTH / 8; x += 2) {
+            dst[x] = even;
+            dst[x + 1] = ~even;
+        }
+    }
+}
+
+/**
+ * Bitmap rows: 1 bits take the item's color on this plane, 0 bits are white.
+ */
+static void band_draw_bitmap(const Raster* band, const DisplayItem* item, uint8_t value)
+{
+    if (!band_holds_rows(band, item->y, item->height)) {
+        return;
+    }
+
+    if (value) {
+        raster_fill_rect(band, item->x, item->y, MIN(item->width, band->width - MIN(item->x, band->width)),
+            item->height, 1);
+    } else {
+        raster_put_bitmap(band, item->x, item->y, dlist_item_data(item), item->width, item->height, true);
+    }
+}
+
+/**
+ * Draws `plane` of one display list item over whatever `band` already holds, in the framebuffer's polarity,
+ * 0 = ink. Items that do not touch the rows of the band are skipped without drawing.
+ */
+void band_render_item(const DisplayItem* item, const Raster* band, uint8_t plane)
+{
+    const Font* font = &font_jetbrains_mono_16x24;
+    const char* data = (const char*) dlist_item_data(item);
+    // Text is black unless it is red
+    bool text_ink = band_value(item->color == COLOR_RED ? COLOR_RED : COLOR_BLACK, plane) == 0;
+
+    switch (item->type) {
+    case DLIST_ITEM_TEXT:
+        if (band_holds_rows(band, item->y, font->line_height)) {
+            band_draw_glyphs(band, item->x, item->y, data, data + strlen(data), font, text_ink);
+        }
+        break;
+    case DLIST_ITEM_TEXT_BOX:
+        band_draw_text_box(band, item, data, font, text_ink);
+        break;
+    case DLIST_ITEM_LINE:
+        raster_draw_line(band, item->x, item->y, item->x2, item->y2, band_value(item->color, plane));
+        break;
+    case DLIST_ITEM_RUN:
+    case DLIST_ITEM_FILL:
+        if (item->x < band->width) {
+            raster_fill_rect(band, item->x, item->y, MIN(item->width, band->width - item->x), item->height,
+                band_value(item->color, plane));
+        }
+        break;
+    case DLIST_ITEM_BITMAP:
+        band_draw_bitmap(band, item, band_value(item->color, plane));
+        break;
+    case DLIST_ITEM_DUMMY:
+        if (plane == EPAPER_PLANE_BLACK) {
+            band_draw_dummy(band);
+        }
+        break;
+    case DLIST_ITEM_SHAPE:
+        if (band_holds_rows(band, item->bounds.y, item->bounds.h)) {
+            Shape shape;
+
+            dlist_item_shape(item, &shape);
+            shape_draw(band, &shape, band_value(item->color, plane));
+        }
+        break;
+    }
+}
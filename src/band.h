@@ -0,0 +1,16 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "dlist.h"
+#include "raster.h"
+
+#ifndef ___BAND_H
+#define ___BAND_H
+
+void band_render_item(const DisplayItem* item, const Raster* band, uint8_t plane);
+void band_draw_dummy(const Raster* raster);
+
+#endif
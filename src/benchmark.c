@@ -0,0 +1,272 @@
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/param.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "cJSON.h"
+
+#include "benchmark.h"
+#include "epaper.h"
+#include "proto.h"
+
+#if EPAPER_BENCHMARK && !EPAPER_BANDED
+
+// Tag of the drawing functions, whose per-call log lines would otherwise be measured too
+#define BENCHMARK_QUIET_TAG "epaper.c"
+
+typedef struct benchmark_workload {
+    const char* name;
+    // Ops in one run
+    uint32_t ops;
+    void (*run)(uint32_t iteration);
+} benchmark_workload;
+
+static const char* TAG = "benchmark.c";
+
+// Lowest free heap seen since the current workload started
+static size_t lowest_free;
+
+static void sample_heap()
+{
+    lowest_free = MIN(lowest_free, heap_caps_get_free_size(MALLOC_CAP_DEFAULT));
+}
+
+/**
+ * Fills every line of the screen with text.
+ */
+static void run_text_screen(uint32_t iteration)
+{
+    static const char line[] = "The quick brown fox jumps over the lazy dog 0123456";
+    Font* font = &font_jetbrains_mono_16x24;
+
+    for (uint16_t y = 0; y + font->line_height <= DISPLAY_HEIGHT; y += font->line_height) {
+        epaper_draw_text(0, y, line, font, COLOR_BLACK);
+    }
+}
+
+/**
+ * Crossing lines spanning the screen, half of them steep and half shallow.
+ */
+static void run_line_mesh(uint32_t iteration)
+{
+    for (uint16_t i = 0; i < BENCHMARK_MESH_LINES / 2; i++) {
+        uint16_t x = i * (DISPLAY_WIDTH / (BENCHMARK_MESH_LINES / 2));
+        uint16_t y = i * (DISPLAY_HEIGHT / (BENCHMARK_MESH_LINES / 2));
+
+        epaper_draw_line(x, 0, DISPLAY_WIDTH - 1 - x, DISPLAY_HEIGHT - 1, COLOR_BLACK);
+        epaper_draw_line(0, y, DISPLAY_WIDTH - 1, DISPLAY_HEIGHT - 1 - y, COLOR_BLACK);
+    }
+}
+
+static void run_dummy(uint32_t iteration)
+{
+    epaper_draw_dummy();
+}
+
+static void run_clear(uint32_t iteration)
+{
+    epaper_clear();
+}
+
+static void run_transmit(uint32_t iteration)
+{
+    epaper_transmit_frame();
+}
+
+/**
+ * What POST /draw_text does with each body once it is received: parse it and draw the text.
+ */
+static void run_requests(uint32_t iteration)
+{
+    char body[80];
+
+    for (uint32_t i = 0; i < BENCHMARK_REQUESTS; i++) {
+        display_command command = { 0 };
+
+        snprintf(body, sizeof(body), "{\"text\": \"Request %lu\", \"x\": %lu, \"y\": %lu}", (unsigned long) i,
+            (unsigned long) (i * 37 % 640), (unsigned long) (i * 24 % 456));
+
+        cJSON* root = cJSON_Parse(body);
+
+        sample_heap();
+        if (root && proto_parse_json_text(root, &command)) {
+            epaper_draw_text(command.x, command.y, command.text, &font_jetbrains_mono_16x24, command.color);
+        }
+        cJSON_Delete(root);
+    }
+}
+
+static const benchmark_workload workloads[BENCHMARK_WORKLOADS] = {
+    { "text_screen", 1, run_text_screen },
+    { "line_mesh", BENCHMARK_MESH_LINES, run_line_mesh },
+    { "dummy", 1, run_dummy },
+    { "clear", 1, run_clear },
+    { "transmit", 1, run_transmit },
+    { "requests", BENCHMARK_REQUESTS, run_requests },
+};
+
+static void benchmark_workload_run(const benchmark_workload* workload, uint32_t min_time_ms, benchmark_result* result)
+{
+    epaper_spi_stats spi_before;
+    epaper_spi_stats spi_after;
+    // Summed per run: the 32-bit SPI counters wrap within a second on the host
+    uint64_t spi_transactions = 0;
+    uint64_t spi_bytes = 0;
+    size_t free_before = heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+    size_t minimum_before = heap_caps_get_minimum_free_size(MALLOC_CAP_DEFAULT);
+    uint32_t iterations = 0;
+    // Runs per second in the fastest round
+    double best_rate = 0;
+
+    lowest_free = free_before;
+
+    int64_t start = esp_timer_get_time();
+    int64_t round_start = start;
+    uint32_t round_iterations = 0;
+    int64_t elapsed;
+
+    do {
+        epaper_get_spi_stats(&spi_before);
+        workload->run(iterations++);
+        epaper_get_spi_stats(&spi_after);
+
+        spi_transactions += spi_after.transactions - spi_before.transactions;
+        spi_bytes += spi_after.bytes - spi_before.bytes;
+        sample_heap();
+
+        int64_t now = esp_timer_get_time();
+
+        // The best round counts: anything else running can only slow a round down
+        round_iterations++;
+        if (now - round_start >= (int64_t) min_time_ms * 1000 / BENCHMARK_ROUNDS) {
+            best_rate = MAX(best_rate, round_iterations * 1e6 / (now - round_start));
+
+            // Lets the idle task run and feed the task watchdog between rounds
+            vTaskDelay(1);
+            now = esp_timer_get_time();
+            round_start = now;
+            round_iterations = 0;
+        }
+        elapsed = now - start;
+    } while (elapsed < (int64_t) min_time_ms * 1000);
+
+    if (best_rate == 0 && elapsed > 0) {
+        best_rate = iterations * 1e6 / elapsed;
+    }
+
+    // Catches a peak between samples, as long as it went below the lowest point seen before
+    size_t minimum_after = heap_caps_get_minimum_free_size(MALLOC_CAP_DEFAULT);
+    if (minimum_after < minimum_before) {
+        lowest_free = MIN(lowest_free, minimum_after);
+    }
+
+    result->name = workload->name;
+    result->ops = iterations * workload->ops;
+    result->elapsed_us = elapsed;
+    result->ops_per_sec = best_rate * workload->ops;
+    result->spi_transactions = spi_transactions / result->ops;
+    result->spi_bytes = spi_bytes / result->ops;
+    result->peak_heap_bytes = free_before - lowest_free;
+
+    ESP_LOGI(TAG, "%s: %lu op(s) in %lu ms, %.1f op/s", workload->name, (unsigned long) result->ops,
+        (unsigned long) (elapsed / 1000), result->ops_per_sec);
+}
+
+/**
+ * Runs every workload for at least `min_time_ms` and returns the number of results written.
+ *
+ * The workloads draw into the framebuffer and send frames to the controller without refreshing; the caller
+ * holds the framebuffer and finds it cleared afterwards.
+ */
+size_t benchmark_run(uint32_t min_time_ms, benchmark_result* results, size_t max_results)
+{
+    size_t count = MIN(max_results, BENCHMARK_WORKLOADS);
+    esp_log_level_t level = esp_log_level_get(BENCHMARK_QUIET_TAG);
+
+    esp_log_level_set(BENCHMARK_QUIET_TAG, MIN(level, ESP_LOG_WARN));
+
+    for (size_t i = 0; i < count; i++) {
+        epaper_clear();
+        benchmark_workload_run(&workloads[i], min_time_ms, &results[i]);
+    }
+
+    esp_log_level_set(BENCHMARK_QUIET_TAG, level);
+
+    epaper_clear();
+    epaper_reset_damage();
+
+    return count;
+}
+
+#else
+
+size_t benchmark_run(uint32_t min_time_ms, benchmark_result* results, size_t max_results)
+{
+    return 0;
+}
+
+#endif
+
+static bool append(char* out, size_t size, size_t* length, const char* format, ...)
+{
+    va_list args;
+
+    va_start(args, format);
+    int ret = vsnprintf(out + *length, size - *length, format, args);
+    va_end(args);
+
+    if (ret < 0 || *length + ret >= size) {
+        return false;
+    }
+
+    *length += ret;
+
+    return true;
+}
+
+/**
+ * Writes the results as CSV with a header line, or as a JSON object with a "results" array; returns the length
+ * written, or 0 if `out` is too small.
+ */
+size_t benchmark_format_results(const benchmark_result* results, size_t count, benchmark_format format, char* out,
+    size_t size)
+{
+    size_t length = 0;
+    bool ok;
+
+    if (format == BENCHMARK_FORMAT_CSV) {
+        ok = append(out, size, &length,
+            "workload,ops,elapsed_us,ops_per_sec,spi_transactions,spi_bytes,peak_heap_bytes\n");
+    } else {
+        ok = append(out, size, &length, "{\"results\": [");
+    }
+
+    for (size_t i = 0; i < count && ok; i++) {
+        const benchmark_result* result = &results[i];
+
+        if (format == BENCHMARK_FORMAT_CSV) {
+            ok = append(out, size, &length, "%s,%lu,%llu,%.1f,%lu,%lu,%lu\n", result->name, (unsigned long) result->ops,
+                (unsigned long long) result->elapsed_us, result->ops_per_sec, (unsigned long) result->spi_transactions,
+                (unsigned long) result->spi_bytes, (unsigned long) result->peak_heap_bytes);
+        } else {
+            ok = append(out, size, &length,
+                "%s{\"workload\": \"%s\", \"ops\": %lu, \"elapsed_us\": %llu, \"ops_per_sec\": %.1f, "
+                "\"spi_transactions\": %lu, \"spi_bytes\": %lu, \"peak_heap_bytes\": %lu}",
+                i > 0 ? ", " : "", result->name, (unsigned long) result->ops, (unsigned long long) result->elapsed_us,
+                result->ops_per_sec, (unsigned long) result->spi_transactions, (unsigned long) result->spi_bytes,
+                (unsigned long) result->peak_heap_bytes);
+        }
+    }
+
+    if (ok && format == BENCHMARK_FORMAT_JSON) {
+        ok = append(out, size, &length, "]}\n");
+    }
+
+    return ok ? length : 0;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef ___BENCHMARK_H
+#define ___BENCHMARK_H
+
+// Adds the workloads and GET /benchmark; they draw into the framebuffer, so banded builds leave them out
+#ifndef EPAPER_BENCHMARK
+#define EPAPER_BENCHMARK 0
+#endif
+
+// Each workload repeats until it has run this long
+#ifndef BENCHMARK_MIN_TIME_MS
+#define BENCHMARK_MIN_TIME_MS 1000
+#endif
+
+// ops/s come from the fastest of this many equal parts of a workload's time
+#define BENCHMARK_ROUNDS 5
+
+#define BENCHMARK_WORKLOADS 6
+// Lines in one line mesh, and draw requests in one request stream
+#define BENCHMARK_MESH_LINES 100
+#define BENCHMARK_REQUESTS 1000
+
+typedef enum benchmark_format {
+    BENCHMARK_FORMAT_CSV,
+    BENCHMARK_FORMAT_JSON,
+} benchmark_format;
+
+/**
+ * One workload's numbers. An op is a frame for text_screen, dummy and transmit, a clear for clear, a line for
+ * line_mesh and a parsed and drawn request for requests. ops/s are those of the fastest round, SPI traffic is per
+ * op and the peak heap is the most the workload took on top of what was allocated before it started.
+ */
+typedef struct benchmark_result {
+    const char* name;
+    uint32_t ops;
+    uint64_t elapsed_us;
+    double ops_per_sec;
+    uint32_t spi_transactions;
+    uint32_t spi_bytes;
+    uint32_t peak_heap_bytes;
+} benchmark_result;
+
+size_t benchmark_run(uint32_t min_time_ms, benchmark_result* results, size_t max_results);
+size_t benchmark_format_results(const benchmark_result* results, size_t count, benchmark_format format, char* out,
+    size_t size);
+
+#endif
@@ -8,6 +8,7 @@
 #include "freertos/task.h"
 
 #include "button.h"
+#include "metrics.h"
 
 #define BUTTON_SW_DEBOUNCE_MS 300
 
@@ -15,9 +16,14 @@ static const char* TAG = "button.c";
 
 static QueueHandle_t button_press_queue;
 
-static void (*on_button1_press)(void);
-static void (*on_button2_press)(void);
-static void (*on_button3_press)(void);
+static void noop() {
+
+}
+
+// Statically set so callbacks registered before the task starts are not overwritten
+static void (*on_button1_press)(void) = noop;
+static void (*on_button2_press)(void) = noop;
+static void (*on_button3_press)(void) = noop;
 
 void button_register_button1_press_cb(void (*callback)(void))
 {
@@ -34,15 +40,11 @@ void button_register_button3_press_cb(void (*callback)(void))
     on_button3_press = callback;
 }
 
-static void noop() {
-
-}
-
 static void IRAM_ATTR button_press_handler(void* args)
 {
     static uint32_t last_interrupt_time = 0;
     uint32_t interrupt_time = xTaskGetTickCountFromISR();
-    uint32_t button_id = (uint32_t) args;
+    uint32_t button_id = (uint32_t) (uintptr_t) args;
 
     if (interrupt_time - last_interrupt_time > pdMS_TO_TICKS(BUTTON_SW_DEBOUNCE_MS)) {
         last_interrupt_time = interrupt_time;
@@ -53,7 +55,7 @@ static void IRAM_ATTR button_press_handler(void* args)
 
 void button_init(void)
 {
-    button_press_queue = xQueueCreate(10, 4 * sizeof(uint32_t));
+    button_press_queue = xQueueCreate(10, sizeof(uint32_t));
 
     gpio_config_t io_conf = {
         .intr_type = GPIO_INTR_NEGEDGE, // Interrupt on falling edge
@@ -71,23 +73,20 @@ void button_init(void)
     gpio_isr_handler_add(BUTTON2_PIN, button_press_handler, (void*) BUTTON2_PIN);
     gpio_isr_handler_add(BUTTON3_PIN, button_press_handler, (void*) BUTTON3_PIN);
 
-    button_register_button1_press_cb(noop);
-    button_register_button2_press_cb(noop);
-    button_register_button3_press_cb(noop);
-
     ESP_LOGI(TAG, "button event handlers initialized.");
 }
 
 void button_task(void* parameters)
 {
-    uint8_t button_id;
+    uint32_t button_id;
 
     button_init();
 
     while (true) {
 
         if (xQueueReceive(button_press_queue, &button_id, portMAX_DELAY) == pdPASS) {
-            ESP_LOGI(TAG, "Button %d pressed", button_id);
+            ESP_LOGI(TAG, "Button %lu pressed", (unsigned long) button_id);
+            metrics_count(METRICS_COUNTER_BUTTON_PRESSES);
 
             if (button_id == BUTTON1_PIN) {
                 on_button1_press();
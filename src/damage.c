@@ -0,0 +1,160 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "damage.h"
+
+static uint32_t rect_area(const Rect* rect)
+{
+    return (uint32_t) rect->w * rect->h;
+}
+
+bool rect_touches(const Rect* a, const Rect* b)
+{
+    // Overlapping or sharing an edge; the bounds are inclusive on purpose
+    return a->x <= b->x + b->w && b->x <= a->x + a->w
+        && a->y <= b->y + b->h && b->y <= a->y + a->h;
+}
+
+void rect_union(const Rect* a, const Rect* b, Rect* out)
+{
+    uint32_t x1 = a->x < b->x ? a->x : b->x;
+    uint32_t y1 = a->y < b->y ? a->y : b->y;
+    uint32_t x2 = a->x + a->w > b->x + b->w ? a->x + a->w : b->x + b->w;
+    uint32_t y2 = a->y + a->h > b->y + b->h ? a->y + a->h : b->y + b->h;
+
+    out->x = x1;
+    out->y = y1;
+    out->w = x2 - x1;
+    out->h = y2 - y1;
+}
+
+bool rect_intersect(const Rect* a, const Rect* b, Rect* out)
+{
+    uint32_t x1 = a->x > b->x ? a->x : b->x;
+    uint32_t y1 = a->y > b->y ? a->y : b->y;
+    uint32_t x2 = a->x + a->w < b->x + b->w ? a->x + a->w : b->x + b->w;
+    uint32_t y2 = a->y + a->h < b->y + b->h ? a->y + a->h : b->y + b->h;
+
+    if (x1 >= x2 || y1 >= y2) {
+        return false;
+    }
+
+    out->x = x1;
+    out->y = y1;
+    out->w = x2 - x1;
+    out->h = y2 - y1;
+
+    return true;
+}
+
+static void damage_remove(DamageList* list, uint8_t index)
+{
+    list->count--;
+    list->rects[index] = list->rects[list->count];
+}
+
+/**
+ * Folds every rectangle touching `rect` into it, repeating until nothing else touches the grown rectangle.
+ */
+static void damage_absorb(DamageList* list, Rect* rect)
+{
+    uint8_t i = 0;
+
+    while (i < list->count) {
+        if (rect_touches(rect, &list->rects[i])) {
+            rect_union(rect, &list->rects[i], rect);
+            damage_remove(list, i);
+            i = 0;
+        } else {
+            i++;
+        }
+    }
+}
+
+void damage_init(DamageList* list, uint8_t limit)
+{
+    memset(list, 0, sizeof(*list));
+    damage_set_limit(list, limit);
+}
+
+void damage_reset(DamageList* list)
+{
+    list->count = 0;
+}
+
+void damage_set_limit(DamageList* list, uint8_t limit)
+{
+    if (limit < 1) {
+        limit = 1;
+    } else if (limit > DAMAGE_MAX_RECTS) {
+        limit = DAMAGE_MAX_RECTS;
+    }
+
+    list->limit = limit;
+
+    // Re-adding the surplus rectangles merges them into what is left
+    while (list->count > limit) {
+        Rect rect = list->rects[--list->count];
+        damage_add_rect(list, &rect);
+    }
+}
+
+void damage_add(DamageList* list, uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+    Rect rect = { .x = x, .y = y, .w = w, .h = h };
+
+    damage_add_rect(list, &rect);
+}
+
+void damage_add_rect(DamageList* list, const Rect* rect)
+{
+    Rect merged = *rect;
+
+    if (merged.w == 0 || merged.h == 0) {
+        return;
+    }
+
+    damage_absorb(list, &merged);
+
+    while (list->count >= list->limit) {
+        // List is full: merge with the rectangle whose union grows the least
+        uint8_t best = 0;
+        uint32_t best_growth = UINT32_MAX;
+
+        for (uint8_t i = 0; i < list->count; i++) {
+            Rect candidate;
+            rect_union(&merged, &list->rects[i], &candidate);
+
+            uint32_t growth = rect_area(&candidate) - rect_area(&list->rects[i]);
+            if (growth < best_growth) {
+                best_growth = growth;
+                best = i;
+            }
+        }
+
+        rect_union(&merged, &list->rects[best], &merged);
+        damage_remove(list, best);
+        damage_absorb(list, &merged);
+    }
+
+    list->rects[list->count++] = merged;
+}
+
+bool damage_is_empty(const DamageList* list)
+{
+    return list->count == 0;
+}
+
+bool damage_bounds(const DamageList* list, Rect* bounds)
+{
+    if (list->count == 0) {
+        return false;
+    }
+
+    *bounds = list->rects[0];
+    for (uint8_t i = 1; i < list->count; i++) {
+        rect_union(bounds, &list->rects[i], bounds);
+    }
+
+    return true;
+}
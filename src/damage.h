@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifndef ___DAMAGE_H
+#define ___DAMAGE_H
+
+// Upper bound for the number of separate dirty rectangles; the active limit is set per list
+#define DAMAGE_MAX_RECTS 8
+
+typedef struct Rect {
+    uint16_t x;
+    uint16_t y;
+    uint16_t w;
+    uint16_t h;
+} Rect;
+
+typedef struct DamageList {
+    Rect rects[DAMAGE_MAX_RECTS];
+    uint8_t count;
+    uint8_t limit;
+} DamageList;
+
+void damage_init(DamageList* list, uint8_t limit);
+void damage_reset(DamageList* list);
+void damage_set_limit(DamageList* list, uint8_t limit);
+
+void damage_add(DamageList* list, uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+void damage_add_rect(DamageList* list, const Rect* rect);
+
+bool damage_is_empty(const DamageList* list);
+bool damage_bounds(const DamageList* list, Rect* bounds);
+
+bool rect_touches(const Rect* a, const Rect* b);
+void rect_union(const Rect* a, const Rect* b, Rect* out);
+bool rect_intersect(const Rect* a, const Rect* b, Rect* out);
+
+#endif
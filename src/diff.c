@@ -0,0 +1,256 @@
+#include <stdlib.h>
+#include <string.h>
+#include <sys/param.h>
+
+#include "esp_log.h"
+
+#include "diff.h"
+
+static const char* TAG = "diff.c";
+
+static uint16_t frame_stride;
+static uint16_t frame_height;
+static bool committed_valid = false;
+
+#if DIFF_MODE == DIFF_MODE_FULL
+static uint32_t* committed_frame;
+#else
+static uint32_t* committed_row_hashes;
+
+static uint32_t diff_hash_row(const uint8_t* row)
+{
+    const uint32_t* words = (const uint32_t*) row;
+    uint32_t hash = 2166136261u; // FNV-1a, fed a word at a time
+
+    for (uint16_t i = 0; i < frame_stride / 4; i++) {
+        hash = (hash ^ words[i]) * 16777619u;
+    }
+
+    return hash;
+}
+#endif
+
+bool diff_init(uint16_t stride, uint16_t height)
+{
+    if (stride % 4 != 0) {
+        ESP_LOGE(TAG, "frame stride must be a multiple of 4 bytes");
+        return false;
+    }
+
+    frame_stride = stride;
+    frame_height = height;
+    committed_valid = false;
+
+#if DIFF_MODE == DIFF_MODE_FULL
+    if (!committed_frame) {
+        committed_frame = malloc((size_t) stride * height);
+    }
+    if (!committed_frame) {
+        ESP_LOGE(TAG, "failed to allocate %u bytes for the committed frame", (unsigned) (stride * height));
+        return false;
+    }
+    ESP_LOGI(TAG, "frame diff: full copy, %u bytes", (unsigned) diff_memory_usage());
+#else
+    if (!committed_row_hashes) {
+        committed_row_hashes = malloc(sizeof(uint32_t) * height);
+    }
+    if (!committed_row_hashes) {
+        ESP_LOGE(TAG, "failed to allocate row hashes");
+        return false;
+    }
+    ESP_LOGI(TAG, "frame diff: row hashes, %u bytes", (unsigned) diff_memory_usage());
+#endif
+
+    return true;
+}
+
+size_t diff_memory_usage()
+{
+#if DIFF_MODE == DIFF_MODE_FULL
+    return (size_t) frame_stride * frame_height;
+#else
+    return sizeof(uint32_t) * frame_height;
+#endif
+}
+
+void diff_invalidate()
+{
+    committed_valid = false;
+}
+
+bool diff_is_valid()
+{
+    return committed_valid;
+}
+
+/**
+ * Takes back a diff_invalidate() when the panel still shows the committed frame after all, e.g. because what was
+ * sent to the controller meanwhile was never refreshed.
+ */
+void diff_revalidate()
+{
+#if DIFF_MODE == DIFF_MODE_FULL
+    committed_valid = committed_frame != NULL;
+#else
+    committed_valid = committed_row_hashes != NULL;
+#endif
+}
+
+void diff_commit(const uint8_t* frame)
+{
+#if DIFF_MODE == DIFF_MODE_FULL
+    if (!committed_frame) {
+        return;
+    }
+    memcpy(committed_frame, frame, (size_t) frame_stride * frame_height);
+#else
+    if (!committed_row_hashes) {
+        return;
+    }
+    for (uint16_t y = 0; y < frame_height; y++) {
+        committed_row_hashes[y] = diff_hash_row(frame + y * frame_stride);
+    }
+#endif
+
+    committed_valid = true;
+}
+
+/**
+ * Byte columns and rows seen so far by a diff; empty while y_min < 0.
+ */
+typedef struct diff_bounds {
+    int32_t x_min;
+    int32_t x_max;
+    int32_t y_min;
+    int32_t y_max;
+} diff_bounds;
+
+static void diff_bounds_add(diff_bounds* bounds, int32_t x_first, int32_t x_last, uint16_t y)
+{
+    if (bounds->y_min < 0) {
+        bounds->y_min = y;
+    }
+    bounds->y_max = y;
+    bounds->x_min = MIN(bounds->x_min, x_first);
+    bounds->x_max = MAX(bounds->x_max, x_last);
+}
+
+static bool diff_bounds_rect(const diff_bounds* bounds, Rect* rect)
+{
+    if (bounds->y_min < 0) {
+        *rect = (Rect) { 0 };
+        return false;
+    }
+
+    rect->x = bounds->x_min * 8;
+    rect->y = bounds->y_min;
+    rect->w = (bounds->x_max - bounds->x_min + 1) * 8;
+    rect->h = bounds->y_max - bounds->y_min + 1;
+
+    return true;
+}
+
+#if DIFF_MODE == DIFF_MODE_FULL
+/**
+ * Whether the byte at column `x_byte` of row `y` overlaps a rectangle of `damage`; windows are sent in whole
+ * bytes, so such a byte goes out with the damage.
+ */
+static bool diff_byte_damaged(const DamageList* damage, uint16_t x_byte, uint16_t y)
+{
+    for (uint8_t i = 0; i < damage->count; i++) {
+        const Rect* rect = &damage->rects[i];
+
+        if (y >= rect->y && y < rect->y + rect->h && x_byte * 8 + 8 > rect->x && x_byte * 8 < rect->x + rect->w) {
+            return true;
+        }
+    }
+
+    return false;
+}
+#else
+/**
+ * Whether a rectangle of `damage` spans all of row `y`; changed columns are not known with row hashes.
+ */
+static bool diff_row_damaged(const DamageList* damage, uint16_t y)
+{
+    for (uint8_t i = 0; i < damage->count; i++) {
+        const Rect* rect = &damage->rects[i];
+
+        if (y >= rect->y && y < rect->y + rect->h && rect->x == 0 && rect->w >= frame_stride * 8) {
+            return true;
+        }
+    }
+
+    return false;
+}
+#endif
+
+/**
+ * Compares `frame` with the last committed frame in a single pass. `changed` receives the byte-aligned rectangle
+ * around everything that differs, `missed` the one around what differs outside every rectangle of `damage`, i.e.
+ * what a refresh of just the damage would leave out; `missed` is empty (w = h = 0) when there is nothing like that.
+ *
+ * Returns false when nothing changed. Without a committed frame the whole frame counts as changed, and nothing as
+ * missed since nothing is known then. With row hashes a changed row counts as missed unless a rectangle spans it.
+ */
+bool diff_changed(const uint8_t* frame, const DamageList* damage, Rect* changed, Rect* missed)
+{
+    diff_bounds all = { .x_min = frame_stride, .x_max = -1, .y_min = -1, .y_max = -1 };
+    diff_bounds outside = all;
+
+    if (!committed_valid) {
+        *changed = (Rect) { .x = 0, .y = 0, .w = frame_stride * 8, .h = frame_height };
+        *missed = (Rect) { 0 };
+        return true;
+    }
+
+#if DIFF_MODE == DIFF_MODE_FULL
+    const uint16_t words_per_row = frame_stride / 4;
+
+    for (uint16_t y = 0; y < frame_height; y++) {
+        const uint32_t* current = (const uint32_t*) (frame + y * frame_stride);
+        const uint32_t* previous = committed_frame + y * words_per_row;
+
+        for (uint16_t i = 0; i < words_per_row; i++) {
+            if ((current[i] ^ previous[i]) == 0) {
+                continue;
+            }
+
+            const uint8_t* current_bytes = (const uint8_t*) &current[i];
+            const uint8_t* previous_bytes = (const uint8_t*) &previous[i];
+
+            for (uint8_t b = 0; b < 4; b++) {
+                uint16_t x_byte = i * 4 + b;
+
+                if (current_bytes[b] == previous_bytes[b]) {
+                    continue;
+                }
+
+                diff_bounds_add(&all, x_byte, x_byte, y);
+
+                // Rows come in order, so a byte inside what is already missed in this row cannot move an edge
+                bool inside = outside.y_max == y && x_byte >= outside.x_min && x_byte <= outside.x_max;
+
+                if (!inside && !diff_byte_damaged(damage, x_byte, y)) {
+                    diff_bounds_add(&outside, x_byte, x_byte, y);
+                }
+            }
+        }
+    }
+#else
+    for (uint16_t y = 0; y < frame_height; y++) {
+        if (diff_hash_row(frame + y * frame_stride) == committed_row_hashes[y]) {
+            continue;
+        }
+
+        diff_bounds_add(&all, 0, frame_stride - 1, y);
+        if (!diff_row_damaged(damage, y)) {
+            diff_bounds_add(&outside, 0, frame_stride - 1, y);
+        }
+    }
+#endif
+
+    diff_bounds_rect(&outside, missed);
+
+    return diff_bounds_rect(&all, changed);
+}
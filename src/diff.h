@@ -0,0 +1,30 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "damage.h"
+
+#ifndef ___DIFF_H
+#define ___DIFF_H
+
+// Keep a full copy of the last committed frame and diff it word by word (exact changed rectangle)
+#define DIFF_MODE_FULL 0
+// Keep one 32-bit hash per row; changed rows are exact, columns are not known
+#define DIFF_MODE_ROW_HASH 1
+
+#ifndef DIFF_MODE
+#define DIFF_MODE DIFF_MODE_FULL
+#endif
+
+bool diff_init(uint16_t stride, uint16_t height);
+size_t diff_memory_usage();
+
+void diff_invalidate();
+bool diff_is_valid();
+void diff_revalidate();
+void diff_commit(const uint8_t* frame);
+bool diff_changed(const uint8_t* frame, const DamageList* damage, Rect* changed, Rect* missed);
+
+#endif
@@ -0,0 +1,870 @@
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/param.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/event_groups.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#include "esp_log.h"
+
+#include "button.h"
+#include "display.h"
+#include "dlist.h"
+#include "epaper.h"
+#include "font.h"
+#include "slots.h"
+#include "utf8.h"
+
+#define DISPLAY_QUEUE_SIZE 20
+#define DISPLAY_TASK_STACK_SIZE 4096
+#define DISPLAY_TASK_PRIORITY 1
+// The Wi-Fi and lwIP tasks run on core 0 (PRO CPU)
+#define DISPLAY_TASK_CORE 1
+
+// Bytes of drawn items kept to redraw the screen from, see dlist.h; the list restarts at every clear
+#ifndef DISPLAY_LIST_SIZE
+#define DISPLAY_LIST_SIZE 8192
+#endif
+
+// Set after every batch so waiters re-check the completed ticket
+#define DISPLAY_BATCH_DONE_BIT BIT0
+// Longest a waiter sleeps before re-checking, in case it missed the batch that completed its ticket
+#define DISPLAY_WAIT_SLICE_MS 100
+// Longest a submitter waiting for room in the queue sleeps before trying again
+#define DISPLAY_SEND_RETRY_MS 10
+
+static const char* TAG = "display.c";
+
+static QueueHandle_t display_queue;
+// Serializes ticket assignment with the queue send so tickets complete in order; never held while waiting
+static SemaphoreHandle_t submit_mutex;
+static EventGroupHandle_t display_events;
+// Held by the display task while it draws and refreshes, and by callers writing to the framebuffer directly
+static SemaphoreHandle_t framebuffer_mutex;
+
+/**
+ * A single command, or a heap-allocated batch that the display task frees once it is applied.
+ */
+typedef struct display_queue_item {
+    uint32_t ticket;
+    display_command command;
+    display_command* batch;
+    uint16_t batch_count;
+    bool refresh;
+} display_queue_item;
+
+// What is on the screen, item by item; the only copy of the frame in banded mode
+static DisplayList display_list;
+#if EPAPER_BANDED
+// Something changed since the last frame was sent
+static bool scene_dirty;
+#endif
+
+// Slot shown last, from which display_next_slot() goes on
+static char shown_slot[SLOTS_NAME_MAX_LEN + 1];
+// The screen changed since it was last saved to DISPLAY_SLOT_CURRENT
+static bool current_dirty;
+// When it was last saved there, or the boot
+static TickType_t current_saved_ticks;
+
+static uint32_t next_ticket = 1;
+// Written by the display task, read by waiters on other tasks
+static uint32_t completed_ticket = 0;
+static display_stats stats;
+
+/**
+ * Queues a command for the display task without waiting for it to be drawn.
+ *
+ * Returns the command's ticket, or 0 when the queue is full.
+ */
+static uint32_t display_enqueue(display_queue_item* item, TickType_t timeout)
+{
+    TickType_t start = xTaskGetTickCount();
+    bool sent = false;
+    bool expired = false;
+
+    // A submitter that waits for room does so outside submit_mutex and tries again, so that it holds up neither
+    // display_submit() nor the button task; the ticket is taken together with the send and stays in queue order
+    while (!sent && !expired) {
+        TickType_t elapsed;
+
+        xSemaphoreTake(submit_mutex, portMAX_DELAY);
+
+        item->ticket = next_ticket;
+        sent = xQueueSend(display_queue, item, 0) == pdPASS;
+        elapsed = xTaskGetTickCount() - start;
+        if (sent) {
+            next_ticket++;
+        } else if (elapsed >= timeout) {
+            item->ticket = 0;
+            stats.dropped++;
+            expired = true;
+        }
+
+        xSemaphoreGive(submit_mutex);
+
+        if (!sent && !expired) {
+            xEventGroupWaitBits(display_events, DISPLAY_BATCH_DONE_BIT, pdFALSE, pdTRUE,
+                MIN(timeout - elapsed, pdMS_TO_TICKS(DISPLAY_SEND_RETRY_MS) + 1));
+        }
+    }
+
+    if (!item->ticket) {
+        ESP_LOGW(TAG, "display queue full, command dropped");
+    }
+
+    return item->ticket;
+}
+
+/**
+ * Queues a command for the display task without waiting for it to be drawn.
+ *
+ * Returns the command's ticket, or 0 when the queue is full.
+ */
+uint32_t display_submit(const display_command* command)
+{
+    display_queue_item item = { .command = *command, .refresh = true };
+
+    return display_enqueue(&item, 0);
+}
+
+/**
+ * Queues a command, waiting up to `timeout_ms` for room in the queue.
+ *
+ * With `refresh` false the command only changes the framebuffer. Used by streaming parsers that submit
+ * commands as they arrive and ask for a refresh with the last one.
+ */
+uint32_t display_submit_wait(const display_command* command, bool refresh, uint32_t timeout_ms)
+{
+    display_queue_item item = { .command = *command, .refresh = refresh };
+
+    return display_enqueue(&item, pdMS_TO_TICKS(timeout_ms));
+}
+
+/**
+ * Queues `count` commands that are applied back to back, with no refresh in between.
+ *
+ * With `refresh` false the commands only change the framebuffer; they reach the panel with the next refresh.
+ * Returns the batch's ticket, or 0 when the queue is full or the batch cannot be copied.
+ */
+uint32_t display_submit_batch(const display_command* commands, size_t count, bool refresh)
+{
+    display_queue_item item = { .batch_count = count, .refresh = refresh };
+
+    if (count == 0 || count > DISPLAY_BATCH_MAX_COMMANDS) {
+        return 0;
+    }
+
+    item.batch = malloc(count * sizeof(display_command));
+    if (!item.batch) {
+        ESP_LOGE(TAG, "failed to allocate a batch of %u command(s)", (unsigned) count);
+        return 0;
+    }
+    memcpy(item.batch, commands, count * sizeof(display_command));
+
+    uint32_t ticket = display_enqueue(&item, 0);
+    if (!ticket) {
+        free(item.batch);
+    }
+
+    return ticket;
+}
+
+uint32_t display_draw_text(const char* text, int x, int y)
+{
+    display_command command = { .type = DISPLAY_CMD_DRAW_TEXT, .x = x, .y = y };
+
+    strncpy(command.text, text, DISPLAY_TEXT_MAX_LEN);
+    utf8_trim(command.text);
+
+    return display_submit(&command);
+}
+
+uint32_t display_draw_text_box(const char* text, int x, int y, int w, int h, const LayoutOptions* layout)
+{
+    display_command command = {
+        .type = DISPLAY_CMD_DRAW_TEXT_BOX, .x = x, .y = y, .width = w, .height = h, .layout = *layout
+    };
+
+    strncpy(command.text, text, DISPLAY_TEXT_MAX_LEN);
+    utf8_trim(command.text);
+
+    return display_submit(&command);
+}
+
+uint32_t display_clear()
+{
+    display_command command = { .type = DISPLAY_CMD_CLEAR };
+
+    return display_submit(&command);
+}
+
+uint32_t display_toggle_screen_color()
+{
+    display_command command = { .type = DISPLAY_CMD_TOGGLE_SCREEN_COLOR };
+
+    return display_submit(&command);
+}
+
+uint32_t display_dummy_screen()
+{
+    display_command command = { .type = DISPLAY_CMD_DUMMY_SCREEN };
+
+    return display_submit(&command);
+}
+
+/**
+ * Removes the item drawn with `id`; whatever it covered is redrawn from the items left.
+ */
+uint32_t display_remove(uint16_t id)
+{
+    display_command command = { .type = DISPLAY_CMD_REMOVE, .id = id };
+
+    return display_submit(&command);
+}
+
+/**
+ * Queues a slot command; saving and deleting leave the screen as it is, so they do not ask for a refresh.
+ */
+static uint32_t display_submit_slot(display_command_type type, const char* name)
+{
+    display_command command = { .type = type };
+
+    strncpy(command.text, name, DISPLAY_TEXT_MAX_LEN);
+
+    return display_submit_wait(&command, type == DISPLAY_CMD_SHOW_SLOT, 0);
+}
+
+/**
+ * Saves the screen, its display list included, to the flash slot `name`.
+ */
+uint32_t display_save_slot(const char* name)
+{
+    return display_submit_slot(DISPLAY_CMD_SAVE_SLOT, name);
+}
+
+/**
+ * Shows a saved screen: with a frame in the slot this costs a transmit and a refresh, no drawing.
+ */
+uint32_t display_show_slot(const char* name)
+{
+    return display_submit_slot(DISPLAY_CMD_SHOW_SLOT, name);
+}
+
+/**
+ * Shows the saved screen after the one shown last, skipping DISPLAY_SLOT_CURRENT; the test pattern if there is none.
+ */
+uint32_t display_next_slot()
+{
+    return display_submit_slot(DISPLAY_CMD_SHOW_SLOT, "");
+}
+
+uint32_t display_delete_slot(const char* name)
+{
+    return display_submit_slot(DISPLAY_CMD_DELETE_SLOT, name);
+}
+
+uint32_t display_refresh()
+{
+    display_command command = { .type = DISPLAY_CMD_REFRESH };
+
+    return display_submit(&command);
+}
+
+/**
+ * Gives the caller exclusive access to epaper_get_buffer() until display_unlock_framebuffer().
+ *
+ * The display task holds the lock through a whole refresh, so this can wait for several seconds.
+ */
+bool display_lock_framebuffer(uint32_t timeout_ms)
+{
+    return xSemaphoreTake(framebuffer_mutex, pdMS_TO_TICKS(timeout_ms)) == pdTRUE;
+}
+
+void display_unlock_framebuffer()
+{
+    xSemaphoreGive(framebuffer_mutex);
+}
+
+bool display_is_done(uint32_t ticket)
+{
+    return ticket != 0 && __atomic_load_n(&completed_ticket, __ATOMIC_ACQUIRE) >= ticket;
+}
+
+/**
+ * Blocks until the command with `ticket` is on the panel or `timeout_ms` elapses.
+ */
+bool display_wait(uint32_t ticket, uint32_t timeout_ms)
+{
+    TickType_t start = xTaskGetTickCount();
+    TickType_t timeout = pdMS_TO_TICKS(timeout_ms);
+
+    while (!display_is_done(ticket)) {
+        TickType_t elapsed = xTaskGetTickCount() - start;
+        if (ticket == 0 || elapsed >= timeout) {
+            return false;
+        }
+
+        xEventGroupWaitBits(display_events, DISPLAY_BATCH_DONE_BIT, pdFALSE, pdTRUE,
+            MIN(timeout - elapsed, pdMS_TO_TICKS(DISPLAY_WAIT_SLICE_MS) + 1));
+    }
+
+    return true;
+}
+
+void display_get_stats(display_stats* out)
+{
+    *out = stats;
+    out->items = display_list.count;
+    out->list_bytes = display_list.size;
+}
+
+/**
+ * Converts a drawing command to a display list item and the data stored with it; returns false for commands that
+ * do not draw.
+ */
+static bool display_item_from_command(const display_command* command, DisplayItem* item, const void** data)
+{
+    uint16_t row_bytes = (command->width + 7) / 8;
+
+    *item = (DisplayItem) {
+        .id = command->id,
+        .color = command->color <= COLOR_RED ? command->color : COLOR_BLACK,
+        .x = command->x,
+        .y = command->y,
+        .width = command->width,
+        .height = command->height,
+    };
+    *data = command->text;
+
+    switch (command->type) {
+    case DISPLAY_CMD_DRAW_TEXT:
+        item->type = DLIST_ITEM_TEXT;
+        item->length = strlen(command->text) + 1;
+        break;
+    case DISPLAY_CMD_DRAW_TEXT_BOX:
+        item->type = DLIST_ITEM_TEXT_BOX;
+        item->layout = command->layout;
+        item->length = strlen(command->text) + 1;
+        break;
+    case DISPLAY_CMD_DRAW_LINE:
+        item->type = DLIST_ITEM_LINE;
+        item->x2 = command->x2;
+        item->y2 = command->y2;
+        break;
+    case DISPLAY_CMD_DRAW_RUN:
+        item->type = DLIST_ITEM_RUN;
+        item->width = command->length;
+        item->height = 1;
+        break;
+    case DISPLAY_CMD_FILL_RECT:
+        item->type = DLIST_ITEM_FILL;
+        break;
+    case DISPLAY_CMD_DRAW_BITMAP:
+        item->type = DLIST_ITEM_BITMAP;
+        item->height = MIN(command->height, DISPLAY_BITMAP_MAX_SIZE / MAX(row_bytes, 1));
+        item->length = row_bytes * item->height;
+        *data = command->bitmap;
+        break;
+    case DISPLAY_CMD_DRAW_SHAPE:
+        item->type = DLIST_ITEM_SHAPE;
+        item->shape = command->shape;
+        item->shape_flags = command->shape_flags;
+        item->thickness = command->thickness;
+        item->radius = command->radius;
+        item->x2 = command->x2;
+        item->y2 = command->y2;
+        if (command->shape == SHAPE_POLYGON) {
+            item->length = MIN(command->length, SHAPE_MAX_POINTS) * sizeof(ShapePoint);
+            *data = command->points;
+        }
+        break;
+    case DISPLAY_CMD_DUMMY_SCREEN:
+        item->type = DLIST_ITEM_DUMMY;
+        break;
+    default:
+        return false;
+    }
+
+    return true;
+}
+
+static void display_render(const Raster* band, uint8_t plane, void* ctx)
+{
+    dlist_render(&display_list, band, plane, ctx);
+}
+
+#if !EPAPER_BANDED
+/**
+ * Draws an item straight into the framebuffer; the same pixels as replaying it on top of the items before it.
+ */
+static void display_draw_item(const DisplayItem* item, const void* data)
+{
+    switch (item->type) {
+    case DLIST_ITEM_TEXT:
+        epaper_draw_text(item->x, item->y, data, &font_jetbrains_mono_16x24, item->color);
+        break;
+    case DLIST_ITEM_TEXT_BOX:
+        epaper_draw_text_box(item->x, item->y, item->width, item->height, data, &font_jetbrains_mono_16x24,
+            &item->layout, item->color);
+        break;
+    case DLIST_ITEM_LINE:
+        epaper_draw_line(item->x, item->y, item->x2, item->y2, item->color);
+        break;
+    case DLIST_ITEM_RUN:
+        epaper_draw_run(item->x, item->y, item->width, item->color);
+        break;
+    case DLIST_ITEM_FILL:
+        epaper_fill_rect(item->x, item->y, item->width, item->height, item->color);
+        break;
+    case DLIST_ITEM_BITMAP:
+        epaper_draw_bitmap(item->x, item->y, item->width, item->height, data, item->color);
+        break;
+    case DLIST_ITEM_DUMMY:
+        epaper_draw_dummy();
+        break;
+    case DLIST_ITEM_SHAPE: {
+        Shape shape;
+
+        dlist_item_shape(item, &shape);
+        shape.points = data;
+        epaper_draw_shape(&shape, item->color);
+        break;
+    }
+    }
+}
+
+/**
+ * `area` widened to whole bytes, like the window epaper_render_area() copies.
+ */
+static void display_redraw_clip(const Rect* area, Rect* clip)
+{
+    clip->x = area->x & ~7;
+    clip->y = area->y;
+    clip->w = ((area->x + area->w + 7) & ~7) - clip->x;
+    clip->h = area->h;
+}
+
+/**
+ * Whether display_redraw() can redraw `area`: not when it would wipe pixels written directly, which the list does
+ * not hold.
+ */
+static bool display_can_redraw(const Rect* area)
+{
+    Rect clip;
+
+    display_redraw_clip(area, &clip);
+
+    return !dlist_overlaps_unlisted(&display_list, &clip);
+}
+
+/**
+ * Redraws `area`, widened to whole bytes, from the display list.
+ */
+static void display_redraw(const Rect* area)
+{
+    Rect clip;
+
+    if (area->w == 0 || area->h == 0) {
+        return;
+    }
+
+    display_redraw_clip(area, &clip);
+    epaper_render_area(&clip, dlist_has_red(&display_list), display_render, &clip);
+}
+#endif
+
+/**
+ * Records that the caller wrote the framebuffer area at `x`, `y` directly, holding display_lock_framebuffer().
+ * Items are no longer redrawn in place over it, since that would wipe it; see DLIST_ITEM_UNLISTED.
+ */
+void display_mark_written(int x, int y, int w, int h)
+{
+    Rect area = { .x = x, .y = y, .w = w, .h = h };
+
+    if (w > 0 && h > 0) {
+        dlist_mark_unlisted(&display_list, &area);
+    }
+}
+
+/**
+ * Adds the item a drawing command describes to the display list. A new item is drawn on top of the framebuffer
+ * as it is; an item that replaces one with the same id is redrawn in place, together with what the old one
+ * covered. Over pixels written directly the new version is drawn on top of the old one instead.
+ *
+ * When the list is full the item is drawn but not kept, or dropped in banded mode.
+ */
+static void display_put(const display_command* command)
+{
+    DisplayItem item;
+    const void* data;
+    Rect replaced;
+
+    if (!display_item_from_command(command, &item, &data)) {
+        return;
+    }
+
+    if (item.type == DLIST_ITEM_DUMMY) {
+        dlist_clear(&display_list);
+    }
+
+#if !EPAPER_BANDED
+    bool existed = item.id && dlist_find(&display_list, item.id);
+#endif
+
+    if (!dlist_put(&display_list, &item, data, &replaced)) {
+#if EPAPER_BANDED
+        ESP_LOGW(TAG, "display list full, item dropped");
+        stats.dropped++;
+#else
+        ESP_LOGW(TAG, "display list full, item drawn without being kept");
+        stats.unlisted++;
+
+        Rect screen = { .x = 0, .y = 0, .w = DISPLAY_WIDTH, .h = DISPLAY_HEIGHT };
+
+        // The old version of the item is not kept either
+        if (dlist_remove(&display_list, item.id, &replaced) && display_can_redraw(&replaced)) {
+            display_redraw(&replaced);
+        }
+        display_draw_item(&item, data);
+        dlist_mark_unlisted(&display_list, &screen);
+#endif
+        return;
+    }
+
+#if !EPAPER_BANDED
+    if (!existed) {
+        display_draw_item(&item, data);
+        return;
+    }
+
+    const Rect* bounds = &dlist_find(&display_list, item.id)->bounds;
+
+    // What the old version covered is not known there, so it stays under the new one
+    if (!display_can_redraw(&replaced) || !display_can_redraw(bounds)) {
+        display_draw_item(&item, data);
+        return;
+    }
+
+    display_redraw(&replaced);
+    display_redraw(bounds);
+#endif
+}
+
+static void display_remove_item(uint16_t id)
+{
+    Rect removed;
+
+    if (!dlist_remove(&display_list, id, &removed)) {
+        ESP_LOGW(TAG, "no item with id %u to remove", id);
+        return;
+    }
+
+#if !EPAPER_BANDED
+    if (!display_can_redraw(&removed)) {
+        ESP_LOGW(TAG, "item %u stays on the screen: it is over pixels written directly", id);
+        return;
+    }
+
+    display_redraw(&removed);
+#endif
+}
+
+/**
+ * Saves the framebuffer's planes, or only the display list in banded mode, together with the display list.
+ */
+static bool display_save_slot_now(const char* name)
+{
+    size_t scene_size = dlist_serialized_size(&display_list);
+    uint8_t* scene = malloc(scene_size);
+    slot_image image = {
+#if !EPAPER_BANDED
+        .black = epaper_get_buffer(),
+#endif
+        .red = epaper_get_red_buffer(),
+        .plane_size = DISPLAY_BUFFER_SIZE,
+        .scene = scene,
+        .scene_size = scene ? dlist_serialize(&display_list, scene, scene_size) : 0,
+        .screen_color = epaper_get_screen_color(),
+    };
+
+    if (!scene) {
+        ESP_LOGW(TAG, "failed to allocate %u bytes for the display list, saving the frame only", (unsigned) scene_size);
+    }
+
+    bool ok = slots_save(name, &image);
+
+    free(scene);
+
+    return ok;
+}
+
+/**
+ * Takes the display list and the frame from a slot; without a frame in the slot, or in banded mode, the screen is
+ * drawn from the list. With `shown` the panel already shows the slot, as after a reset.
+ */
+static bool display_load_slot(const char* name, bool shown)
+{
+    slot_image image;
+
+    if (!slots_load(name, &image)) {
+        return false;
+    }
+
+    if (!image.scene || !dlist_deserialize(&display_list, image.scene, image.scene_size)) {
+        dlist_clear(&display_list);
+    }
+
+#if EPAPER_BANDED
+    epaper_restore_frame(NULL, NULL, image.screen_color, shown);
+    scene_dirty = !shown;
+#else
+    if (image.black && image.plane_size == DISPLAY_BUFFER_SIZE) {
+        epaper_restore_frame(image.black, image.red, image.screen_color, shown);
+    } else {
+        Rect screen = { .x = 0, .y = 0, .w = DISPLAY_WIDTH, .h = DISPLAY_HEIGHT };
+
+        epaper_restore_frame(NULL, NULL, image.screen_color, false);
+        display_redraw(&screen);
+    }
+#endif
+
+    strncpy(shown_slot, name, SLOTS_NAME_MAX_LEN);
+
+    return true;
+}
+
+/**
+ * Shows the slot `name`, or with "" the next one after the slot shown last, skipping DISPLAY_SLOT_CURRENT. Shows
+ * the test pattern when there is nothing to cycle through.
+ */
+static void display_show_slot_now(const char* name)
+{
+    slot_info slots[SLOTS_COUNT];
+    size_t count = name[0] ? 0 : slots_list(slots, SLOTS_COUNT);
+    size_t next = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        if (strcmp(slots[i].name, shown_slot) == 0) {
+            next = i + 1;
+        }
+    }
+
+    for (size_t i = 0; i < count && !name[0]; i++) {
+        const char* candidate = slots[(next + i) % count].name;
+
+        if (strcmp(candidate, DISPLAY_SLOT_CURRENT) != 0) {
+            name = candidate;
+        }
+    }
+
+    if (!name[0]) {
+        display_command dummy = { .type = DISPLAY_CMD_DUMMY_SCREEN };
+
+        display_put(&dummy);
+        return;
+    }
+
+    if (!display_load_slot(name, false)) {
+        ESP_LOGW(TAG, "no slot \"%s\" to show", name);
+    }
+}
+
+/**
+ * Applies a command to the display list and the framebuffer, or the display list only in banded mode; the panel
+ * is refreshed once per batch.
+ */
+static void display_apply(const display_command* command)
+{
+    stats.commands++;
+
+    // Slots live in flash; the screen stays as it is
+    if (command->type == DISPLAY_CMD_SAVE_SLOT) {
+        display_save_slot_now(command->text);
+        return;
+    }
+    if (command->type == DISPLAY_CMD_DELETE_SLOT) {
+        slots_delete(command->text);
+        return;
+    }
+
+#if EPAPER_BANDED
+    scene_dirty = true;
+#endif
+
+    switch (command->type) {
+    case DISPLAY_CMD_CLEAR:
+        dlist_clear(&display_list);
+        epaper_clear();
+        break;
+    case DISPLAY_CMD_SET_SCREEN_COLOR:
+        epaper_set_screen_color(command->color);
+        break;
+    case DISPLAY_CMD_TOGGLE_SCREEN_COLOR:
+        epaper_set_screen_color(epaper_get_screen_color() == SCREEN_WHITE ? SCREEN_BLACK : SCREEN_WHITE);
+        break;
+    case DISPLAY_CMD_REMOVE:
+        display_remove_item(command->id);
+        break;
+    case DISPLAY_CMD_REFRESH:
+        break;
+    case DISPLAY_CMD_SHOW_SLOT:
+        display_show_slot_now(command->text);
+        break;
+    default:
+        display_put(command);
+        break;
+    }
+}
+
+static void display_apply_item(const display_queue_item* item)
+{
+    if (!item->batch) {
+        display_apply(&item->command);
+        return;
+    }
+
+    for (uint16_t i = 0; i < item->batch_count; i++) {
+        display_apply(&item->batch[i]);
+    }
+
+    free(item->batch);
+}
+
+/**
+ * Milliseconds until the screen is due to be saved to DISPLAY_SLOT_CURRENT, 0 when it is, POWER_IDLE_NEVER when it
+ * needs no save.
+ */
+static uint32_t display_save_due_ms()
+{
+    if (!DISPLAY_SAVE_CURRENT || !current_dirty) {
+        return POWER_IDLE_NEVER;
+    }
+
+    uint32_t elapsed_ms = pdTICKS_TO_MS(xTaskGetTickCount() - current_saved_ticks);
+
+    return elapsed_ms >= DISPLAY_SAVE_INTERVAL_MS ? 0 : DISPLAY_SAVE_INTERVAL_MS - elapsed_ms;
+}
+
+static void display_task(void* parameters)
+{
+    display_queue_item item;
+
+    xSemaphoreTake(framebuffer_mutex, portMAX_DELAY);
+    epaper_setup();
+
+    if (!dlist_init(&display_list, DISPLAY_LIST_SIZE)) {
+        ESP_LOGE(TAG, "failed to allocate the display list, items cannot be updated or removed");
+    }
+
+    // The panel kept showing the screen saved last through the reset; it becomes the baseline of the next refresh
+    if (DISPLAY_SAVE_CURRENT && display_load_slot(DISPLAY_SLOT_CURRENT, true)) {
+        ESP_LOGI(TAG, "restored the screen from slot \"%s\"", DISPLAY_SLOT_CURRENT);
+    }
+    xSemaphoreGive(framebuffer_mutex);
+
+    while (true) {
+        xSemaphoreTake(framebuffer_mutex, portMAX_DELAY);
+        uint32_t idle_ms = epaper_get_idle_remaining_ms();
+        xSemaphoreGive(framebuffer_mutex);
+
+        // While the controller is awake, stop waiting in time to put it into deep sleep once it is idle; after that,
+        // in time to save the screen
+        uint32_t wait_ms = idle_ms != POWER_IDLE_NEVER ? idle_ms : display_save_due_ms();
+        TickType_t timeout = wait_ms == POWER_IDLE_NEVER ? portMAX_DELAY : pdMS_TO_TICKS(wait_ms) + 1;
+
+        if (xQueueReceive(display_queue, &item, timeout) != pdPASS) {
+            xSemaphoreTake(framebuffer_mutex, portMAX_DELAY);
+            epaper_sleep_if_idle();
+            // Saving only once a burst of updates is over, and not more often than DISPLAY_SAVE_INTERVAL_MS, keeps
+            // flash writes off the update path; slots_save() leaves out a screen that is still the one saved
+            if (epaper_get_idle_remaining_ms() == POWER_IDLE_NEVER && display_save_due_ms() == 0) {
+                display_save_slot_now(DISPLAY_SLOT_CURRENT);
+                current_dirty = false;
+                current_saved_ticks = xTaskGetTickCount();
+            }
+            xSemaphoreGive(framebuffer_mutex);
+            continue;
+        }
+
+        uint32_t last_ticket = item.ticket;
+        uint32_t count = 0;
+        bool refresh = false;
+
+        xSemaphoreTake(framebuffer_mutex, portMAX_DELAY);
+
+        // Drain everything that is already waiting so a burst of requests costs a single refresh
+        do {
+            display_apply_item(&item);
+            last_ticket = item.ticket;
+            refresh |= item.refresh;
+            count++;
+        } while (xQueueReceive(display_queue, &item, 0) == pdPASS);
+
+        if (refresh) {
+            ESP_LOGI(TAG, "batch of %lu item(s), refreshing", (unsigned long) count);
+            current_dirty = true;
+
+#if EPAPER_BANDED
+            if (scene_dirty) {
+                epaper_refresh_banded(display_render, dlist_has_red(&display_list), NULL);
+                scene_dirty = false;
+            }
+#else
+            epaper_refresh_damage();
+#endif
+        } else {
+            ESP_LOGI(TAG, "batch of %lu item(s) applied without refresh", (unsigned long) count);
+        }
+
+        xSemaphoreGive(framebuffer_mutex);
+
+        stats.batches++;
+        __atomic_store_n(&completed_ticket, last_ticket, __ATOMIC_RELEASE);
+
+        // Wake every waiter at once, then re-arm for the next batch
+        xEventGroupSetBits(display_events, DISPLAY_BATCH_DONE_BIT);
+        xEventGroupClearBits(display_events, DISPLAY_BATCH_DONE_BIT);
+    }
+}
+
+static void display_button1_press_cb()
+{
+    display_clear();
+}
+
+static void display_button2_press_cb()
+{
+    display_toggle_screen_color();
+}
+
+static void display_button3_press_cb()
+{
+    display_next_slot();
+}
+
+void display_create_task(TaskHandle_t* handle)
+{
+    display_queue = xQueueCreate(DISPLAY_QUEUE_SIZE, sizeof(display_queue_item));
+    submit_mutex = xSemaphoreCreateMutex();
+    display_events = xEventGroupCreate();
+    framebuffer_mutex = xSemaphoreCreateMutex();
+
+    // Before the HTTP server can list the slots
+    slots_init();
+
+    button_register_button1_press_cb(display_button1_press_cb);
+    button_register_button2_press_cb(display_button2_press_cb);
+    button_register_button3_press_cb(display_button3_press_cb);
+
+#if CONFIG_FREERTOS_UNICORE
+    xTaskCreate(display_task, "display_task", DISPLAY_TASK_STACK_SIZE, NULL, DISPLAY_TASK_PRIORITY, handle);
+#else
+    xTaskCreatePinnedToCore(display_task, "display_task", DISPLAY_TASK_STACK_SIZE, NULL, DISPLAY_TASK_PRIORITY, handle,
+        DISPLAY_TASK_CORE);
+#endif
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "layout.h"
+#include "shape.h"
+
+#ifndef ___DISPLAY_H
+#define ___DISPLAY_H
+
+// Longest text carried by a single draw command, excluding the terminator; 50 glyphs fill a 16 px wide row, a
+// text box takes a short paragraph
+#define DISPLAY_TEXT_MAX_LEN 127
+// Largest bitmap carried by a single draw command, in bytes: 32 x 32 pixels
+#define DISPLAY_BITMAP_MAX_SIZE (DISPLAY_TEXT_MAX_LEN + 1)
+// Most commands accepted in one batch
+#define DISPLAY_BATCH_MAX_COMMANDS 128
+
+// Slot the screen is saved to once the controller goes to sleep, and restored from at boot. Off by default: each
+// save erases and writes a whole frame
+#define DISPLAY_SLOT_CURRENT "current"
+#ifndef DISPLAY_SAVE_CURRENT
+#define DISPLAY_SAVE_CURRENT 0
+#endif
+// Least time between two saves to DISPLAY_SLOT_CURRENT; a screen changed sooner is saved once it has passed. At 10
+// minutes the two copies of the slot see at most 36 erases a day each
+#ifndef DISPLAY_SAVE_INTERVAL_MS
+#define DISPLAY_SAVE_INTERVAL_MS (10 * 60 * 1000)
+#endif
+
+typedef enum display_command_type {
+    DISPLAY_CMD_DRAW_TEXT,
+    DISPLAY_CMD_DRAW_TEXT_BOX,
+    DISPLAY_CMD_DRAW_LINE,
+    DISPLAY_CMD_DRAW_RUN,
+    DISPLAY_CMD_FILL_RECT,
+    DISPLAY_CMD_DRAW_BITMAP,
+    DISPLAY_CMD_DRAW_SHAPE,
+    DISPLAY_CMD_REMOVE, // removes the item with `id` from the screen
+    DISPLAY_CMD_CLEAR,
+    DISPLAY_CMD_SET_SCREEN_COLOR,
+    DISPLAY_CMD_TOGGLE_SCREEN_COLOR,
+    DISPLAY_CMD_DUMMY_SCREEN,
+    DISPLAY_CMD_REFRESH, // nothing to draw; refreshes whatever was written to the framebuffer directly
+    DISPLAY_CMD_SAVE_SLOT, // saves the screen to the flash slot named `text`, see slots.h
+    DISPLAY_CMD_SHOW_SLOT, // shows the slot named `text`, or the next one after the slot shown last with ""
+    DISPLAY_CMD_DELETE_SLOT,
+} display_command_type;
+
+typedef struct display_command {
+    display_command_type type;
+    // Drawing commands with an id replace the item drawn with the same id before; 0 = no id
+    uint16_t id;
+    uint16_t x;
+    uint16_t y;
+    uint16_t x2; // line end
+    uint16_t y2; // line end
+    uint16_t length; // run length, polygon points
+    uint16_t width; // text box, rectangle, bitmap, shape
+    uint16_t height; // text box, rectangle, bitmap, shape
+    LayoutOptions layout; // text box
+    // SHAPE_* type, SHAPE_FILLED, outline or line width and corner or circle radius of a shape
+    uint8_t shape;
+    uint8_t shape_flags;
+    uint8_t thickness;
+    uint16_t radius;
+    uint8_t color; // COLOR_* for drawing, SCREEN_WHITE/SCREEN_BLACK for the screen color
+    union {
+        char text[DISPLAY_TEXT_MAX_LEN + 1];
+        // (width + 7) / 8 byte rows, MSB first, 1 = drawn in `color`
+        uint8_t bitmap[DISPLAY_BITMAP_MAX_SIZE];
+        ShapePoint points[SHAPE_MAX_POINTS];
+    };
+} display_command;
+
+typedef struct display_stats {
+    uint32_t commands;
+    uint32_t batches;
+    uint32_t dropped;
+    // Items kept in the display list and the bytes they take
+    uint16_t items;
+    uint32_t list_bytes;
+    // Drawn without being kept because the list was full
+    uint32_t unlisted;
+} display_stats;
+
+void display_create_task(TaskHandle_t* handle);
+
+uint32_t display_submit(const display_command* command);
+uint32_t display_submit_wait(const display_command* command, bool refresh, uint32_t timeout_ms);
+uint32_t display_submit_batch(const display_command* commands, size_t count, bool refresh);
+uint32_t display_draw_text(const char* text, int x, int y);
+uint32_t display_draw_text_box(const char* text, int x, int y, int w, int h, const LayoutOptions* layout);
+uint32_t display_clear();
+uint32_t display_toggle_screen_color();
+uint32_t display_dummy_screen();
+uint32_t display_remove(uint16_t id);
+uint32_t display_save_slot(const char* name);
+uint32_t display_show_slot(const char* name);
+uint32_t display_next_slot();
+uint32_t display_delete_slot(const char* name);
+
+uint32_t display_refresh();
+
+bool display_lock_framebuffer(uint32_t timeout_ms);
+void display_unlock_framebuffer();
+void display_mark_written(int x, int y, int w, int h);
+
+bool display_is_done(uint32_t ticket);
+bool display_wait(uint32_t ticket, uint32_t timeout_ms);
+
+void display_get_stats(display_stats* stats);
+
+#endif
@@ -0,0 +1,389 @@
+#include <stdlib.h>
+#include <string.h>
+#include <sys/param.h>
+
+#include "band.h"
+#include "dlist.h"
+#include "epaper.h"
+#include "font.h"
+
+_Static_assert(sizeof(DisplayItem) % 4 == 0, "display items must keep the data after them aligned");
+
+static inline size_t dlist_item_size(const DisplayItem* item)
+{
+    return sizeof(DisplayItem) + ((item->length + 3) & ~3u);
+}
+
+static inline DisplayItem* dlist_first(const DisplayList* list)
+{
+    return list->size > 0 ? (DisplayItem*) list->data : NULL;
+}
+
+static inline uint32_t read_u32(const uint8_t* data)
+{
+    return data[0] | (data[1] << 8) | (data[2] << 16) | ((uint32_t) data[3] << 24);
+}
+
+static inline void write_u32(uint8_t* data, uint32_t value)
+{
+    data[0] = value;
+    data[1] = value >> 8;
+    data[2] = value >> 16;
+    data[3] = value >> 24;
+}
+
+/**
+ * Text has to end in a terminator and a bitmap needs all of its rows; `at` is where the item is stored.
+ */
+static bool dlist_item_valid(const DisplayItem* item, const uint8_t* at)
+{
+    switch (item->type) {
+    case DLIST_ITEM_TEXT:
+    case DLIST_ITEM_TEXT_BOX:
+        return item->length > 0 && at[sizeof(DisplayItem) + item->length - 1] == '\0';
+    case DLIST_ITEM_BITMAP:
+        return item->length >= (size_t) (item->width + 7) / 8 * item->height;
+    case DLIST_ITEM_SHAPE:
+        return item->length % sizeof(ShapePoint) == 0 && item->length / sizeof(ShapePoint) <= SHAPE_MAX_POINTS;
+    default:
+        return true;
+    }
+}
+
+/**
+ * Allocates room for `capacity` bytes of items; returns false when it cannot be allocated.
+ */
+bool dlist_init(DisplayList* list, size_t capacity)
+{
+    list->data = malloc(capacity);
+    list->capacity = list->data ? capacity : 0;
+    list->size = 0;
+    list->count = 0;
+
+    return list->data != NULL;
+}
+
+void dlist_clear(DisplayList* list)
+{
+    list->size = 0;
+    list->count = 0;
+}
+
+/**
+ * The screen area an item covers, clipped to the screen.
+ */
+static void dlist_item_bounds(const DisplayItem* item, Rect* bounds)
+{
+    const Font* font = &font_jetbrains_mono_16x24;
+    uint32_t x = item->x;
+    uint32_t y = item->y;
+    uint32_t w = item->width;
+    uint32_t h = item->height;
+
+    switch (item->type) {
+    case DLIST_ITEM_TEXT: {
+        const char* text = (const char*) dlist_item_data(item);
+
+        w = layout_measure(font, text, strlen(text));
+        h = font->line_height;
+        break;
+    }
+    case DLIST_ITEM_LINE:
+        x = MIN(item->x, item->x2);
+        y = MIN(item->y, item->y2);
+        w = abs(item->x2 - item->x) + 1;
+        h = abs(item->y2 - item->y) + 1;
+        break;
+    case DLIST_ITEM_DUMMY:
+        x = 0;
+        y = 0;
+        w = DISPLAY_WIDTH;
+        h = DISPLAY_HEIGHT;
+        break;
+    case DLIST_ITEM_SHAPE: {
+        Shape shape;
+
+        dlist_item_shape(item, &shape);
+        shape_bounds(&shape, bounds);
+        x = bounds->x;
+        y = bounds->y;
+        w = bounds->w;
+        h = bounds->h;
+        break;
+    }
+    default:
+        break;
+    }
+
+    if (x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT) {
+        *bounds = (Rect) { 0 };
+        return;
+    }
+
+    *bounds = (Rect) { .x = x, .y = y, .w = MIN(w, DISPLAY_WIDTH - x), .h = MIN(h, DISPLAY_HEIGHT - y) };
+}
+
+/**
+ * The shape a DLIST_ITEM_SHAPE item draws; its points stay in the list.
+ */
+void dlist_item_shape(const DisplayItem* item, Shape* shape)
+{
+    *shape = (Shape) {
+        .type = item->shape,
+        .flags = item->shape_flags,
+        .thickness = item->thickness,
+        .x = item->x,
+        .y = item->y,
+        .x2 = item->x2,
+        .y2 = item->y2,
+        .width = item->width,
+        .height = item->height,
+        .radius = item->radius,
+        .points = (const ShapePoint*) dlist_item_data(item),
+        .count = item->length / sizeof(ShapePoint),
+    };
+}
+
+/**
+ * Adds an item on top of the others, or replaces the one with the same non-zero id where it is, keeping its
+ * place in the drawing order. `data` holds item->length bytes and the item's bounds are filled in.
+ *
+ * `replaced` receives the area the replaced item covered, empty when the item is new. Returns false, leaving the
+ * list as it was, when there is no room for the item.
+ */
+bool dlist_put(DisplayList* list, const DisplayItem* item, const void* data, Rect* replaced)
+{
+    DisplayItem* old = item->id ? (DisplayItem*) dlist_find(list, item->id) : NULL;
+    size_t size = dlist_item_size(item);
+    size_t old_size = old ? dlist_item_size(old) : 0;
+    uint8_t* at = old ? (uint8_t*) old : list->data + list->size;
+
+    *replaced = old ? old->bounds : (Rect) { 0 };
+
+    if (list->size - old_size + size > list->capacity) {
+        return false;
+    }
+
+    // Shift the items above into place when the size changes
+    if (old && size != old_size) {
+        memmove(at + size, at + old_size, list->data + list->size - (at + old_size));
+    }
+
+    DisplayItem* stored = (DisplayItem*) at;
+
+    *stored = *item;
+    memcpy(stored + 1, data, item->length);
+    dlist_item_bounds(stored, &stored->bounds);
+
+    list->size = list->size - old_size + size;
+    if (!old) {
+        list->count++;
+    }
+
+    return true;
+}
+
+/**
+ * Removes the item with `id`; `removed` receives the area it covered. Returns false when there is no such item.
+ */
+bool dlist_remove(DisplayList* list, uint16_t id, Rect* removed)
+{
+    DisplayItem* item = id ? (DisplayItem*) dlist_find(list, id) : NULL;
+
+    if (!item) {
+        return false;
+    }
+
+    size_t size = dlist_item_size(item);
+    uint8_t* at = (uint8_t*) item;
+
+    *removed = item->bounds;
+    memmove(at, at + size, list->data + list->size - (at + size));
+    list->size -= size;
+    list->count--;
+
+    return true;
+}
+
+const DisplayItem* dlist_find(const DisplayList* list, uint16_t id)
+{
+    for (const DisplayItem* item = dlist_first(list); item; item = dlist_next(list, item)) {
+        if (item->id == id) {
+            return item;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Returns the item after `item` in drawing order, or the first one when `item` is NULL; NULL at the end.
+ */
+const DisplayItem* dlist_next(const DisplayList* list, const DisplayItem* item)
+{
+    if (!item) {
+        return dlist_first(list);
+    }
+
+    const uint8_t* next = (const uint8_t*) item + dlist_item_size(item);
+
+    return next < list->data + list->size ? (const DisplayItem*) next : NULL;
+}
+
+/**
+ * Records that `area` of the framebuffer no longer shows what the list describes. A mark on top of the list grows
+ * to take it in; when there is no room for a new one the list is cleared and the whole screen is marked.
+ */
+void dlist_mark_unlisted(DisplayList* list, const Rect* area)
+{
+    DisplayItem mark = {
+        .type = DLIST_ITEM_UNLISTED, .x = area->x, .y = area->y, .width = area->w, .height = area->h
+    };
+    const DisplayItem* top = NULL;
+    Rect replaced;
+
+    for (const DisplayItem* item = dlist_first(list); item; item = dlist_next(list, item)) {
+        top = item;
+    }
+
+    if (top && top->type == DLIST_ITEM_UNLISTED) {
+        DisplayItem* grown = (DisplayItem*) top;
+
+        rect_union(&grown->bounds, area, &grown->bounds);
+        grown->x = grown->bounds.x;
+        grown->y = grown->bounds.y;
+        grown->width = grown->bounds.w;
+        grown->height = grown->bounds.h;
+        return;
+    }
+
+    // A mark has no data
+    if (!dlist_put(list, &mark, "", &replaced)) {
+        mark = (DisplayItem) { .type = DLIST_ITEM_UNLISTED, .width = DISPLAY_WIDTH, .height = DISPLAY_HEIGHT };
+        dlist_clear(list);
+        dlist_put(list, &mark, "", &replaced);
+    }
+}
+
+/**
+ * Whether `area` overlaps one of the marks of dlist_mark_unlisted(), i.e. redrawing it from the list would wipe
+ * pixels the list does not know.
+ */
+bool dlist_overlaps_unlisted(const DisplayList* list, const Rect* area)
+{
+    for (const DisplayItem* item = dlist_first(list); item; item = dlist_next(list, item)) {
+        Rect overlap;
+
+        if (item->type == DLIST_ITEM_UNLISTED && rect_intersect(&item->bounds, area, &overlap)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Whether any item draws in red; without red the red plane does not need to be rendered.
+ */
+bool dlist_has_red(const DisplayList* list)
+{
+    for (const DisplayItem* item = dlist_first(list); item; item = dlist_next(list, item)) {
+        if (item->color == COLOR_RED && item->type != DLIST_ITEM_DUMMY) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Renders `plane` of the rows `band` holds by replaying the list in order on a white band. With a `clip`, only
+ * the items that overlap it are drawn, so only the pixels inside it are complete.
+ */
+void dlist_render(const DisplayList* list, const Raster* band, uint8_t plane, const Rect* clip)
+{
+    Rect rows = { .x = 0, .y = band->top, .w = band->width, .h = band->height };
+
+    memset(band->buffer, 0xff, (size_t) band->height * band->stride);
+
+    if (clip && !rect_intersect(&rows, clip, &rows)) {
+        return;
+    }
+
+    for (const DisplayItem* item = dlist_first(list); item; item = dlist_next(list, item)) {
+        Rect overlap;
+
+        if (rect_intersect(&item->bounds, &rows, &overlap)) {
+            band_render_item(item, band, plane);
+        }
+    }
+}
+
+size_t dlist_serialized_size(const DisplayList* list)
+{
+    return DLIST_HEADER_SIZE + list->size;
+}
+
+/**
+ * Writes the list to `out` in the format dlist_deserialize() reads; returns the number of bytes written, 0 when
+ * `size` is too small.
+ *
+ * Items are stored as they are in memory, so the format is only read back by the same firmware build.
+ */
+size_t dlist_serialize(const DisplayList* list, uint8_t* out, size_t size)
+{
+    if (size < dlist_serialized_size(list)) {
+        return 0;
+    }
+
+    out[0] = DLIST_MAGIC_0;
+    out[1] = DLIST_MAGIC_1;
+    out[2] = DLIST_VERSION;
+    out[3] = 0;
+    write_u32(out + 4, list->size);
+    memcpy(out + DLIST_HEADER_SIZE, list->data, list->size);
+
+    return dlist_serialized_size(list);
+}
+
+/**
+ * Replaces the items of `list` with a serialized list. Returns false, leaving the list empty, when the data is
+ * malformed or does not fit.
+ */
+bool dlist_deserialize(DisplayList* list, const uint8_t* data, size_t size)
+{
+    dlist_clear(list);
+
+    if (size < DLIST_HEADER_SIZE || data[0] != DLIST_MAGIC_0 || data[1] != DLIST_MAGIC_1
+        || data[2] != DLIST_VERSION) {
+        return false;
+    }
+
+    uint32_t length = read_u32(data + 4);
+
+    if (length > size - DLIST_HEADER_SIZE || length > list->capacity) {
+        return false;
+    }
+
+    // Check every item before taking them so a truncated one cannot send dlist_next() past the end
+    for (uint32_t offset = 0; offset < length; list->count++) {
+        const uint8_t* at = data + DLIST_HEADER_SIZE + offset;
+        DisplayItem item;
+
+        if (length - offset < sizeof(DisplayItem)) {
+            dlist_clear(list);
+            return false;
+        }
+        memcpy(&item, at, sizeof(item));
+        offset += dlist_item_size(&item);
+        if (offset > length || !dlist_item_valid(&item, at)) {
+            dlist_clear(list);
+            return false;
+        }
+    }
+
+    memcpy(list->data, data + DLIST_HEADER_SIZE, length);
+    list->size = length;
+
+    return true;
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "damage.h"
+#include "layout.h"
+#include "raster.h"
+#include "shape.h"
+
+#ifndef ___DLIST_H
+#define ___DLIST_H
+
+// Serialized lists start with 'D' 'L', the version and a reserved byte, then the item data's length (u32)
+#define DLIST_MAGIC_0 'D'
+#define DLIST_MAGIC_1 'L'
+#define DLIST_VERSION 2
+#define DLIST_HEADER_SIZE 8
+
+#define DLIST_ITEM_TEXT 1
+#define DLIST_ITEM_TEXT_BOX 2
+#define DLIST_ITEM_LINE 3
+// A 1 px high fill of `width` pixels
+#define DLIST_ITEM_RUN 4
+#define DLIST_ITEM_FILL 5
+// `height` rows of (width + 7) / 8 bytes, MSB first; 1 bits are drawn in the item's color, 0 bits white
+#define DLIST_ITEM_BITMAP 6
+// The test pattern of epaper_draw_dummy(), covering the whole screen
+#define DLIST_ITEM_DUMMY 7
+// A Shape; polygon points follow the item
+#define DLIST_ITEM_SHAPE 8
+// Marks the `width` x `height` area at `x`, `y` as written to the framebuffer directly, like an uploaded frame or
+// an item that did not fit into the list: the list cannot redraw it, so it draws nothing and nothing under it may
+// be redrawn in place
+#define DLIST_ITEM_UNLISTED 9
+
+/**
+ * One retained primitive, followed in the list by `length` bytes of data: NUL-terminated UTF-8 text, or bitmap
+ * rows. Items are drawn in list order with the built-in 16x24 font.
+ */
+typedef struct DisplayItem {
+    // 0 for items that cannot be addressed later
+    uint16_t id;
+    uint8_t type;
+    uint8_t color;
+    uint16_t x;
+    uint16_t y;
+    uint16_t x2; // line end
+    uint16_t y2; // line end
+    uint16_t width; // run, fill, bitmap, text box and shape size
+    uint16_t height;
+    LayoutOptions layout; // text box
+    uint16_t length;
+    // Screen area the item covers, set when it is added
+    Rect bounds;
+    // SHAPE_* type, flags, outline width and corner or circle radius of a shape
+    uint8_t shape;
+    uint8_t shape_flags;
+    uint8_t thickness;
+    uint16_t radius;
+} DisplayItem;
+
+/**
+ * Items packed back to back in one buffer, each padded to 4 bytes; the buffer is also the serialized form.
+ */
+typedef struct DisplayList {
+    uint8_t* data;
+    size_t size;
+    size_t capacity;
+    uint16_t count;
+} DisplayList;
+
+bool dlist_init(DisplayList* list, size_t capacity);
+void dlist_clear(DisplayList* list);
+
+bool dlist_put(DisplayList* list, const DisplayItem* item, const void* data, Rect* replaced);
+bool dlist_remove(DisplayList* list, uint16_t id, Rect* removed);
+const DisplayItem* dlist_find(const DisplayList* list, uint16_t id);
+const DisplayItem* dlist_next(const DisplayList* list, const DisplayItem* item);
+void dlist_mark_unlisted(DisplayList* list, const Rect* area);
+bool dlist_overlaps_unlisted(const DisplayList* list, const Rect* area);
+
+static inline const uint8_t* dlist_item_data(const DisplayItem* item)
+{
+    return (const uint8_t*) (item + 1);
+}
+
+void dlist_item_shape(const DisplayItem* item, Shape* shape);
+
+bool dlist_has_red(const DisplayList* list);
+void dlist_render(const DisplayList* list, const Raster* band, uint8_t plane, const Rect* clip);
+
+size_t dlist_serialized_size(const DisplayList* list);
+size_t dlist_serialize(const DisplayList* list, uint8_t* out, size_t size);
+bool dlist_deserialize(DisplayList* list, const uint8_t* data, size_t size);
+
+#endif
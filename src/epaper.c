@@ -1,18 +1,31 @@
+#include <stdbool.h>
+#include <stdlib.h>
 #include <string.h>
+#include <sys/param.h>
 
 #include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
 #include "freertos/task.h"
 
 #include "driver/gpio.h"
 #include "driver/spi_common.h"
 #include "driver/spi_master.h"
 
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
 #include "esp_log.h"
+#include "esp_rom_sys.h"
+#include "esp_timer.h"
 
-#include "button.h"
+#include "band.h"
+#include "damage.h"
+#include "diff.h"
 #include "epaper.h"
 #include "font.h"
-#include "http.h"
+#include "layout.h"
+#include "metrics.h"
+#include "power.h"
+#include "raster.h"
 
 static const char* TAG = "epaper.c";
 
@@ -21,16 +34,98 @@ static const char* TAG = "epaper.c";
 #define SPI_SCLK_PIN 18
 #define DC_PIN 19
 #define RESET_PIN 16
-
-#define DISPLAY_WIDTH 800
-#define DISPLAY_HEIGHT 480
-#define DISPLAY_BUFFER_SIZE (DISPLAY_WIDTH * DISPLAY_HEIGHT / 8)
-
-static uint8_t epaper_buffer[DISPLAY_BUFFER_SIZE];
+// BUSY_N of the UC8179; held low while the controller is busy
+#define BUSY_PIN 4
+
+// Panel setting (0x00): KWR (black/white/red) mode with the LUT from OTP; KW-3f, KWR-2F, BWROTP 0f, BWOTP 1f
+#define EPAPER_PANEL_SETTING_BWR 0x0f
+
+// Longest a single BUSY wait may take; a full BWR refresh takes roughly 15 s
+#define EPAPER_BUSY_TIMEOUT_MS 30000
+
+// Power-up sequence after a reset: 1 for the enhanced drive of epaper_init_fast(), 0 for epaper_init()
+#ifndef EPAPER_FAST_INIT
+#define EPAPER_FAST_INIT 1
+#endif
+
+// Changed area, in percent of the screen, from which a full refresh is used instead of a partial one
+#define EPAPER_FULL_REFRESH_PERCENT 50
+
+#define SPI_CLOCK_SPEED_HZ 12000000
+// Bulk data is streamed as queued DMA transactions of this size; a full plane is 12 transactions
+#define SPI_DMA_CHUNK_SIZE 4000
+// Number of chunk buffers/transactions in flight; the next chunk is filled while the previous one is on the wire
+#define SPI_QUEUE_SIZE 2
+
+// Banded frames are rendered straight into the chunks, 40 rows at a time
+_Static_assert(SPI_DMA_CHUNK_SIZE % DISPLAY_STRIDE == 0, "a chunk must hold whole rows");
+// Rows epaper_render_area() renders at a time, into an SPI buffer
+#define EPAPER_BAND_ROWS (SPI_DMA_CHUNK_SIZE / DISPLAY_STRIDE)
+
+// Banded frames are rendered into the SPI chunks while they are sent instead, see epaper_refresh_banded()
+#if !EPAPER_BANDED
+static uint8_t epaper_buffer[DISPLAY_BUFFER_SIZE] __attribute__((aligned(4)));
+#endif
+// Same layout as epaper_buffer with 0 = red, inverted on the way out; allocated with the first red pixel
+static uint8_t* red_buffer;
+// No red pixel in red_buffer (or no red_buffer); the red plane is then zero-filled or skipped, never read
+static bool red_plane_empty = true;
+#if !EPAPER_BANDED
+// Red pixels changed since the last commit; the frame diff only covers the black/white plane
+static bool red_plane_dirty = false;
+#endif
+// The controller's red RAM is known to be all zero, so an empty red plane does not need to be sent at all
+static bool controller_red_clear = false;
 static uint8_t screen_color = SCREEN_WHITE;
 static spi_device_handle_t spi_device;
 
-static void spi_init()
+static uint8_t* spi_dma_chunks[SPI_QUEUE_SIZE];
+static spi_transaction_t spi_dma_trans[SPI_QUEUE_SIZE];
+static epaper_spi_stats spi_stats;
+
+static SemaphoreHandle_t busy_semaphore;
+static uint32_t busy_timeout_ms = EPAPER_BUSY_TIMEOUT_MS;
+static epaper_busy_stats busy_stats;
+
+static power_machine power;
+static uint32_t idle_timeout_ms = EPAPER_IDLE_SLEEP_MS;
+
+static DamageList damage;
+// False until a full frame has been sent; a reset, and so a wake from deep sleep, clears controller RAM
+static bool controller_ram_synced = false;
+
+// False when the last committed frame could not be allocated; every refresh is then sent
+static bool diff_enabled = false;
+static epaper_refresh_stats refresh_stats;
+
+/**
+ * Fills `chunk` with `length` bytes of a data stream starting at `offset`.
+ */
+typedef void (*epaper_fill_chunk_fn)(uint8_t* chunk, uint32_t offset, uint32_t length, void* ctx);
+
+/**
+ * Allocates whichever DMA chunk is still missing; false while any is, since data streams need all of them. The
+ * controller init fails then, and the next use tries again.
+ */
+static bool spi_alloc_chunks()
+{
+    bool ok = true;
+
+    for (uint8_t i = 0; i < SPI_QUEUE_SIZE; i++) {
+        if (!spi_dma_chunks[i]) {
+            spi_dma_chunks[i] = heap_caps_malloc(SPI_DMA_CHUNK_SIZE, MALLOC_CAP_DMA);
+        }
+        ok = ok && spi_dma_chunks[i];
+    }
+
+    if (!ok) {
+        ESP_LOGE(TAG, "failed to allocate SPI DMA buffer");
+    }
+
+    return ok;
+}
+
+static bool spi_init()
 {
     gpio_config_t io_conf = { .pin_bit_mask = (1ULL << SPI_CS_PIN) | (1ULL << RESET_PIN) | (1ULL << DC_PIN),
         .mode = GPIO_MODE_OUTPUT,
@@ -49,16 +144,16 @@ static void spi_init()
         .miso_io_num = -1,
         .quadwp_io_num = -1,
         .quadhd_io_num = -1,
-        .max_transfer_sz = 0,
+        .max_transfer_sz = SPI_DMA_CHUNK_SIZE,
         .flags = 0,
     };
 
     spi_device_interface_config_t dev_config = {
-        .clock_speed_hz = 12000000,
+        .clock_speed_hz = SPI_CLOCK_SPEED_HZ,
         // Manual CS control through gpio
         .spics_io_num = -1,
         .mode = 0,
-        .queue_size = 1,
+        .queue_size = SPI_QUEUE_SIZE,
         .command_bits = 0,
         .address_bits = 0,
         .flags = SPI_DEVICE_NO_DUMMY,
@@ -67,7 +162,51 @@ static void spi_init()
     spi_bus_initialize(SPI2_HOST, &spi_bus_config, SPI_DMA_CH_AUTO);
     spi_bus_add_device(SPI2_HOST, &dev_config, &spi_device);
 
+    if (!spi_alloc_chunks()) {
+        return false;
+    }
+
     ESP_LOGI(TAG, "SPI initialized.");
+
+    return true;
+}
+
+static void IRAM_ATTR busy_release_handler(void* args)
+{
+    BaseType_t higher_priority_task_woken = pdFALSE;
+
+    xSemaphoreGiveFromISR(busy_semaphore, &higher_priority_task_woken);
+
+    if (higher_priority_task_woken) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+static void busy_init()
+{
+    if (busy_semaphore) {
+        return;
+    }
+
+    busy_semaphore = xSemaphoreCreateBinary();
+
+    gpio_config_t io_conf = { .pin_bit_mask = (1ULL << BUSY_PIN),
+        .mode = GPIO_MODE_INPUT,
+        .pull_up_en = GPIO_PULLUP_DISABLE,
+        .pull_down_en = GPIO_PULLDOWN_DISABLE,
+        .intr_type = GPIO_INTR_POSEDGE }; // BUSY_N rising edge: controller became idle
+
+    gpio_config(&io_conf);
+
+    // The button task may have installed the ISR service already
+    esp_err_t err = gpio_install_isr_service(0);
+    if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) {
+        ESP_LOGE(TAG, "gpio_install_isr_service failed: %s", esp_err_to_name(err));
+    }
+
+    gpio_isr_handler_add(BUSY_PIN, busy_release_handler, NULL);
+
+    ESP_LOGI(TAG, "BUSY pin initialized.");
 }
 
 static inline void cs_select()
@@ -118,7 +257,9 @@ static void epaper_write_command(uint8_t command)
     cs_select();
     dc_command();
 
-    spi_device_transmit(spi_device, &trans);
+    spi_device_polling_transmit(spi_device, &trans);
+    spi_stats.transactions++;
+    spi_stats.bytes++;
 
     cs_deselect();
 }
@@ -136,30 +277,327 @@ static void epaper_write_data(uint8_t data)
     cs_select();
     dc_data();
 
-    spi_device_transmit(spi_device, &trans);
+    spi_device_polling_transmit(spi_device, &trans);
+    spi_stats.transactions++;
+    spi_stats.bytes++;
+
+    cs_deselect();
+}
+
+/**
+ * Streams `length` bytes of data in SPI_DMA_CHUNK_SIZE transactions under a single CS/DC assertion.
+ *
+ * Up to SPI_QUEUE_SIZE transactions are queued at once, so `fill` prepares the next chunk while the
+ * previous one is still being clocked out by DMA.
+ */
+static void epaper_write_data_stream(uint32_t length, epaper_fill_chunk_fn fill, void* ctx)
+{
+    spi_transaction_t* done;
+    uint32_t offset = 0;
+    uint8_t in_flight = 0;
+    uint8_t slot = 0;
+
+    cs_select();
+    dc_data();
+
+    while (offset < length) {
+        // Results come back in queue order, so the oldest transaction owns the slot we are about to reuse
+        if (in_flight == SPI_QUEUE_SIZE) {
+            spi_device_get_trans_result(spi_device, &done, portMAX_DELAY);
+            in_flight--;
+        }
+
+        uint32_t chunk_length = MIN(length - offset, SPI_DMA_CHUNK_SIZE);
+        fill(spi_dma_chunks[slot], offset, chunk_length, ctx);
+
+        spi_transaction_t* trans = &spi_dma_trans[slot];
+        memset(trans, 0, sizeof(*trans));
+        trans->length = chunk_length * 8;
+        trans->tx_buffer = spi_dma_chunks[slot];
+
+        spi_device_queue_trans(spi_device, trans, portMAX_DELAY);
+        spi_stats.transactions++;
+        spi_stats.bytes += chunk_length;
+
+        in_flight++;
+        slot = (slot + 1) % SPI_QUEUE_SIZE;
+        offset += chunk_length;
+    }
+
+    while (in_flight > 0) {
+        spi_device_get_trans_result(spi_device, &done, portMAX_DELAY);
+        in_flight--;
+    }
 
     cs_deselect();
 }
 
-static void epaper_check_status()
+/**
+ * Byte-aligned rectangle of a plane streamed row by row, optionally inverted for the black screen.
+ */
+typedef struct epaper_window {
+    const uint8_t* buffer;
+    uint16_t x_byte;
+    uint16_t y;
+    uint16_t width_bytes;
+    uint16_t height;
+    bool invert;
+} epaper_window;
+
+static void invert_chunk(uint8_t* chunk, uint32_t length)
+{
+    uint32_t i = 0;
+
+    // Chunk buffers come from heap_caps_malloc() and are word aligned
+    for (; i + 4 <= length; i += 4) {
+        *(uint32_t*) (chunk + i) = ~*(uint32_t*) (chunk + i);
+    }
+    for (; i < length; i++) {
+        chunk[i] = ~chunk[i];
+    }
+}
+
+#if !EPAPER_BANDED
+static void fill_chunk_window(uint8_t* chunk, uint32_t offset, uint32_t length, void* ctx)
+{
+    const epaper_window* window = (const epaper_window*) ctx;
+
+    if (window->width_bytes == DISPLAY_WIDTH / 8) {
+        // Full-width windows are contiguous in the framebuffer
+        memcpy(chunk, window->buffer + window->y * (DISPLAY_WIDTH / 8) + offset, length);
+    } else {
+        uint8_t* dst = chunk;
+        uint32_t remaining = length;
+
+        while (remaining > 0) {
+            uint32_t row = offset / window->width_bytes;
+            uint32_t column = offset % window->width_bytes;
+            uint32_t n = MIN(remaining, window->width_bytes - column);
+
+            memcpy(dst, window->buffer + (window->y + row) * (DISPLAY_WIDTH / 8) + window->x_byte + column, n);
+
+            dst += n;
+            offset += n;
+            remaining -= n;
+        }
+    }
+
+    if (window->invert) {
+        invert_chunk(chunk, length);
+    }
+}
+#endif
+
+/**
+ * A frame rendered band by band into the chunks as they are filled.
+ */
+typedef struct epaper_band_stream {
+    epaper_band_fn render;
+    void* ctx;
+    uint8_t plane;
+    bool invert;
+} epaper_band_stream;
+
+static void fill_chunk_band(uint8_t* chunk, uint32_t offset, uint32_t length, void* ctx)
+{
+    const epaper_band_stream* stream = (const epaper_band_stream*) ctx;
+    Raster band = {
+        .buffer = chunk,
+        .width = DISPLAY_WIDTH,
+        .height = length / DISPLAY_STRIDE,
+        .stride = DISPLAY_STRIDE,
+        .top = offset / DISPLAY_STRIDE,
+    };
+
+    stream->render(&band, stream->plane, stream->ctx);
+
+    if (stream->invert) {
+        invert_chunk(chunk, length);
+    }
+}
+
+static void fill_chunk_zero(uint8_t* chunk, uint32_t offset, uint32_t length, void* ctx)
+{
+    memset(chunk, 0x00, length);
+}
+
+void epaper_get_spi_stats(epaper_spi_stats* stats)
+{
+    *stats = spi_stats;
+}
+
+void epaper_reset_spi_stats()
+{
+    memset(&spi_stats, 0, sizeof(spi_stats));
+}
+
+/**
+ * Blocks until the controller releases BUSY_N or `timeout_ms` elapses.
+ */
+static esp_err_t epaper_wait_busy(uint32_t timeout_ms)
+{
+    int64_t start = esp_timer_get_time();
+    int64_t deadline = start + (int64_t) timeout_ms * 1000;
+    esp_err_t err = ESP_OK;
+
+    // Drop an edge left over from a previous operation before sampling the line
+    xSemaphoreTake(busy_semaphore, 0);
+
+    while (gpio_get_level(BUSY_PIN) == 0) {
+        int64_t remaining = deadline - esp_timer_get_time();
+        if (remaining <= 0) {
+            err = ESP_ERR_TIMEOUT;
+            break;
+        }
+
+        // Round up so a sub-tick remainder still waits one tick
+        xSemaphoreTake(busy_semaphore, (remaining / 1000 + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS);
+    }
+
+    uint32_t waited_us = (uint32_t) (esp_timer_get_time() - start);
+
+    metrics_record(METRICS_PHASE_BUSY, start);
+    busy_stats.waits++;
+    busy_stats.last_wait_us = waited_us;
+    busy_stats.total_wait_us += waited_us;
+    if (waited_us > busy_stats.max_wait_us) {
+        busy_stats.max_wait_us = waited_us;
+    }
+    if (err != ESP_OK) {
+        busy_stats.timeouts++;
+    }
+
+    return err;
+}
+
+static esp_err_t epaper_check_status()
+{
+    esp_err_t err = epaper_wait_busy(busy_timeout_ms);
+
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "BUSY wait timed out after %lu ms", (unsigned long) busy_timeout_ms);
+    } else {
+        ESP_LOGD(TAG, "BUSY released after %lu us", (unsigned long) busy_stats.last_wait_us);
+    }
+
+    return err;
+}
+
+void epaper_set_busy_timeout(uint32_t timeout_ms)
+{
+    busy_timeout_ms = timeout_ms;
+}
+
+void epaper_get_busy_stats(epaper_busy_stats* stats)
+{
+    *stats = busy_stats;
+}
+
+#if !EPAPER_BANDED
+/**
+ * Returns the color to draw with: COLOR_RED once the red plane exists, COLOR_BLACK when it cannot be allocated.
+ */
+static uint8_t epaper_use_color(uint8_t color)
+{
+    if (color != COLOR_RED) {
+        return color == COLOR_WHITE ? COLOR_WHITE : COLOR_BLACK;
+    }
+
+    if (!red_buffer) {
+        red_buffer = malloc(DISPLAY_BUFFER_SIZE);
+        if (!red_buffer) {
+            ESP_LOGE(TAG, "failed to allocate the red plane, drawing red as black");
+            return COLOR_BLACK;
+        }
+        memset(red_buffer, 0xff, DISPLAY_BUFFER_SIZE);
+    }
+
+    red_plane_empty = false;
+    red_plane_dirty = true;
+
+    return COLOR_RED;
+}
+
+/**
+ * Whether anything is drawn in red, so that black and white drawing may have red pixels to clear underneath.
+ */
+static inline bool epaper_red_in_use()
+{
+    return !red_plane_empty;
+}
+
+/**
+ * Whether the byte-aligned area around the rectangle holds a red pixel, i.e. whether clearing red there changes
+ * the red plane.
+ */
+static bool epaper_red_in_area(int32_t x, int32_t y, int32_t w, int32_t h)
 {
-    // TODO: checkstatus
-    vTaskDelay(pdMS_TO_TICKS(100));
+    if (red_plane_empty) {
+        return false;
+    }
+
+    int32_t x_end = MIN(x + w, DISPLAY_WIDTH);
+    int32_t y_end = MIN(y + h, DISPLAY_HEIGHT);
+
+    x = MAX(x, 0);
+    y = MAX(y, 0);
+
+    for (int32_t row = y; row < y_end; row++) {
+        const uint8_t* bytes = red_buffer + row * DISPLAY_STRIDE;
+
+        for (int32_t i = x / 8; i < (x_end + 7) / 8; i++) {
+            if (bytes[i] != 0xff) {
+                return true;
+            }
+        }
+    }
+
+    return false;
 }
+#endif
 
-void epaper_init()
+static void epaper_clear_planes()
 {
+#if !EPAPER_BANDED
     memset(epaper_buffer, 0xff, DISPLAY_BUFFER_SIZE);
 
-    spi_init();
-    vTaskDelay(pdMS_TO_TICKS(10));
+    if (!red_plane_empty) {
+        memset(red_buffer, 0xff, DISPLAY_BUFFER_SIZE);
+        red_plane_empty = true;
+        red_plane_dirty = true;
+    }
+#endif
+}
+
+static void epaper_diff_init()
+{
+    // A banded frame is never held in memory, so there is nothing to diff
+    diff_enabled = !EPAPER_BANDED && diff_init(DISPLAY_WIDTH / 8, DISPLAY_HEIGHT);
+    refresh_stats.diff_memory_bytes = diff_enabled ? diff_memory_usage() : 0;
+}
+
+/**
+ * Power-up sequence of the datasheet, with the LUT from OTP; starts with a hardware reset, which clears controller
+ * RAM.
+ */
+static bool epaper_init(void* ctx)
+{
+    int64_t start = metrics_now();
+    bool ok;
 
     ESP_LOGI(TAG, "epaper init...");
 
+    if (!spi_alloc_chunks()) {
+        return false;
+    }
+
+    controller_ram_synced = false;
+    controller_red_clear = false;
+
     epaper_reset();
     vTaskDelay(pdMS_TO_TICKS(10));
 
-    epaper_check_status();
+    ok = epaper_check_status() == ESP_OK;
 
     epaper_write_command(0x01); // Power setting
     epaper_write_data(0x07);
@@ -175,10 +613,10 @@ void epaper_init()
 
     epaper_write_command(0x04); // Power on
 
-    epaper_check_status();
+    ok &= epaper_check_status() == ESP_OK;
 
     epaper_write_command(0x00); // Panel setting
-    epaper_write_data(0x0f); // KW-3f, KWR-2F, BWROTP 0f, BWOTP 1f
+    epaper_write_data(EPAPER_PANEL_SETTING_BWR);
 
     epaper_write_command(0x61); // Resolution setting
     epaper_write_data(DISPLAY_WIDTH / 256);
@@ -196,31 +634,40 @@ void epaper_init()
     epaper_write_command(0x60); // TCON setting
     epaper_write_data(0x22);
 
+    metrics_record(METRICS_PHASE_INIT, start);
     ESP_LOGI(TAG, "epaper init done.");
+
+    return ok;
 }
 
-void epaper_init_fast()
+/**
+ * Power-up sequence with the enhanced drive for faster refreshes; starts with a hardware reset like epaper_init().
+ */
+static bool epaper_init_fast(void* ctx)
 {
-    memset(epaper_buffer, 0xff, DISPLAY_BUFFER_SIZE);
-
-    spi_init();
-    vTaskDelay(pdMS_TO_TICKS(10));
+    int64_t start = metrics_now();
+    bool ok;
 
     ESP_LOGI(TAG, "epaper init (fast)...");
 
+    if (!spi_alloc_chunks()) {
+        return false;
+    }
+
+    controller_ram_synced = false;
+    controller_red_clear = false;
+
     epaper_reset();
     vTaskDelay(pdMS_TO_TICKS(10));
 
-    epaper_check_status();
+    ok = epaper_check_status() == ESP_OK;
 
     epaper_write_command(0x00); // Panel setting
-    epaper_write_data(0x0F); // KW-3f, KWR-2F, BWROTP 0f, BWOTP 1f
+    epaper_write_data(EPAPER_PANEL_SETTING_BWR);
 
     epaper_write_command(0x04); // Power on
 
-    vTaskDelay(pdMS_TO_TICKS(100));
-
-    epaper_check_status();
+    ok &= epaper_check_status() == ESP_OK;
 
     // Enhanced display drive(Add 0x06 command)
     epaper_write_command(0x06); // Booster Soft Start
@@ -238,44 +685,569 @@ void epaper_init_fast()
     epaper_write_data(0x11);
     epaper_write_data(0x07);
 
+    metrics_record(METRICS_PHASE_INIT, start);
     ESP_LOGI(TAG, "epaper init (fast) done.");
+
+    return ok;
 }
 
-static void epaper_update(void)
+static bool epaper_power_on(void* ctx)
 {
-    epaper_write_command(0x12); // Display refresh
-    vTaskDelay(pdMS_TO_TICKS(1)); // !!!The delay here is necessary, 200uS at least!!!
+    epaper_write_command(0x50); // VCOM and data interval setting, as before power off
+    epaper_write_data(0x11);
+    epaper_write_data(0x07);
 
-    epaper_check_status();
+    epaper_write_command(0x04); // Power on
+
+    return epaper_check_status() == ESP_OK;
 }
 
-void epaper_deep_sleep(void)
+static bool epaper_power_off(void* ctx)
 {
     epaper_write_command(0x50); // VCOM AND DATA INTERVAL SETTING
     epaper_write_data(0xf7); // WBmode:VBDF 17|D7 VBDW 97 VBDB 57		WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7
 
     epaper_write_command(0x02); // power off
-    epaper_check_status(); // waiting for the electronic paper IC to release the idle signal
+    esp_err_t err = epaper_check_status(); // waiting for the electronic paper IC to release the idle signal
+
+    esp_rom_delay_us(200); //!!!The delay here is necessary, 200uS at least!!!
 
-    vTaskDelay(10); //!!!The delay here is necessary, 200uS at least!!!
+    return err == ESP_OK;
+}
 
+static bool epaper_enter_deep_sleep(void* ctx)
+{
     epaper_write_command(0x07); // deep sleep
     epaper_write_data(0xA5);
+
+    return true;
 }
 
-void epaper_set_pixel(uint16_t x, uint16_t y, uint8_t color)
+static int64_t epaper_power_now_us(void* ctx)
 {
-    if (x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT) {
+    return esp_timer_get_time();
+}
+
+static const power_ops epaper_power_ops = {
+    .init = EPAPER_FAST_INIT ? epaper_init_fast : epaper_init,
+    .power_on = epaper_power_on,
+    .power_off = epaper_power_off,
+    .deep_sleep = epaper_enter_deep_sleep,
+    .now_us = epaper_power_now_us,
+};
+
+static void epaper_update(void)
+{
+    int64_t start = metrics_now();
+
+    epaper_write_command(0x12); // Display refresh
+    esp_rom_delay_us(200); // !!!The delay here is necessary, 200uS at least!!!
+
+    epaper_check_status();
+    metrics_record(METRICS_PHASE_REFRESH, start);
+
+    // The idle timeout runs from the end of the refresh
+    power_touch(&power);
+
+    if (EPAPER_POWER_OFF_AFTER_REFRESH) {
+        power_release(&power);
+    }
+}
+
+/**
+ * Brings the controller up to `target` before anything is sent, waking it from deep sleep if needed.
+ */
+static bool epaper_wake(power_state target)
+{
+    if (power_require(&power, target)) {
+        return true;
+    }
+
+    ESP_LOGE(TAG, "controller did not come up, nothing sent");
+
+    return false;
+}
+
+static bool epaper_sleep(bool when_idle)
+{
+    int64_t start = metrics_now();
+
+    if (!(when_idle ? power_sleep_if_idle(&power) : power_sleep(&power))) {
+        return false;
+    }
+
+    metrics_record(METRICS_PHASE_DEEP_SLEEP, start);
+
+    return true;
+}
+
+/**
+ * Powers off and puts the controller into deep sleep now; the next refresh wakes it again.
+ */
+void epaper_deep_sleep(void)
+{
+    epaper_sleep(false);
+}
+
+/**
+ * Puts the controller into deep sleep once it has not been used for the idle timeout; true if it went to sleep.
+ */
+bool epaper_sleep_if_idle()
+{
+    return epaper_sleep(true);
+}
+
+/**
+ * Milliseconds until epaper_sleep_if_idle() puts the controller to sleep, or POWER_IDLE_NEVER.
+ */
+uint32_t epaper_get_idle_remaining_ms()
+{
+    return power_idle_remaining_ms(&power);
+}
+
+/**
+ * How long the controller stays awake after its last use; 0 sleeps after every refresh, POWER_IDLE_NEVER never.
+ */
+void epaper_set_idle_timeout(uint32_t timeout_ms)
+{
+    idle_timeout_ms = timeout_ms;
+    power_set_idle_timeout(&power, timeout_ms);
+}
+
+void epaper_get_power_stats(power_stats* stats)
+{
+    power_get_stats(&power, stats);
+}
+
+#if !EPAPER_BANDED
+/**
+ * Sends the window to the black/white plane (0x10) and the same area of the red plane (0x13).
+ *
+ * An empty red plane is zero-filled without reading memory, or not sent at all while the controller's red RAM
+ * is known to be clear.
+ */
+static void epaper_transmit_window(epaper_window* window)
+{
+    uint32_t length = (uint32_t) window->width_bytes * window->height;
+
+    epaper_write_command(0x10);
+    epaper_write_data_stream(length, fill_chunk_window, window);
+
+    if (red_plane_empty && controller_red_clear) {
+        refresh_stats.red_skipped++;
         return;
     }
 
-    if (color == 1) {
-        epaper_buffer[y * (DISPLAY_WIDTH / 8) + (x / 8)] |= 0x80u >> (x % 8);
+    epaper_write_command(0x13);
+    if (red_plane_empty) {
+        epaper_write_data_stream(length, fill_chunk_zero, NULL);
     } else {
-        epaper_buffer[y * (DISPLAY_WIDTH / 8) + (x / 8)] &= ~(0x80u >> (x % 8));
+        epaper_window red = *window;
+        red.buffer = red_buffer;
+        red.invert = true;
+
+        epaper_write_data_stream(length, fill_chunk_window, &red);
+        controller_red_clear = false;
+    }
+}
+
+/**
+ * Clips the region to the screen and widens it to whole bytes horizontally.
+ */
+static bool epaper_window_from_region(uint16_t x, uint16_t y, uint16_t w, uint16_t h, epaper_window* window)
+{
+    if (x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT || w == 0 || h == 0) {
+        return false;
+    }
+
+    uint16_t x_end = MIN((uint32_t) x + w, DISPLAY_WIDTH);
+    uint16_t y_end = MIN((uint32_t) y + h, DISPLAY_HEIGHT);
+
+    window->buffer = epaper_buffer;
+    window->x_byte = x / 8;
+    window->y = y;
+    window->width_bytes = (x_end + 7) / 8 - window->x_byte;
+    window->height = y_end - y;
+    window->invert = screen_color == SCREEN_BLACK;
+
+    return true;
+}
+
+/**
+ * The window over the whole frame.
+ */
+static epaper_window epaper_full_window()
+{
+    return (epaper_window) {
+        .buffer = epaper_buffer,
+        .x_byte = 0,
+        .y = 0,
+        .width_bytes = DISPLAY_WIDTH / 8,
+        .height = DISPLAY_HEIGHT,
+        .invert = screen_color == SCREEN_BLACK,
+    };
+}
+
+static void epaper_write_partial_window(const epaper_window* window)
+{
+    // The partial window is byte aligned horizontally: HRST[2:0] = 000, HRED[2:0] = 111
+    uint16_t x_start = window->x_byte * 8;
+    uint16_t x_end = (window->x_byte + window->width_bytes) * 8 - 1;
+    uint16_t y_start = window->y;
+    uint16_t y_end = window->y + window->height - 1;
+
+    epaper_write_command(0x90); // Partial window
+    epaper_write_data(x_start / 256);
+    epaper_write_data(x_start % 256);
+    epaper_write_data(x_end / 256);
+    epaper_write_data(x_end % 256);
+    epaper_write_data(y_start / 256);
+    epaper_write_data(y_start % 256);
+    epaper_write_data(y_end / 256);
+    epaper_write_data(y_end % 256);
+    epaper_write_data(0x01); // PT_SCAN: gates scan only inside the window
+}
+
+/**
+ * Sends the whole frame and refreshes the full screen in the current screen color.
+ */
+static void epaper_refresh_full()
+{
+    epaper_window window = epaper_full_window();
+
+    if (!epaper_wake(POWER_STATE_POWERED)) {
+        return;
     }
+
+    int64_t start = esp_timer_get_time();
+
+    epaper_transmit_window(&window);
+    refresh_stats.last_transmit_us = esp_timer_get_time() - start;
+    metrics_record(METRICS_PHASE_TRANSMIT, start);
+    controller_ram_synced = true;
+    controller_red_clear = red_plane_empty;
+    damage_reset(&damage);
+
+    epaper_update();
+
+    diff_commit(epaper_buffer);
+    red_plane_dirty = false;
+    refresh_stats.full++;
 }
 
+/**
+ * Sends the whole frame to the controller without refreshing the panel, which keeps showing what it showed.
+ * Times the transfer on its own, e.g. for the benchmark.
+ */
+void epaper_transmit_frame()
+{
+    epaper_window window = epaper_full_window();
+
+    // RAM accepts data with the charge pump off
+    if (!epaper_wake(POWER_STATE_INITIALIZED)) {
+        return;
+    }
+
+    int64_t start = esp_timer_get_time();
+
+    epaper_transmit_window(&window);
+    refresh_stats.last_transmit_us = esp_timer_get_time() - start;
+    metrics_record(METRICS_PHASE_TRANSMIT, start);
+    controller_ram_synced = true;
+    controller_red_clear = red_plane_empty;
+    power_touch(&power);
+
+    // The next refresh has to redraw the panel from controller RAM
+    diff_invalidate();
+}
+
+void epaper_refresh_damage()
+{
+    epaper_window window;
+    Rect bounds = { .x = 0, .y = 0, .w = DISPLAY_WIDTH, .h = DISPLAY_HEIGHT };
+    Rect changed = bounds;
+    Rect missed = { 0 };
+
+    bool frame_changed = !diff_enabled || diff_changed(epaper_buffer, &damage, &changed, &missed);
+
+    // Red changes are invisible to the diff; the damage list alone decides then
+    if (red_plane_dirty) {
+        changed = bounds;
+    } else if (!frame_changed) {
+        ESP_LOGI(TAG, "refresh skipped: frame unchanged");
+        damage_reset(&damage);
+        refresh_stats.skipped++;
+        return;
+    }
+
+    // The buffer was written without going through the drawing API, all of it or next to what was damaged. The
+    // whole frame is committed below, so everything that differs has to go out.
+    if (missed.w > 0) {
+        damage_add_rect(&damage, &missed);
+    }
+
+    if (!damage_bounds(&damage, &bounds) || !rect_intersect(&bounds, &changed, &bounds)
+        || !epaper_window_from_region(bounds.x, bounds.y, bounds.w, bounds.h, &window)) {
+        damage_reset(&damage);
+        return;
+    }
+
+    if ((uint32_t) bounds.w * bounds.h * 100
+        >= (uint32_t) DISPLAY_WIDTH * DISPLAY_HEIGHT * EPAPER_FULL_REFRESH_PERCENT) {
+        epaper_refresh_full();
+        return;
+    }
+
+    // Damage and the committed frame are kept for the next attempt
+    if (!epaper_wake(POWER_STATE_POWERED)) {
+        return;
+    }
+
+    ESP_LOGI(TAG, "refresh damage: %d rect(s), bounds x=%d y=%d w=%d h=%d", damage.count, bounds.x, bounds.y,
+        bounds.w, bounds.h);
+
+    epaper_write_command(0x91); // Partial in
+
+    int64_t start = esp_timer_get_time();
+
+    if (controller_ram_synced) {
+        // Controller RAM already holds the rest of the frame, so only the changed parts of the dirty rectangles are
+        // sent
+        for (uint8_t i = 0; i < damage.count; i++) {
+            epaper_window dirty;
+            Rect rect;
+
+            if (rect_intersect(&damage.rects[i], &bounds, &rect)
+                && epaper_window_from_region(rect.x, rect.y, rect.w, rect.h, &dirty)) {
+                epaper_write_partial_window(&dirty);
+                epaper_transmit_window(&dirty);
+            }
+        }
+    } else {
+        epaper_write_partial_window(&window);
+        epaper_transmit_window(&window);
+    }
+
+    refresh_stats.last_transmit_us = esp_timer_get_time() - start;
+    metrics_record(METRICS_PHASE_TRANSMIT, start);
+
+    // The refresh itself always covers the bounding window
+    epaper_write_partial_window(&window);
+    epaper_update();
+
+    epaper_write_command(0x92); // Partial out
+
+    damage_reset(&damage);
+    diff_commit(epaper_buffer);
+    red_plane_dirty = false;
+    refresh_stats.partial++;
+}
+#endif
+
+/**
+ * Renders the whole frame strip by strip while it is sent and refreshes the full screen in the current screen
+ * color. Only the SPI_QUEUE_SIZE chunks hold image data: `render` fills the next band while the previous one is
+ * on the wire.
+ *
+ * `red` tells whether `render` draws anything on the red plane; the red plane is zero-filled or left out if not.
+ */
+void epaper_refresh_banded(epaper_band_fn render, bool red, void* ctx)
+{
+    epaper_band_stream stream = {
+        .render = render, .ctx = ctx, .plane = EPAPER_PLANE_BLACK, .invert = screen_color == SCREEN_BLACK
+    };
+
+    if (!epaper_wake(POWER_STATE_POWERED)) {
+        return;
+    }
+
+    int64_t start = esp_timer_get_time();
+
+    epaper_write_command(0x10);
+    epaper_write_data_stream(DISPLAY_BUFFER_SIZE, fill_chunk_band, &stream);
+
+    if (red) {
+        // Stored as 0 = red like the red plane in full-buffer mode
+        stream.plane = EPAPER_PLANE_RED;
+        stream.invert = true;
+
+        epaper_write_command(0x13);
+        epaper_write_data_stream(DISPLAY_BUFFER_SIZE, fill_chunk_band, &stream);
+        controller_red_clear = false;
+    } else if (controller_red_clear) {
+        refresh_stats.red_skipped++;
+    } else {
+        epaper_write_command(0x13);
+        epaper_write_data_stream(DISPLAY_BUFFER_SIZE, fill_chunk_zero, NULL);
+        controller_red_clear = true;
+    }
+
+    refresh_stats.last_transmit_us = esp_timer_get_time() - start;
+    metrics_record(METRICS_PHASE_TRANSMIT, start);
+    controller_ram_synced = true;
+    damage_reset(&damage);
+
+    ESP_LOGI(TAG, "banded frame sent in %lu us", (unsigned long) refresh_stats.last_transmit_us);
+
+    epaper_update();
+
+    refresh_stats.banded++;
+}
+
+#if !EPAPER_BANDED
+/**
+ * Redraws the byte-aligned window around `area` from scratch: `render` draws each strip of the window's rows
+ * into an SPI buffer, which is then copied into the planes. The strips are full width, but only the window's
+ * columns are taken, so `render` may skip whatever does not overlap the window.
+ *
+ * `red` tells whether `render` draws anything on the red plane.
+ */
+void epaper_render_area(const Rect* area, bool red, epaper_band_fn render, void* ctx)
+{
+    epaper_window window;
+
+    if (!spi_dma_chunks[0] || !epaper_window_from_region(area->x, area->y, area->w, area->h, &window)) {
+        return;
+    }
+
+    if (red) {
+        epaper_use_color(COLOR_RED);
+    }
+
+    for (uint8_t plane = EPAPER_PLANE_BLACK; plane <= EPAPER_PLANE_RED; plane++) {
+        uint8_t* target = plane == EPAPER_PLANE_RED ? red_buffer : epaper_buffer;
+
+        // Rendering only clears red then, which changes nothing where there is none
+        if (plane == EPAPER_PLANE_RED && !red && !epaper_red_in_area(area->x, area->y, area->w, area->h)) {
+            break;
+        }
+        if (plane == EPAPER_PLANE_RED) {
+            red_plane_dirty = true;
+        }
+
+        for (uint16_t y = window.y; y < window.y + window.height; y += EPAPER_BAND_ROWS) {
+            Raster band = {
+                .buffer = spi_dma_chunks[0],
+                .width = DISPLAY_WIDTH,
+                .height = MIN(EPAPER_BAND_ROWS, window.y + window.height - y),
+                .stride = DISPLAY_STRIDE,
+                .top = y,
+            };
+
+            render(&band, plane, ctx);
+
+            for (uint16_t row = 0; row < band.height; row++) {
+                memcpy(target + (y + row) * DISPLAY_STRIDE + window.x_byte,
+                    band.buffer + row * DISPLAY_STRIDE + window.x_byte, window.width_bytes);
+            }
+        }
+    }
+
+    damage_add(&damage, window.x_byte * 8, window.y, window.width_bytes * 8, window.height);
+}
+#endif
+
+void epaper_get_refresh_stats(epaper_refresh_stats* stats)
+{
+    *stats = refresh_stats;
+    stats->red_memory_bytes = red_buffer ? DISPLAY_BUFFER_SIZE : 0;
+}
+
+const DamageList* epaper_get_damage()
+{
+    return &damage;
+}
+
+void epaper_reset_damage()
+{
+    damage_reset(&damage);
+}
+
+void epaper_set_damage_limit(uint8_t limit)
+{
+    damage_set_limit(&damage, limit);
+}
+
+static void epaper_add_damage(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    if (x < 0) {
+        w += x;
+        x = 0;
+    }
+    if (y < 0) {
+        h += y;
+        y = 0;
+    }
+    if (x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT || w <= 0 || h <= 0) {
+        return;
+    }
+
+    damage_add(&damage, x, y, MIN(w, DISPLAY_WIDTH - x), MIN(h, DISPLAY_HEIGHT - y));
+}
+
+/**
+ * The red plane in the layout of epaper_get_buffer() with 0 = red, or NULL while nothing is drawn in red.
+ */
+const uint8_t* epaper_get_red_buffer()
+{
+    return red_plane_empty ? NULL : red_buffer;
+}
+
+#if !EPAPER_BANDED
+static inline void epaper_put_bit(uint8_t* plane, uint16_t x, uint16_t y, uint8_t set)
+{
+    if (set) {
+        plane[y * (DISPLAY_WIDTH / 8) + (x / 8)] |= 0x80u >> (x % 8);
+    } else {
+        plane[y * (DISPLAY_WIDTH / 8) + (x / 8)] &= ~(0x80u >> (x % 8));
+    }
+}
+
+/**
+ * Sets one pixel to a color already resolved by epaper_use_color(); a red pixel is white on the black/white
+ * plane, any other color clears the red bit when red is in use.
+ */
+static inline void epaper_put_pixel(uint16_t x, uint16_t y, uint8_t color, bool red_in_use)
+{
+    if (x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT) {
+        return;
+    }
+
+    epaper_put_bit(epaper_buffer, x, y, color != COLOR_BLACK);
+
+    if (red_in_use) {
+        uint8_t before = red_buffer[y * (DISPLAY_WIDTH / 8) + (x / 8)];
+
+        epaper_put_bit(red_buffer, x, y, color != COLOR_RED);
+        red_plane_dirty |= red_buffer[y * (DISPLAY_WIDTH / 8) + (x / 8)] != before;
+    }
+}
+
+/**
+ * Returns the framebuffer for direct writes; rows are DISPLAY_STRIDE bytes, 1 bit per pixel, MSB first, 1 = white.
+ *
+ * Whoever writes to it directly reports the changed area with epaper_mark_damaged().
+ */
+uint8_t* epaper_get_buffer()
+{
+    return epaper_buffer;
+}
+
+void epaper_mark_damaged(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+    epaper_add_damage(x, y, w, h);
+}
+
+void epaper_set_pixel(uint16_t x, uint16_t y, uint8_t color)
+{
+    color = epaper_use_color(color);
+    epaper_put_pixel(x, y, color, epaper_red_in_use());
+    epaper_add_damage(x, y, 1, 1);
+}
+
+/**
+ * Writes 8 pixels of the black/white plane at once; red pixels there are kept.
+ */
 void epaper_set_pixel_bits_8(uint16_t x, uint16_t y, uint8_t bits)
 {
     if (x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT) {
@@ -283,6 +1255,7 @@ void epaper_set_pixel_bits_8(uint16_t x, uint16_t y, uint8_t bits)
     }
 
     epaper_buffer[y * (DISPLAY_WIDTH / 8) + (x / 8)] = bits;
+    epaper_add_damage(x & ~0x07, y, 8, 1);
 }
 
 uint8_t epaper_get_pixel(uint16_t x, uint16_t y)
@@ -291,6 +1264,10 @@ uint8_t epaper_get_pixel(uint16_t x, uint16_t y)
         return 0;
     }
 
+    if (!red_plane_empty && !(red_buffer[y * (DISPLAY_WIDTH / 8) + (x / 8)] & (0x80u >> (x % 8)))) {
+        return COLOR_RED;
+    }
+
     return epaper_buffer[y * (DISPLAY_WIDTH / 8) + (x / 8)] & (0x80u >> (x % 8)) ? 1 : 0;
 }
 
@@ -303,187 +1280,426 @@ uint8_t epaper_get_pixel_bits_8(uint16_t x, uint16_t y)
     return epaper_buffer[y * (DISPLAY_WIDTH / 8) + (x / 8)];
 }
 
-void epaper_draw_line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t color)
+static inline Raster epaper_plane_raster(uint8_t* plane)
 {
-    int16_t dx = abs(x2 - x1);
-    int16_t sx = x1 < x2 ? 1 : -1;
-    int16_t dy = -abs(y2 - y1);
-    int16_t sy = y1 < y2 ? 1 : -1;
-    int16_t err = dx + dy;
-    int16_t e2;
+    return (Raster) { .buffer = plane, .width = DISPLAY_WIDTH, .height = DISPLAY_HEIGHT, .stride = DISPLAY_STRIDE };
+}
 
-    while (1) {
-        epaper_set_pixel(x1, y1, color);
-        if (x1 == x2 && y1 == y2)
-            break;
-        e2 = 2 * err;
-        if (e2 >= dy) {
-            err += dy;
-            x1 += sx;
-        }
-        if (e2 <= dx) {
-            err += dx;
-            y1 += sy;
-        }
+/**
+ * Sets `length` pixels of row `y` starting at `x` to `color`.
+ */
+void epaper_draw_run(uint16_t x, uint16_t y, uint16_t length, uint8_t color)
+{
+    Raster raster = epaper_plane_raster(epaper_buffer);
+
+    color = epaper_use_color(color);
+    raster_hspan(&raster, x, y, length, color != COLOR_BLACK);
+
+    if (color == COLOR_RED || epaper_red_in_area(x, y, length, 1)) {
+        Raster red = epaper_plane_raster(red_buffer);
+        raster_hspan(&red, x, y, length, color != COLOR_RED);
+        red_plane_dirty = true;
     }
+
+    epaper_add_damage(x, y, length, 1);
 }
 
-void epaper_draw_text(uint16_t pos_x, uint16_t pos_y, const char* text, Font* font)
+void epaper_draw_line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t color)
 {
-    ESP_LOGI(TAG, "draw_text: %s", text);
+    Raster raster = epaper_plane_raster(epaper_buffer);
 
-    for (uint16_t i = 0; i < strlen(text); i++) {
-        char char_code = text[i];
-        uint16_t char_index = char_code - font->first_char;
+    color = epaper_use_color(color);
+    raster_draw_line(&raster, x1, y1, x2, y2, color != COLOR_BLACK);
 
-        for (uint16_t y = 0; y < font->char_height; y++) {
-            for (uint16_t x = 0; x < font->char_width; x++) {
-                uint16_t current_bit = char_index * font->char_width + x;
-                uint16_t byte_index = y * (font->size / font->char_height) + current_bit / 8;
-                uint8_t bit_pos = 7 - (current_bit % 8);
-                uint8_t pixel = (font->font_array[byte_index] >> bit_pos) & 0x01;
+    if (color == COLOR_RED || epaper_red_in_area(MIN(x1, x2), MIN(y1, y2), abs(x2 - x1) + 1, abs(y2 - y1) + 1)) {
+        Raster red = epaper_plane_raster(red_buffer);
+        raster_draw_line(&red, x1, y1, x2, y2, color != COLOR_RED);
+        red_plane_dirty = true;
+    }
 
-                // ESP_LOGI("draw_text inner", "current_bit: %d, byte_index: %d, bit_pos: %d, pixel: %d", current_bit, byte_index, bit_pos, pixel);
+    epaper_add_damage(MIN(x1, x2), MIN(y1, y2), abs(x2 - x1) + 1, abs(y2 - y1) + 1);
+}
 
-                epaper_set_pixel(pos_x + i * font->char_width + x, pos_y + y, !pixel);
-            }
-        }
+/**
+ * Draws a rectangle, rounded rectangle, circle, thick line or polygon in `color`, see shape.h.
+ */
+void epaper_draw_shape(const Shape* shape, uint8_t color)
+{
+    Raster raster = epaper_plane_raster(epaper_buffer);
+    Rect bounds;
+
+    color = epaper_use_color(color);
+    shape_draw(&raster, shape, color != COLOR_BLACK);
+    shape_bounds(shape, &bounds);
+
+    if (color == COLOR_RED || epaper_red_in_area(bounds.x, bounds.y, bounds.w, bounds.h)) {
+        Raster red = epaper_plane_raster(red_buffer);
+        shape_draw(&red, shape, color != COLOR_RED);
+        red_plane_dirty = true;
     }
+
+    epaper_add_damage(bounds.x, bounds.y, bounds.w, bounds.h);
 }
 
-void epaper_dummy_screen()
+/**
+ * Sets the w x h rectangle at (x, y) to `color`.
+ */
+void epaper_fill_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t color)
 {
-    uint16_t mark = 0x1000;
+    Raster raster = epaper_plane_raster(epaper_buffer);
 
-    memset(epaper_buffer, 0xff, DISPLAY_BUFFER_SIZE);
+    if (x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT) {
+        return;
+    }
+    w = MIN(w, DISPLAY_WIDTH - x);
+    h = MIN(h, DISPLAY_HEIGHT - y);
 
-    epaper_draw_text(20, 20, "Hello, world!", &font_jetbrains_mono_16x24);
-    epaper_draw_text(20, 60, "Give me", &font_jetbrains_mono_16x24);
-    epaper_draw_text(40, 90, "$1,000,000", &font_jetbrains_mono_16x24);
-    epaper_draw_text(20, 120, "please...", &font_jetbrains_mono_16x24);
-
-    epaper_draw_line(20, DISPLAY_HEIGHT / 2, DISPLAY_HEIGHT / 2 - 20, DISPLAY_HEIGHT / 2, 0);
-
-    for (uint16_t y = 0; y < DISPLAY_HEIGHT; y++) {
-        for (uint16_t x = DISPLAY_HEIGHT / 16; x < DISPLAY_WIDTH / 8; x += 2) {
-            if (mark & 0x1000) {
-                epaper_buffer[y * (DISPLAY_WIDTH / 8) + x] = 0xff;
-                epaper_buffer[y * (DISPLAY_WIDTH / 8) + x + 1] = 0x00;
-            } else {
-                epaper_buffer[y * (DISPLAY_WIDTH / 8) + x] = 0x00;
-                epaper_buffer[y * (DISPLAY_WIDTH / 8) + x + 1] = 0xff;
-            }
-        }
+    color = epaper_use_color(color);
+    raster_fill_rect(&raster, x, y, w, h, color != COLOR_BLACK);
 
-        if ((mark & 0xfff) < 10) {
-            mark++;
-        } else {
-            mark = 0 | ((!((mark & 0x1000) >> 12)) << 12);
-        }
+    if (color == COLOR_RED || epaper_red_in_area(x, y, w, h)) {
+        Raster red = epaper_plane_raster(red_buffer);
+        raster_fill_rect(&red, x, y, w, h, color != COLOR_RED);
+        red_plane_dirty = true;
     }
 
-    if (screen_color == SCREEN_BLACK) {
-        epaper_black_screen();
+    epaper_add_damage(x, y, w, h);
+}
+
+/**
+ * Draws a w x h bitmap of (w + 7) / 8 byte rows, MSB first, at (x, y): 1 bits in `color`, 0 bits white.
+ */
+void epaper_draw_bitmap(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint8_t* bitmap, uint8_t color)
+{
+    if (x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT) {
+        return;
+    }
+    h = MIN(h, DISPLAY_HEIGHT - y);
+
+    color = epaper_use_color(color);
+    bool red_under = color != COLOR_RED && epaper_red_in_area(x, y, w, h);
+    Raster raster = epaper_plane_raster(epaper_buffer);
+    Raster red = epaper_plane_raster(red_buffer);
+
+    if (color == COLOR_BLACK) {
+        raster_put_bitmap(&raster, x, y, bitmap, w, h, true);
     } else {
-        epaper_white_screen();
+        raster_fill_rect(&raster, x, y, MIN(w, DISPLAY_WIDTH - x), h, 1);
     }
 
-    epaper_update();
+    if (color == COLOR_RED) {
+        raster_put_bitmap(&red, x, y, bitmap, w, h, true);
+    } else if (red_under) {
+        raster_fill_rect(&red, x, y, MIN(w, DISPLAY_WIDTH - x), h, 1);
+        red_plane_dirty = true;
+    }
+
+    epaper_add_damage(x, y, w, h);
 }
 
-void epaper_clear_screen()
+/**
+ * Clears the plane the text color does not draw on under a run of glyph cells: red text leaves the cells white
+ * on the black/white plane, black text removes red pixels.
+ */
+static void epaper_blank_under(uint8_t color, uint16_t x, uint16_t y, uint16_t w, uint16_t h)
 {
-    memset(epaper_buffer, 0xff, DISPLAY_BUFFER_SIZE);
+    if (color == COLOR_RED) {
+        Raster raster = epaper_plane_raster(epaper_buffer);
+        raster_fill_rect(&raster, x, y, w, h, 1);
+    } else if (epaper_red_in_area(x, y, w, h)) {
+        Raster raster = epaper_plane_raster(red_buffer);
+        raster_fill_rect(&raster, x, y, w, h, 1);
+        red_plane_dirty = true;
+    }
+}
 
-    if (screen_color == SCREEN_BLACK) {
-        epaper_black_screen();
-    } else {
-        epaper_white_screen();
+/**
+ * Draws the glyphs of [text, end) in `color` (resolved, black or red) with the pen starting at (x, y) and returns
+ * where the pen ends up.
+ */
+static uint32_t epaper_draw_glyphs(uint32_t x, uint16_t y, const char* text, const char* end, const Font* font,
+    uint8_t color)
+{
+    Raster raster = epaper_plane_raster(color == COLOR_RED ? red_buffer : epaper_buffer);
+    uint32_t start = x;
+
+    x = raster_draw_glyphs(&raster, x, y, text, end, font);
+
+    if (x > start && start < DISPLAY_WIDTH) {
+        epaper_blank_under(color, start, y, MIN(x, DISPLAY_WIDTH) - start, font->line_height);
     }
+
+    return x;
 }
 
-void epaper_white_screen()
+/**
+ * Draws `text` with the pen at (pos_x, pos_y); COLOR_RED draws red text, any other color black.
+ */
+void epaper_draw_text(uint16_t pos_x, uint16_t pos_y, const char* text, Font* font, uint8_t color)
 {
-    epaper_write_command(0x10);
-    for (uint32_t i = 0; i < DISPLAY_BUFFER_SIZE; i++) {
-        epaper_write_data(epaper_buffer[i]);
+    ESP_LOGI(TAG, "draw_text: %s", text);
+
+    color = epaper_use_color(color == COLOR_RED ? COLOR_RED : COLOR_BLACK);
+    uint32_t x = epaper_draw_glyphs(pos_x, pos_y, text, text + strlen(text), font, color);
+
+    epaper_add_damage(pos_x, pos_y, x - pos_x, font->line_height);
+}
+
+typedef struct epaper_text_box {
+    const Font* font;
+    const Glyph* ellipsis;
+    uint8_t ellipsis_count;
+    uint8_t color;
+} epaper_text_box;
+
+static void epaper_draw_layout_line(const LayoutLine* line, void* ctx)
+{
+    const epaper_text_box* box = ctx;
+    Raster raster = epaper_plane_raster(box->color == COLOR_RED ? red_buffer : epaper_buffer);
+    uint32_t x = epaper_draw_glyphs(line->x, line->y, line->text, line->text + line->length, box->font, box->color);
+    uint32_t ellipsis_x = x;
+
+    for (uint8_t i = 0; line->ellipsis && i < box->ellipsis_count && x < DISPLAY_WIDTH; i++) {
+        raster_draw_glyph(&raster, x, line->y, box->font, box->ellipsis);
+        x += box->ellipsis->advance;
     }
 
-    epaper_write_command(0x13);
-    for (uint32_t i = 0; i < DISPLAY_BUFFER_SIZE; i++) {
-        epaper_write_data(0x00);
+    if (x > ellipsis_x) {
+        epaper_blank_under(box->color, ellipsis_x, line->y, MIN(x, DISPLAY_WIDTH) - ellipsis_x, box->font->line_height);
     }
+}
 
-    epaper_update();
+/**
+ * Lays `text` out inside the box at (x, y) as layout_text() does and draws it in `color` as epaper_draw_text()
+ * does; only the lines drawn are damaged.
+ *
+ * The rest of the box is left as it is. Returns false when the text did not fit.
+ */
+bool epaper_draw_text_box(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const char* text, Font* font,
+    const LayoutOptions* options, uint8_t color)
+{
+    Rect box = { .x = x, .y = y, .w = MIN(w, DISPLAY_WIDTH - MIN(x, DISPLAY_WIDTH)), .h = h };
+    epaper_text_box ctx = { .font = font, .color = epaper_use_color(color == COLOR_RED ? COLOR_RED : COLOR_BLACK) };
+    Rect used;
+
+    ESP_LOGI(TAG, "draw_text_box: %ux%u %s", w, h, text);
+
+    ctx.ellipsis = layout_ellipsis_glyph(font, &ctx.ellipsis_count);
+    bool fits = layout_text(font, text, &box, options, epaper_draw_layout_line, &ctx, &used);
+
+    if (used.w > 0) {
+        epaper_add_damage(used.x, used.y, used.w, used.h);
+    }
+
+    return fits;
+}
+
+void epaper_draw_dummy()
+{
+    Raster raster = epaper_plane_raster(epaper_buffer);
 
+    epaper_clear_planes();
+    band_draw_dummy(&raster);
+
+    epaper_add_damage(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+}
+
+void epaper_dummy_screen()
+{
+    epaper_draw_dummy();
+    epaper_refresh_damage();
+}
+#endif
+
+void epaper_clear()
+{
+    epaper_clear_planes();
+    epaper_add_damage(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+}
+
+#if !EPAPER_BANDED
+void epaper_clear_screen()
+{
+    epaper_clear();
+
+    // The frame diff narrows this down to what is actually drawn; nothing is sent when already clear
+    epaper_refresh_damage();
+}
+
+void epaper_white_screen()
+{
     screen_color = SCREEN_WHITE;
+    epaper_refresh_full();
 }
 
 void epaper_black_screen()
 {
-    epaper_write_command(0x10);
-    for (uint32_t i = 0; i < DISPLAY_BUFFER_SIZE; i++) {
-        epaper_write_data(~epaper_buffer[i]);
-    }
+    screen_color = SCREEN_BLACK;
+    epaper_refresh_full();
+}
+#endif
 
-    epaper_write_command(0x13);
-    for (uint32_t i = 0; i < DISPLAY_BUFFER_SIZE; i++) {
-        epaper_write_data(0x00);
+/**
+ * Changes the screen color without refreshing; the next epaper_refresh_damage() redraws the whole screen.
+ */
+void epaper_set_screen_color(uint8_t color)
+{
+    if (color == screen_color) {
+        return;
     }
 
-    epaper_update();
+    screen_color = color;
 
-    screen_color = SCREEN_BLACK;
+    // The buffer is unchanged but every pixel on the panel flips
+    diff_invalidate();
+    epaper_add_damage(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
 }
 
-void epaper_toggle_screen_color()
+/**
+ * Replaces the frame with the planes of a saved screen, e.g. mapped from flash; a NULL plane is all white, or all
+ * not red. With `shown` the panel is taken to show this frame already: it becomes what the next refresh is
+ * compared with. Otherwise the whole screen is damaged and the next refresh sends what differs.
+ *
+ * Only sets the screen color in banded mode.
+ */
+void epaper_restore_frame(const uint8_t* black, const uint8_t* red, uint8_t color, bool shown)
 {
-    if (screen_color == SCREEN_WHITE) {
-        epaper_black_screen();
+#if !EPAPER_BANDED
+    bool color_changed = color != screen_color;
+#endif
+
+    screen_color = color;
+
+#if !EPAPER_BANDED
+    if (black) {
+        memcpy(epaper_buffer, black, DISPLAY_BUFFER_SIZE);
     } else {
-        epaper_white_screen();
+        memset(epaper_buffer, 0xff, DISPLAY_BUFFER_SIZE);
     }
+
+    if (red && epaper_use_color(COLOR_RED) == COLOR_RED) {
+        memcpy(red_buffer, red, DISPLAY_BUFFER_SIZE);
+    } else if (!red_plane_empty) {
+        memset(red_buffer, 0xff, DISPLAY_BUFFER_SIZE);
+        red_plane_empty = true;
+        red_plane_dirty = true;
+    }
+
+    if (shown) {
+        damage_reset(&damage);
+        diff_commit(epaper_buffer);
+        red_plane_dirty = false;
+        return;
+    }
+
+    if (color_changed) {
+        diff_invalidate();
+    }
+    epaper_add_damage(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+#endif
 }
 
-static void epaper_button1_press_cb()
+#if !EPAPER_BANDED
+/**
+ * Copies the planes, the screen color and the pending damage aside, for code that draws into the framebuffer or
+ * sends it to the controller without refreshing, like the benchmark. Returns false when the copies could not be
+ * allocated.
+ */
+bool epaper_snapshot_take(epaper_snapshot* snapshot)
 {
-    epaper_clear_screen();
-    epaper_deep_sleep();
+    *snapshot = (epaper_snapshot) {
+        .red_dirty = red_plane_dirty,
+        .screen_color = screen_color,
+        .damage = damage,
+        .diff_valid = diff_is_valid(),
+    };
+
+    snapshot->black = malloc(DISPLAY_BUFFER_SIZE);
+    snapshot->red = red_plane_empty ? NULL : malloc(DISPLAY_BUFFER_SIZE);
+
+    if (!snapshot->black || (!red_plane_empty && !snapshot->red)) {
+        free(snapshot->black);
+        free(snapshot->red);
+        snapshot->black = snapshot->red = NULL;
+        return false;
+    }
+
+    memcpy(snapshot->black, epaper_buffer, DISPLAY_BUFFER_SIZE);
+    if (snapshot->red) {
+        memcpy(snapshot->red, red_buffer, DISPLAY_BUFFER_SIZE);
+    }
+
+    return true;
 }
 
-static void epaper_button2_press_cb()
+/**
+ * Puts back what epaper_snapshot_take() copied and frees the copies. Nothing may have refreshed the panel in
+ * between, so that it still shows what it showed then; controller RAM is sent again with the next refresh.
+ */
+void epaper_snapshot_restore(epaper_snapshot* snapshot)
 {
-    epaper_toggle_screen_color();
-    epaper_deep_sleep();
+    if (!snapshot->black) {
+        return;
+    }
+
+    memcpy(epaper_buffer, snapshot->black, DISPLAY_BUFFER_SIZE);
+
+    if (snapshot->red) {
+        memcpy(red_buffer, snapshot->red, DISPLAY_BUFFER_SIZE);
+        red_plane_empty = false;
+    } else if (!red_plane_empty) {
+        memset(red_buffer, 0xff, DISPLAY_BUFFER_SIZE);
+        red_plane_empty = true;
+    }
+
+    red_plane_dirty = snapshot->red_dirty;
+    screen_color = snapshot->screen_color;
+    damage = snapshot->damage;
+
+    controller_ram_synced = false;
+    controller_red_clear = false;
+    if (snapshot->diff_valid) {
+        diff_revalidate();
+    } else {
+        diff_invalidate();
+    }
+
+    free(snapshot->black);
+    free(snapshot->red);
+    snapshot->black = snapshot->red = NULL;
 }
+#endif
 
-static void epaper_button3_press_cb()
+uint8_t epaper_get_screen_color()
 {
-    epaper_dummy_screen();
-    epaper_deep_sleep();
+    return screen_color;
 }
 
-static void epaper_draw_text_cb(const char* text, int x, int y)
+#if !EPAPER_BANDED
+void epaper_toggle_screen_color()
 {
-    epaper_draw_text(x, y, text, &font_jetbrains_mono_16x24);
-
-    if (screen_color == SCREEN_BLACK) {
+    if (screen_color == SCREEN_WHITE) {
         epaper_black_screen();
     } else {
         epaper_white_screen();
     }
-
-    epaper_update();
-    epaper_deep_sleep();
 }
+#endif
 
+/**
+ * Sets up the framebuffer, SPI and the BUSY pin. The controller is reset and initialized by the first refresh.
+ */
 void epaper_setup()
 {
-    epaper_init_fast();
+    epaper_clear_planes();
+    damage_init(&damage, EPAPER_DAMAGE_LIMIT);
+    epaper_diff_init();
 
-    button_register_button1_press_cb(epaper_button1_press_cb);
-    button_register_button2_press_cb(epaper_button2_press_cb);
-    button_register_button3_press_cb(epaper_button3_press_cb);
+    if (!spi_init()) {
+        ESP_LOGW(TAG, "controller init will fail until the SPI buffers can be allocated");
+    }
+    busy_init();
+    vTaskDelay(pdMS_TO_TICKS(10));
 
-    http_register_on_draw_text(epaper_draw_text_cb);
+    power_init(&power, &epaper_power_ops, idle_timeout_ms);
 }
@@ -3,7 +3,12 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 
+#include "damage.h"
 #include "font.h"
+#include "layout.h"
+#include "power.h"
+#include "raster.h"
+#include "shape.h"
 
 #ifndef __EPAPER_H
 #define __EPAPER_H
@@ -11,23 +16,148 @@
 #define SCREEN_WHITE 1
 #define SCREEN_BLACK 0
 
+// Pixel colors of the drawing functions; red pixels live in a separate plane allocated on first use
+#define COLOR_BLACK 0
+#define COLOR_WHITE 1
+#define COLOR_RED 2
+
+#define DISPLAY_WIDTH 800
+#define DISPLAY_HEIGHT 480
+#define DISPLAY_STRIDE (DISPLAY_WIDTH / 8)
+#define DISPLAY_BUFFER_SIZE (DISPLAY_WIDTH * DISPLAY_HEIGHT / 8)
+
+// Without a framebuffer: frames are rendered strip by strip into the SPI buffers while they are sent, see
+// epaper_refresh_banded(). The drawing functions, epaper_get_buffer() and the frame diff are compiled out then.
+#ifndef EPAPER_BANDED
+#define EPAPER_BANDED 0
+#endif
+
+// How long the controller stays awake after a refresh before it goes into deep sleep; a burst of updates within
+// this time wakes it only once. 0 sleeps after every refresh, POWER_IDLE_NEVER never.
+#ifndef EPAPER_IDLE_SLEEP_MS
+#define EPAPER_IDLE_SLEEP_MS 10000
+#endif
+
+// 1 switches the charge pump off after every refresh and on again for the next one, as the datasheet recommends;
+// 0 keeps it on until the controller goes into deep sleep
+#ifndef EPAPER_POWER_OFF_AFTER_REFRESH
+#define EPAPER_POWER_OFF_AFTER_REFRESH 1
+#endif
+
+// Dirty rectangles kept before the closest ones are merged; at most DAMAGE_MAX_RECTS
+#define EPAPER_DAMAGE_LIMIT 4
+
+// The controller's two image planes
+#define EPAPER_PLANE_BLACK 0
+#define EPAPER_PLANE_RED 1
+
+/**
+ * Renders `plane` into `band`, which holds rows band->top to band->top + band->height - 1 of the frame in the
+ * framebuffer's polarity: 1 = white, and for the red plane 1 = not red.
+ */
+typedef void (*epaper_band_fn)(const Raster* band, uint8_t plane, void* ctx);
+
+typedef struct epaper_spi_stats {
+    uint32_t transactions;
+    uint32_t bytes;
+} epaper_spi_stats;
+
+typedef struct epaper_busy_stats {
+    uint32_t waits;
+    uint32_t timeouts;
+    uint32_t last_wait_us;
+    uint32_t max_wait_us;
+    uint64_t total_wait_us;
+} epaper_busy_stats;
+
+typedef struct epaper_refresh_stats {
+    uint32_t full;
+    uint32_t partial;
+    uint32_t skipped;
+    // Cost of the last committed frame kept for diffing; 0 when it could not be allocated
+    uint32_t diff_memory_bytes;
+    // Cost of the red plane; 0 until something is drawn in red
+    uint32_t red_memory_bytes;
+    // Transfers that left out the red plane because it was empty and the controller's copy already clear
+    uint32_t red_skipped;
+    uint32_t banded;
+    // Time spent sending the last frame to the controller, rendering included in banded mode
+    uint32_t last_transmit_us;
+} epaper_refresh_stats;
+
+/**
+ * The framebuffer as the drawing functions left it, with its pending damage, taken by epaper_snapshot_take().
+ */
+typedef struct epaper_snapshot {
+    uint8_t* black;
+    // NULL while nothing was drawn in red
+    uint8_t* red;
+    bool red_dirty;
+    uint8_t screen_color;
+    DamageList damage;
+    bool diff_valid;
+} epaper_snapshot;
+
 void epaper_setup();
 void epaper_deep_sleep();
+bool epaper_sleep_if_idle();
+uint32_t epaper_get_idle_remaining_ms();
+void epaper_set_idle_timeout(uint32_t timeout_ms);
+void epaper_get_power_stats(power_stats* stats);
+
+void epaper_clear();
+void epaper_set_screen_color(uint8_t color);
+uint8_t epaper_get_screen_color();
+void epaper_restore_frame(const uint8_t* black, const uint8_t* red, uint8_t color, bool shown);
+const uint8_t* epaper_get_red_buffer();
 
+void epaper_refresh_banded(epaper_band_fn render, bool red, void* ctx);
+
+const DamageList* epaper_get_damage();
+void epaper_reset_damage();
+void epaper_set_damage_limit(uint8_t limit);
+
+#if !EPAPER_BANDED
 void epaper_clear_screen();
 void epaper_toggle_screen_color();
 void epaper_white_screen();
 void epaper_black_screen();
 
 void epaper_dummy_screen();
+void epaper_draw_dummy();
+
+bool epaper_snapshot_take(epaper_snapshot* snapshot);
+void epaper_snapshot_restore(epaper_snapshot* snapshot);
 
-void epaper_draw_text(uint16_t pos_x, uint16_t pos_y, const char* text, Font* font);
+void epaper_refresh_damage();
+void epaper_transmit_frame();
+void epaper_render_area(const Rect* area, bool red, epaper_band_fn render, void* ctx);
+
+void epaper_draw_text(uint16_t pos_x, uint16_t pos_y, const char* text, Font* font, uint8_t color);
+bool epaper_draw_text_box(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const char* text, Font* font,
+    const LayoutOptions* options, uint8_t color);
 void epaper_draw_line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t color);
+void epaper_draw_run(uint16_t x, uint16_t y, uint16_t length, uint8_t color);
+void epaper_draw_shape(const Shape* shape, uint8_t color);
+void epaper_fill_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t color);
+void epaper_draw_bitmap(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint8_t* bitmap, uint8_t color);
+
+uint8_t* epaper_get_buffer();
+void epaper_mark_damaged(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
 
 void epaper_set_pixel(uint16_t x, uint16_t y, uint8_t color);
 void epaper_set_pixel_bits_8(uint16_t x, uint16_t y, uint8_t bits);
 
 uint8_t epaper_get_pixel(uint16_t x, uint16_t y);
 uint8_t epaper_get_pixel_bits_8(uint16_t x, uint16_t y);
+#endif
+
+void epaper_get_spi_stats(epaper_spi_stats* stats);
+void epaper_reset_spi_stats();
+
+void epaper_set_busy_timeout(uint32_t timeout_ms);
+void epaper_get_busy_stats(epaper_busy_stats* stats);
+
+void epaper_get_refresh_stats(epaper_refresh_stats* stats);
 
 #endif
@@ -1,77 +1,3530 @@
+// Generated by tools/fontconv from fonts/fonts.js
 #include <stdint.h>
 
 #include "font.h"
 
-static const uint8_t __font_ubuntu_mono_16x24[] = {
-    0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00001100, 0b11000000, 0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000111, 0b00000000, 0b00000000, 0b11000000, 0b00001000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b01100000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00001111, 0b11000000, 0b00110000, 0b00000000, 0b00011111, 0b10000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000100, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b01110000, 0b00000000, 0b00000000, 0b00000011, 0b11111000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00001110, 0b00000000, 0b00000001, 0b11000000, 0b00110000, 0b00000000, 0b01111110, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b11100000, 0b00000011, 0b00000000, 0b00111100, 0b00000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00001100, 0b11000000, 0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000111, 0b00000000, 0b00000001, 0b11000000, 0b00011100, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b01100000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00001111, 0b11000000, 0b00110000, 0b00000000, 0b00011111, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000110, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b01110000, 0b00000000, 0b00000000, 0b00000111, 0b11111000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00001110, 0b00000000, 0b00000011, 0b11000000, 0b00110000, 0b00000000, 0b01111110, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000011, 0b11110000, 0b00000011, 0b00000000, 0b00111111, 0b00000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000111, 0b00000000, 0b00001100, 0b11000000, 0b00000110, 0b00110000, 0b00000011, 0b00000000, 0b00111000, 0b00110000, 0b00001111, 0b00000000, 0b00000011, 0b00000000, 0b00000011, 0b10000000, 0b00001110, 0b00000000, 0b00000111, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b01100000, 0b00001111, 0b10000000, 0b00000011, 0b10000000, 0b00011111, 0b10000000, 0b00011111, 0b10000000, 0b00000000, 0b11100000, 0b00011111, 0b11110000, 0b00000001, 0b11100000, 0b00111111, 0b11111000, 0b00001111, 0b11000000, 0b00001111, 0b10000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00011111, 0b10000000, 0b00000111, 0b11000000, 0b00000111, 0b00000000, 0b01111111, 0b10000000, 0b00000111, 0b11100000, 0b01111111, 0b00000000, 0b00111111, 0b11110000, 0b00111111, 0b11110000, 0b00000111, 0b11100000, 0b01100000, 0b00110000, 0b00111111, 0b11100000, 0b00011111, 0b11100000, 0b00110000, 0b00111000, 0b00111000, 0b00000000, 0b00110000, 0b01110000, 0b01110000, 0b00110000, 0b00001111, 0b10000000, 0b00111111, 0b11000000, 0b00001111, 0b10000000, 0b01111111, 0b10000000, 0b00001111, 0b11100000, 0b01111111, 0b11111000, 0b01100000, 0b00110000, 0b11100000, 0b00011000, 0b01100000, 0b00111000, 0b01110000, 0b00110000, 0b11100000, 0b00011000, 0b00111111, 0b11110000, 0b00001100, 0b00000000, 0b00111000, 0b00000000, 0b00000001, 0b11000000, 0b00000111, 0b00000000, 0b00000000, 0b00000000, 0b00000111, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b01110000, 0b00000000, 0b00000000, 0b00000110, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00001110, 0b00000000, 0b00000001, 0b11000000, 0b00110000, 0b00000000, 0b00000110, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00001110, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000111, 0b00000000, 0b00000011, 0b00000000, 0b00000111, 0b00000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000111, 0b00000000, 0b00001100, 0b11000000, 0b00001110, 0b01110000, 0b00000111, 0b11000000, 0b01111100, 0b00110000, 0b00011111, 0b10000000, 0b00000011, 0b00000000, 0b00000111, 0b00000000, 0b00000111, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b11100000, 0b00011111, 0b11000000, 0b00000111, 0b10000000, 0b00111111, 0b11000000, 0b00111111, 0b11000000, 0b00000001, 0b11100000, 0b00011111, 0b11110000, 0b00000111, 0b11100000, 0b00111111, 0b11110000, 0b00011111, 0b11100000, 0b00011111, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00011111, 0b11000000, 0b00001111, 0b11100000, 0b00000111, 0b10000000, 0b01111111, 0b11000000, 0b00001111, 0b11110000, 0b01111111, 0b11000000, 0b00111111, 0b11110000, 0b00111111, 0b11110000, 0b00001111, 0b11110000, 0b01100000, 0b00110000, 0b00011111, 0b11100000, 0b00011111, 0b11100000, 0b00110000, 0b01110000, 0b00111000, 0b00000000, 0b00111000, 0b01110000, 0b01111000, 0b00110000, 0b00011111, 0b11100000, 0b00111111, 0b11100000, 0b00011111, 0b11100000, 0b01111111, 0b11000000, 0b00011111, 0b11100000, 0b01111111, 0b11110000, 0b01100000, 0b00110000, 0b11100000, 0b00011000, 0b01100000, 0b00111000, 0b00110000, 0b01110000, 0b01100000, 0b00111000, 0b00111111, 0b11110000, 0b00001100, 0b00000000, 0b00011000, 0b00000000, 0b00000001, 0b11000000, 0b00000111, 0b10000000, 0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b01110000, 0b00000000, 0b00000000, 0b00001110, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000100, 0b00000000, 0b00000000, 0b10000000, 0b00110000, 0b00000000, 0b00000110, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00001110, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000110, 0b00000000, 0b00000011, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000111, 0b00000000, 0b00001100, 0b11000000, 0b00001100, 0b01100000, 0b00011111, 0b11100000, 0b11101100, 0b01100000, 0b00111001, 0b11000000, 0b00000011, 0b00000000, 0b00000110, 0b00000000, 0b00000011, 0b10000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b11000000, 0b00111000, 0b11100000, 0b00001111, 0b10000000, 0b00110000, 0b11100000, 0b00010000, 0b11100000, 0b00000011, 0b11100000, 0b00011000, 0b00000000, 0b00001110, 0b00000000, 0b00000000, 0b01110000, 0b00111000, 0b01100000, 0b00111000, 0b11100000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b11100000, 0b00011100, 0b01110000, 0b00001111, 0b10000000, 0b01110000, 0b11100000, 0b00011100, 0b00010000, 0b01110001, 0b11100000, 0b00111000, 0b00000000, 0b00111000, 0b00000000, 0b00011100, 0b00110000, 0b01100000, 0b00110000, 0b00000011, 0b00000000, 0b00000000, 0b01100000, 0b00110000, 0b11100000, 0b00111000, 0b00000000, 0b00111000, 0b11110000, 0b01111000, 0b00110000, 0b00111000, 0b01110000, 0b00110000, 0b01110000, 0b00111000, 0b11100000, 0b01110000, 0b11100000, 0b00111000, 0b00100000, 0b00000011, 0b00000000, 0b01100000, 0b00110000, 0b01100000, 0b00111000, 0b01100000, 0b00111000, 0b00111000, 0b01100000, 0b01110000, 0b00110000, 0b00000000, 0b01110000, 0b00001100, 0b00000000, 0b00011000, 0b00000000, 0b00000001, 0b11000000, 0b00001111, 0b10000000, 0b00000000, 0b00000000, 0b00000001, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b01110000, 0b00000000, 0b00000000, 0b00001110, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000110, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00001110, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000110, 0b00000000, 0b00000011, 0b00000000, 0b00000011, 0b10000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000111, 0b00000000, 0b00001000, 0b11000000, 0b00001100, 0b01100000, 0b00111100, 0b01100000, 0b11000110, 0b01100000, 0b00110000, 0b11000000, 0b00000011, 0b00000000, 0b00001110, 0b00000000, 0b00000011, 0b10000000, 0b00111011, 0b01110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b11000000, 0b00110000, 0b01110000, 0b00111111, 0b10000000, 0b00000000, 0b01100000, 0b00000000, 0b01100000, 0b00000111, 0b11100000, 0b00011000, 0b00000000, 0b00011100, 0b00000000, 0b00000000, 0b01100000, 0b00110000, 0b01110000, 0b01110000, 0b01110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b01100000, 0b00111000, 0b00110000, 0b00001101, 0b11000000, 0b01110000, 0b01100000, 0b00111000, 0b00000000, 0b01110000, 0b01100000, 0b00111000, 0b00000000, 0b00111000, 0b00000000, 0b00111000, 0b00000000, 0b01100000, 0b00110000, 0b00000011, 0b00000000, 0b00000000, 0b01100000, 0b00110001, 0b11000000, 0b00111000, 0b00000000, 0b00111000, 0b11110000, 0b01111100, 0b00110000, 0b01110000, 0b01110000, 0b00110000, 0b00110000, 0b01110000, 0b01110000, 0b01110000, 0b01100000, 0b00110000, 0b00000000, 0b00000011, 0b00000000, 0b01100000, 0b00110000, 0b01100000, 0b00110000, 0b01100000, 0b00111000, 0b00011000, 0b11100000, 0b00110000, 0b01110000, 0b00000000, 0b11100000, 0b00001100, 0b00000000, 0b00011100, 0b00000000, 0b00000001, 0b11000000, 0b00001101, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b01110000, 0b00000000, 0b00000000, 0b00001110, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000110, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00001110, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000110, 0b00000000, 0b00000011, 0b00000000, 0b00000011, 0b10000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000111, 0b00000000, 0b00001000, 0b10000000, 0b01111111, 0b11111000, 0b00110000, 0b00000000, 0b11000110, 0b11000000, 0b00110001, 0b11000000, 0b00000011, 0b00000000, 0b00001100, 0b00000000, 0b00000001, 0b10000000, 0b00111111, 0b11110000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000001, 0b11000000, 0b00110000, 0b01110000, 0b00110011, 0b10000000, 0b00000000, 0b01100000, 0b00000000, 0b01100000, 0b00000110, 0b11100000, 0b00011000, 0b00000000, 0b00111000, 0b00000000, 0b00000000, 0b11100000, 0b00110000, 0b01110000, 0b01110000, 0b01110000, 0b00000111, 0b00000000, 0b00000111, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b01100000, 0b00110000, 0b00111000, 0b00001101, 0b11000000, 0b01110000, 0b01100000, 0b00110000, 0b00000000, 0b01110000, 0b01110000, 0b00111000, 0b00000000, 0b00111000, 0b00000000, 0b00110000, 0b00000000, 0b01100000, 0b00110000, 0b00000011, 0b00000000, 0b00000000, 0b01100000, 0b00110011, 0b10000000, 0b00111000, 0b00000000, 0b01111100, 0b11110000, 0b01111100, 0b00110000, 0b01110000, 0b00110000, 0b00110000, 0b00110000, 0b01110000, 0b00110000, 0b01110000, 0b01110000, 0b00110000, 0b00000000, 0b00000011, 0b00000000, 0b01100000, 0b00110000, 0b01110000, 0b00110000, 0b01100000, 0b00111000, 0b00011100, 0b11000000, 0b00111000, 0b01100000, 0b00000000, 0b11000000, 0b00001100, 0b00000000, 0b00001100, 0b00000000, 0b00000001, 0b11000000, 0b00011000, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00011111, 0b11000000, 0b00111111, 0b11000000, 0b00000111, 0b11110000, 0b00001111, 0b11110000, 0b00001111, 0b11000000, 0b00111111, 0b11110000, 0b00001111, 0b11100000, 0b00111111, 0b11000000, 0b01111110, 0b00000000, 0b00011111, 0b11000000, 0b00110000, 0b01110000, 0b00000110, 0b00000000, 0b01111101, 0b11100000, 0b00111111, 0b10000000, 0b00001111, 0b10000000, 0b00111111, 0b10000000, 0b00001111, 0b11100000, 0b00001111, 0b11110000, 0b00001111, 0b11100000, 0b00111111, 0b11110000, 0b00110000, 0b01110000, 0b01100000, 0b00111000, 0b11100000, 0b00011000, 0b01110000, 0b01110000, 0b01110000, 0b00110000, 0b00111111, 0b11100000, 0b00000110, 0b00000000, 0b00000011, 0b00000000, 0b00000011, 0b10000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000111, 0b00000000, 0b00000000, 0b00000000, 0b01111111, 0b11111000, 0b00110000, 0b00000000, 0b11001101, 0b11000000, 0b00110001, 0b10000000, 0b00000000, 0b00000000, 0b00001100, 0b00000000, 0b00000001, 0b11000000, 0b00001111, 0b10000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000001, 0b10000000, 0b01110000, 0b00110000, 0b00000011, 0b10000000, 0b00000000, 0b01100000, 0b00000000, 0b01100000, 0b00001100, 0b11100000, 0b00011000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b11000000, 0b00110000, 0b01110000, 0b01110000, 0b00110000, 0b00000111, 0b10000000, 0b00000111, 0b10000000, 0b00000000, 0b01110000, 0b00000000, 0b00000000, 0b01110000, 0b00000000, 0b00000000, 0b11100000, 0b00110000, 0b11111000, 0b00011100, 0b11000000, 0b01110000, 0b01100000, 0b00110000, 0b00000000, 0b01110000, 0b00110000, 0b00111000, 0b00000000, 0b00111000, 0b00000000, 0b00110000, 0b00000000, 0b01100000, 0b00110000, 0b00000011, 0b00000000, 0b00000000, 0b01100000, 0b00110011, 0b10000000, 0b00111000, 0b00000000, 0b01101101, 0b10110000, 0b01111110, 0b00110000, 0b01100000, 0b00111000, 0b00110000, 0b00110000, 0b01100000, 0b00111000, 0b01110000, 0b01110000, 0b00110000, 0b00000000, 0b00000011, 0b00000000, 0b01100000, 0b00110000, 0b00110000, 0b00110000, 0b01100000, 0b00110000, 0b00001101, 0b11000000, 0b00011000, 0b11100000, 0b00000001, 0b11000000, 0b00001100, 0b00000000, 0b00001100, 0b00000000, 0b00000001, 0b11000000, 0b00011000, 0b11100000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00011111, 0b11100000, 0b00111111, 0b11100000, 0b00011111, 0b11110000, 0b00011111, 0b11110000, 0b00011111, 0b11100000, 0b00111111, 0b11100000, 0b00011111, 0b11110000, 0b00111111, 0b11100000, 0b01111110, 0b00000000, 0b00011111, 0b11000000, 0b00110000, 0b11100000, 0b00000110, 0b00000000, 0b01111111, 0b11110000, 0b00111111, 0b11100000, 0b00011111, 0b11100000, 0b00111111, 0b11100000, 0b00011111, 0b11110000, 0b00011111, 0b11110000, 0b00011111, 0b11100000, 0b00111111, 0b11110000, 0b00110000, 0b01110000, 0b01110000, 0b00110000, 0b11100000, 0b00011000, 0b00111000, 0b01100000, 0b00110000, 0b00110000, 0b00111111, 0b11100000, 0b00000110, 0b00000000, 0b00000011, 0b00000000, 0b00000011, 0b10000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000111, 0b00000000, 0b00000000, 0b00000000, 0b00011100, 0b11100000, 0b00111000, 0b00000000, 0b01101101, 0b10000000, 0b00011011, 0b10000000, 0b00000000, 0b00000000, 0b00011100, 0b00000000, 0b00000000, 0b11000000, 0b00000111, 0b10000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000001, 0b10000000, 0b01110111, 0b00110000, 0b00000011, 0b10000000, 0b00000000, 0b11100000, 0b00000001, 0b11000000, 0b00011100, 0b11100000, 0b00011111, 0b00000000, 0b00110111, 0b10000000, 0b00000001, 0b11000000, 0b00111000, 0b01100000, 0b01110000, 0b00110000, 0b00000111, 0b10000000, 0b00000111, 0b10000000, 0b00000001, 0b11110000, 0b01111111, 0b11110000, 0b00111110, 0b00000000, 0b00000001, 0b11000000, 0b01110011, 0b11111000, 0b00011000, 0b11000000, 0b01110000, 0b11100000, 0b01110000, 0b00000000, 0b01110000, 0b00110000, 0b00111000, 0b00000000, 0b00111000, 0b00000000, 0b01110000, 0b00000000, 0b01100000, 0b00110000, 0b00000011, 0b00000000, 0b00000000, 0b01100000, 0b00110111, 0b00000000, 0b00111000, 0b00000000, 0b01101101, 0b10110000, 0b01110110, 0b00110000, 0b01100000, 0b00111000, 0b00110000, 0b00110000, 0b01100000, 0b00111000, 0b01110000, 0b01100000, 0b00111100, 0b00000000, 0b00000011, 0b00000000, 0b01100000, 0b00110000, 0b00110000, 0b01110000, 0b01100011, 0b00110000, 0b00001111, 0b10000000, 0b00011100, 0b11000000, 0b00000011, 0b10000000, 0b00001100, 0b00000000, 0b00001110, 0b00000000, 0b00000001, 0b11000000, 0b00110000, 0b01100000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b01100000, 0b00111000, 0b01100000, 0b00111100, 0b00000000, 0b00111000, 0b01110000, 0b00111000, 0b01110000, 0b00001110, 0b00000000, 0b00111000, 0b01110000, 0b00110000, 0b11100000, 0b00000110, 0b00000000, 0b00000000, 0b11000000, 0b00110001, 0b11000000, 0b00000110, 0b00000000, 0b01100111, 0b00111000, 0b00110000, 0b11100000, 0b00111000, 0b11100000, 0b00110000, 0b11100000, 0b00111000, 0b01110000, 0b00011000, 0b00000000, 0b00111000, 0b00000000, 0b00001110, 0b00000000, 0b00110000, 0b01110000, 0b01110000, 0b00110000, 0b01100000, 0b00011000, 0b00011000, 0b11100000, 0b00110000, 0b01110000, 0b00000000, 0b11100000, 0b00000110, 0b00000000, 0b00000011, 0b00000000, 0b00000011, 0b10000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000111, 0b00000000, 0b00000000, 0b00000000, 0b00011000, 0b11100000, 0b00111100, 0b00000000, 0b00111011, 0b00000000, 0b00011111, 0b00000000, 0b00000000, 0b00000000, 0b00011000, 0b00000000, 0b00000000, 0b11000000, 0b00001101, 0b11000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000011, 0b10000000, 0b01110111, 0b00110000, 0b00000011, 0b10000000, 0b00000000, 0b11000000, 0b00001111, 0b10000000, 0b00011000, 0b11100000, 0b00011111, 0b11000000, 0b01111111, 0b11100000, 0b00000001, 0b10000000, 0b00011100, 0b11000000, 0b00111000, 0b00110000, 0b00000111, 0b00000000, 0b00000111, 0b00000000, 0b00000111, 0b11000000, 0b01111111, 0b11110000, 0b00001111, 0b10000000, 0b00000011, 0b10000000, 0b01110011, 0b10111000, 0b00011000, 0b11100000, 0b01111111, 0b11000000, 0b01110000, 0b00000000, 0b01110000, 0b00110000, 0b00111111, 0b11100000, 0b00111111, 0b11100000, 0b01110000, 0b00000000, 0b01111111, 0b11110000, 0b00000011, 0b00000000, 0b00000000, 0b01100000, 0b00111110, 0b00000000, 0b00111000, 0b00000000, 0b01100111, 0b10110000, 0b01110111, 0b00110000, 0b01100000, 0b00111000, 0b00110000, 0b01110000, 0b01100000, 0b00111000, 0b01110000, 0b11100000, 0b00011111, 0b00000000, 0b00000011, 0b00000000, 0b01100000, 0b00110000, 0b00111000, 0b01100000, 0b01100111, 0b00110000, 0b00000111, 0b00000000, 0b00001101, 0b11000000, 0b00000011, 0b00000000, 0b00001100, 0b00000000, 0b00000110, 0b00000000, 0b00000001, 0b11000000, 0b01110000, 0b00110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b01110000, 0b00110000, 0b01110000, 0b00110000, 0b00000000, 0b01110000, 0b01110000, 0b01110000, 0b00110000, 0b00001110, 0b00000000, 0b01110000, 0b01110000, 0b00110000, 0b01110000, 0b00000110, 0b00000000, 0b00000000, 0b11000000, 0b00110011, 0b10000000, 0b00000110, 0b00000000, 0b01100011, 0b00111000, 0b00110000, 0b01110000, 0b01110000, 0b01110000, 0b00110000, 0b01110000, 0b01110000, 0b01110000, 0b00011000, 0b00000000, 0b00110000, 0b00000000, 0b00001110, 0b00000000, 0b00110000, 0b01110000, 0b00110000, 0b01110000, 0b01100011, 0b00111000, 0b00011101, 0b11000000, 0b00111000, 0b01110000, 0b00000001, 0b11000000, 0b00000110, 0b00000000, 0b00000011, 0b00000000, 0b00000011, 0b10000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00011000, 0b11000000, 0b00011111, 0b00000000, 0b00000011, 0b11110000, 0b00011110, 0b00110000, 0b00000000, 0b00000000, 0b00011000, 0b00000000, 0b00000000, 0b11000000, 0b00011100, 0b11100000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b01110111, 0b00110000, 0b00000011, 0b10000000, 0b00000001, 0b11000000, 0b00000111, 0b11000000, 0b00110000, 0b11100000, 0b00000011, 0b11100000, 0b01111000, 0b11100000, 0b00000011, 0b10000000, 0b00001111, 0b11000000, 0b00111111, 0b11110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00111111, 0b00000000, 0b00000000, 0b00000000, 0b00000011, 0b11100000, 0b00000011, 0b00000000, 0b01110111, 0b00111000, 0b00111000, 0b01100000, 0b01111111, 0b11000000, 0b01110000, 0b00000000, 0b01110000, 0b00111000, 0b00111111, 0b11100000, 0b00111111, 0b11100000, 0b01110000, 0b00000000, 0b01111111, 0b11110000, 0b00000011, 0b00000000, 0b00000000, 0b01100000, 0b00111110, 0b00000000, 0b00111000, 0b00000000, 0b01100111, 0b10110000, 0b01110011, 0b00110000, 0b01100000, 0b00011000, 0b00110000, 0b11100000, 0b01100000, 0b00011000, 0b01111111, 0b11000000, 0b00000111, 0b11000000, 0b00000011, 0b00000000, 0b01100000, 0b00110000, 0b00111000, 0b01100000, 0b01100111, 0b00110000, 0b00000111, 0b10000000, 0b00001111, 0b10000000, 0b00000111, 0b00000000, 0b00001100, 0b00000000, 0b00000110, 0b00000000, 0b00000001, 0b11000000, 0b01100000, 0b00110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b01110000, 0b00110000, 0b00110000, 0b01110000, 0b00000000, 0b01110000, 0b01110000, 0b01100000, 0b00110000, 0b00001110, 0b00000000, 0b01110000, 0b01110000, 0b00110000, 0b01110000, 0b00000110, 0b00000000, 0b00000000, 0b11000000, 0b00110111, 0b00000000, 0b00000110, 0b00000000, 0b01100011, 0b00111000, 0b00110000, 0b01110000, 0b01110000, 0b00110000, 0b00110000, 0b00110000, 0b01110000, 0b01110000, 0b00011000, 0b00000000, 0b00111000, 0b00000000, 0b00001110, 0b00000000, 0b00110000, 0b01110000, 0b00111000, 0b01100000, 0b01100111, 0b00111000, 0b00001111, 0b10000000, 0b00111000, 0b01100000, 0b00000011, 0b10000000, 0b00001110, 0b00000000, 0b00000011, 0b00000000, 0b00000001, 0b10000000, 0b00011100, 0b00000000,
-    0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00011000, 0b11000000, 0b00000111, 0b11000000, 0b00000111, 0b11111000, 0b00111111, 0b00110000, 0b00000000, 0b00000000, 0b00011000, 0b00000000, 0b00000000, 0b11000000, 0b00001000, 0b11000000, 0b01111111, 0b11110000, 0b00000000, 0b00000000, 0b00001111, 0b11000000, 0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b01110010, 0b00110000, 0b00000011, 0b10000000, 0b00000011, 0b10000000, 0b00000000, 0b11100000, 0b00110000, 0b11100000, 0b00000000, 0b01110000, 0b01110000, 0b01110000, 0b00000011, 0b00000000, 0b00011001, 0b11100000, 0b00011111, 0b11110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b01111000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b11111000, 0b00000110, 0b00000000, 0b01110110, 0b00111000, 0b00110000, 0b01100000, 0b01110000, 0b11100000, 0b01110000, 0b00000000, 0b01110000, 0b00110000, 0b00111000, 0b00000000, 0b00111000, 0b00000000, 0b01110000, 0b00110000, 0b01100000, 0b00110000, 0b00000011, 0b00000000, 0b00000000, 0b01100000, 0b00111111, 0b00000000, 0b00111000, 0b00000000, 0b01100111, 0b00110000, 0b01110011, 0b10110000, 0b01100000, 0b00111000, 0b00111111, 0b11000000, 0b01100000, 0b00111000, 0b01111111, 0b10000000, 0b00000001, 0b11100000, 0b00000011, 0b00000000, 0b01100000, 0b00110000, 0b00011000, 0b11100000, 0b01100111, 0b10110000, 0b00001111, 0b10000000, 0b00000111, 0b10000000, 0b00000110, 0b00000000, 0b00001100, 0b00000000, 0b00000111, 0b00000000, 0b00000001, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00001111, 0b11110000, 0b00110000, 0b00110000, 0b01110000, 0b00000000, 0b01100000, 0b01110000, 0b01111111, 0b11110000, 0b00001110, 0b00000000, 0b01100000, 0b01110000, 0b00110000, 0b01110000, 0b00000110, 0b00000000, 0b00000000, 0b11000000, 0b00111110, 0b00000000, 0b00000110, 0b00000000, 0b01100011, 0b00111000, 0b00110000, 0b01110000, 0b01100000, 0b00110000, 0b00110000, 0b00110000, 0b01100000, 0b01110000, 0b00011000, 0b00000000, 0b00011111, 0b00000000, 0b00001110, 0b00000000, 0b00110000, 0b01110000, 0b00111000, 0b01100000, 0b01100111, 0b00110000, 0b00000111, 0b10000000, 0b00011000, 0b01100000, 0b00000011, 0b00000000, 0b00111100, 0b00000000, 0b00000011, 0b00000000, 0b00000001, 0b11100000, 0b00111111, 0b00110000,
-    0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00011000, 0b11000000, 0b00000001, 0b11100000, 0b00001111, 0b10011000, 0b01110011, 0b11100000, 0b00000000, 0b00000000, 0b00011000, 0b00000000, 0b00000000, 0b11000000, 0b00000000, 0b00000000, 0b01111111, 0b11110000, 0b00000000, 0b00000000, 0b00001111, 0b11000000, 0b00000000, 0b00000000, 0b00000111, 0b00000000, 0b01110000, 0b00110000, 0b00000011, 0b10000000, 0b00000111, 0b00000000, 0b00000000, 0b01110000, 0b01100000, 0b11100000, 0b00000000, 0b01110000, 0b01110000, 0b00110000, 0b00000111, 0b00000000, 0b00110000, 0b01110000, 0b00000000, 0b01110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b01111000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b11111000, 0b00000110, 0b00000000, 0b01110110, 0b00111000, 0b00110000, 0b01110000, 0b01110000, 0b01110000, 0b01110000, 0b00000000, 0b01110000, 0b00110000, 0b00111000, 0b00000000, 0b00111000, 0b00000000, 0b01110000, 0b00110000, 0b01100000, 0b00110000, 0b00000011, 0b00000000, 0b00000000, 0b01100000, 0b00110011, 0b10000000, 0b00111000, 0b00000000, 0b01100011, 0b00110000, 0b01110001, 0b10110000, 0b01100000, 0b00111000, 0b00111111, 0b10000000, 0b01100000, 0b00111000, 0b01110001, 0b10000000, 0b00000000, 0b01110000, 0b00000011, 0b00000000, 0b01100000, 0b00110000, 0b00011000, 0b11000000, 0b01101101, 0b10110000, 0b00001101, 0b11000000, 0b00000111, 0b00000000, 0b00001110, 0b00000000, 0b00001100, 0b00000000, 0b00000011, 0b00000000, 0b00000001, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00111111, 0b11110000, 0b00110000, 0b00111000, 0b01110000, 0b00000000, 0b01100000, 0b01110000, 0b01111111, 0b11110000, 0b00001110, 0b00000000, 0b01100000, 0b01110000, 0b00110000, 0b01110000, 0b00000110, 0b00000000, 0b00000000, 0b11000000, 0b00111110, 0b00000000, 0b00000110, 0b00000000, 0b01100011, 0b00111000, 0b00110000, 0b01110000, 0b01100000, 0b00110000, 0b00110000, 0b00111000, 0b01100000, 0b01110000, 0b00011000, 0b00000000, 0b00001111, 0b11000000, 0b00001110, 0b00000000, 0b00110000, 0b01110000, 0b00011000, 0b11100000, 0b01100111, 0b10110000, 0b00000111, 0b10000000, 0b00011100, 0b11100000, 0b00000111, 0b00000000, 0b00111100, 0b00000000, 0b00000011, 0b00000000, 0b00000001, 0b11100000, 0b01100111, 0b11110000,
-    0b00000000, 0b00000000, 0b00000010, 0b00000000, 0b00000000, 0b00000000, 0b01111111, 0b11111000, 0b00000000, 0b01110000, 0b00001101, 0b10011000, 0b01100001, 0b11100000, 0b00000000, 0b00000000, 0b00011000, 0b00000000, 0b00000000, 0b11000000, 0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000111, 0b00000000, 0b01110000, 0b00110000, 0b00000011, 0b10000000, 0b00001110, 0b00000000, 0b00000000, 0b00110000, 0b01111111, 0b11111000, 0b00000000, 0b00110000, 0b01110000, 0b00110000, 0b00000111, 0b00000000, 0b01110000, 0b00110000, 0b00000000, 0b01110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00111111, 0b00000000, 0b01111111, 0b11110000, 0b00000011, 0b11100000, 0b00000000, 0b00000000, 0b01110110, 0b00111000, 0b01111111, 0b11110000, 0b01110000, 0b00110000, 0b01110000, 0b00000000, 0b01110000, 0b00110000, 0b00111000, 0b00000000, 0b00111000, 0b00000000, 0b00110000, 0b00110000, 0b01100000, 0b00110000, 0b00000011, 0b00000000, 0b00000000, 0b01100000, 0b00110001, 0b11000000, 0b00111000, 0b00000000, 0b01100000, 0b00110000, 0b01110001, 0b10110000, 0b01100000, 0b00111000, 0b00110000, 0b00000000, 0b01100000, 0b00111000, 0b01110001, 0b11000000, 0b00000000, 0b01110000, 0b00000011, 0b00000000, 0b01110000, 0b00110000, 0b00011100, 0b11000000, 0b01101101, 0b10110000, 0b00011100, 0b11000000, 0b00000011, 0b00000000, 0b00011100, 0b00000000, 0b00001100, 0b00000000, 0b00000011, 0b00000000, 0b00000001, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00111000, 0b01110000, 0b00110000, 0b00110000, 0b01110000, 0b00000000, 0b01100000, 0b01110000, 0b01100000, 0b00000000, 0b00001110, 0b00000000, 0b01100000, 0b01110000, 0b00110000, 0b01110000, 0b00000110, 0b00000000, 0b00000000, 0b11000000, 0b00110111, 0b00000000, 0b00000110, 0b00000000, 0b01100011, 0b00111000, 0b00110000, 0b01110000, 0b01100000, 0b00110000, 0b00110000, 0b00110000, 0b01100000, 0b01110000, 0b00011000, 0b00000000, 0b00000001, 0b11100000, 0b00001110, 0b00000000, 0b00110000, 0b01110000, 0b00011100, 0b11000000, 0b01111101, 0b10110000, 0b00001111, 0b10000000, 0b00001100, 0b11100000, 0b00001110, 0b00000000, 0b00001110, 0b00000000, 0b00000011, 0b00000000, 0b00000001, 0b10000000, 0b01100001, 0b11100000,
-    0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b01111111, 0b11111000, 0b00000000, 0b01110000, 0b00011001, 0b10011000, 0b01100001, 0b11100000, 0b00000000, 0b00000000, 0b00011100, 0b00000000, 0b00000000, 0b11000000, 0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000110, 0b00000000, 0b00110000, 0b01110000, 0b00000011, 0b10000000, 0b00011100, 0b00000000, 0b00000000, 0b00110000, 0b01111111, 0b11111000, 0b00000000, 0b00110000, 0b00110000, 0b00110000, 0b00000110, 0b00000000, 0b01110000, 0b00110000, 0b00000000, 0b11100000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000111, 0b11000000, 0b01111111, 0b11110000, 0b00001111, 0b10000000, 0b00000000, 0b00000000, 0b01110111, 0b00111000, 0b01111111, 0b11110000, 0b01110000, 0b00110000, 0b00110000, 0b00000000, 0b01110000, 0b01110000, 0b00111000, 0b00000000, 0b00111000, 0b00000000, 0b00110000, 0b00110000, 0b01100000, 0b00110000, 0b00000011, 0b00000000, 0b00000000, 0b01100000, 0b00110000, 0b11100000, 0b00111000, 0b00000000, 0b01100000, 0b00111000, 0b01110000, 0b11110000, 0b01110000, 0b00110000, 0b00110000, 0b00000000, 0b01100000, 0b00111000, 0b01110000, 0b11000000, 0b00000000, 0b00110000, 0b00000011, 0b00000000, 0b01110000, 0b00110000, 0b00001101, 0b11000000, 0b01111100, 0b11110000, 0b00011000, 0b11100000, 0b00000011, 0b00000000, 0b00011000, 0b00000000, 0b00001100, 0b00000000, 0b00000011, 0b10000000, 0b00000001, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b01110000, 0b00110000, 0b00110000, 0b01110000, 0b00000000, 0b01110000, 0b01110000, 0b01110000, 0b00000000, 0b00001110, 0b00000000, 0b01110000, 0b01110000, 0b00110000, 0b01110000, 0b00000110, 0b00000000, 0b00000000, 0b11000000, 0b00110011, 0b10000000, 0b00000110, 0b00000000, 0b01100000, 0b00111000, 0b00110000, 0b01110000, 0b01110000, 0b00110000, 0b00110000, 0b00110000, 0b01110000, 0b01110000, 0b00011000, 0b00000000, 0b00000000, 0b01110000, 0b00001110, 0b00000000, 0b00110000, 0b01110000, 0b00001101, 0b11000000, 0b00111101, 0b10110000, 0b00001101, 0b11000000, 0b00001100, 0b11000000, 0b00001100, 0b00000000, 0b00000110, 0b00000000, 0b00000011, 0b00000000, 0b00000011, 0b10000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000010, 0b00000000, 0b00000000, 0b00000000, 0b00110001, 0b10000000, 0b00000000, 0b01110000, 0b00011001, 0b10011000, 0b01100000, 0b11100000, 0b00000000, 0b00000000, 0b00001100, 0b00000000, 0b00000000, 0b11000000, 0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00000011, 0b10000000, 0b00000000, 0b00000000, 0b00000111, 0b00000000, 0b00001110, 0b00000000, 0b00110000, 0b01110000, 0b00000011, 0b10000000, 0b00011000, 0b00000000, 0b00000000, 0b01110000, 0b00000000, 0b11100000, 0b00000000, 0b01110000, 0b00110000, 0b01110000, 0b00000110, 0b00000000, 0b01110000, 0b00110000, 0b00000000, 0b11100000, 0b00000111, 0b00000000, 0b00000111, 0b00000000, 0b00000001, 0b11110000, 0b00000000, 0b00000000, 0b00111110, 0b00000000, 0b00000110, 0b00000000, 0b01110111, 0b00111000, 0b01100000, 0b00110000, 0b01110000, 0b00110000, 0b00111000, 0b00000000, 0b01110000, 0b01100000, 0b00111000, 0b00000000, 0b00111000, 0b00000000, 0b00111000, 0b00110000, 0b01100000, 0b00110000, 0b00000011, 0b00000000, 0b00000000, 0b01100000, 0b00110000, 0b11100000, 0b00111000, 0b00000000, 0b01100000, 0b00111000, 0b01110000, 0b11110000, 0b01110000, 0b01110000, 0b00110000, 0b00000000, 0b01110000, 0b00110000, 0b01110000, 0b11100000, 0b00000000, 0b00110000, 0b00000011, 0b00000000, 0b01110000, 0b01110000, 0b00001101, 0b10000000, 0b00111000, 0b11110000, 0b00111000, 0b01100000, 0b00000011, 0b00000000, 0b00111000, 0b00000000, 0b00001100, 0b00000000, 0b00000001, 0b10000000, 0b00000001, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b01110000, 0b01110000, 0b00110000, 0b01110000, 0b00110000, 0b00000000, 0b00110000, 0b01110000, 0b00110000, 0b00000000, 0b00001110, 0b00000000, 0b01110000, 0b01110000, 0b00110000, 0b01110000, 0b00000110, 0b00000000, 0b00000000, 0b11000000, 0b00110001, 0b11000000, 0b00000110, 0b00000000, 0b01100000, 0b00111000, 0b00110000, 0b01110000, 0b01110000, 0b01110000, 0b00110000, 0b01110000, 0b01110000, 0b01110000, 0b00011000, 0b00000000, 0b00000000, 0b01110000, 0b00001110, 0b00000000, 0b00110000, 0b01110000, 0b00001101, 0b10000000, 0b00111100, 0b11110000, 0b00011000, 0b11100000, 0b00001110, 0b11000000, 0b00011100, 0b00000000, 0b00000110, 0b00000000, 0b00000011, 0b00000000, 0b00000011, 0b10000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000111, 0b00000000, 0b00000000, 0b00000000, 0b00110001, 0b10000000, 0b00100000, 0b01110000, 0b00110001, 0b10011000, 0b01110001, 0b11110000, 0b00000000, 0b00000000, 0b00001100, 0b00000000, 0b00000001, 0b11000000, 0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00000011, 0b11000000, 0b00000000, 0b00000000, 0b00000111, 0b10000000, 0b00001110, 0b00000000, 0b00111000, 0b11100000, 0b00000011, 0b10000000, 0b00111000, 0b00000000, 0b00100000, 0b11100000, 0b00000000, 0b11100000, 0b00100000, 0b11100000, 0b00111000, 0b01100000, 0b00001110, 0b00000000, 0b00110000, 0b01110000, 0b00000011, 0b11000000, 0b00000111, 0b10000000, 0b00000111, 0b10000000, 0b00000000, 0b01110000, 0b00000000, 0b00000000, 0b01110000, 0b00000000, 0b00001111, 0b00000000, 0b00110011, 0b11111000, 0b01100000, 0b00111000, 0b01110000, 0b01110000, 0b00011100, 0b00010000, 0b01110000, 0b11100000, 0b00111000, 0b00000000, 0b00111000, 0b00000000, 0b00011100, 0b00110000, 0b01100000, 0b00110000, 0b00000011, 0b00000000, 0b00100000, 0b11100000, 0b00110000, 0b01110000, 0b00111000, 0b00000000, 0b01100000, 0b00111000, 0b01110000, 0b11110000, 0b00111000, 0b01110000, 0b00110000, 0b00000000, 0b00110000, 0b01110000, 0b01110000, 0b01100000, 0b00100000, 0b01110000, 0b00000011, 0b00000000, 0b00111000, 0b01110000, 0b00001111, 0b10000000, 0b00111000, 0b11110000, 0b00110000, 0b01110000, 0b00000011, 0b00000000, 0b00110000, 0b00000000, 0b00001100, 0b00000000, 0b00000001, 0b10000000, 0b00000001, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00111000, 0b01110000, 0b00110000, 0b11100000, 0b00111100, 0b00000000, 0b00111000, 0b01110000, 0b00111000, 0b00000000, 0b00001110, 0b00000000, 0b00111000, 0b01110000, 0b00110000, 0b01110000, 0b00000111, 0b00000000, 0b00000000, 0b11000000, 0b00110000, 0b11100000, 0b00000111, 0b00000000, 0b01100000, 0b00111000, 0b00110000, 0b01110000, 0b00111000, 0b11100000, 0b00111000, 0b11100000, 0b00111000, 0b01110000, 0b00011000, 0b00000000, 0b00100000, 0b01110000, 0b00000110, 0b00000000, 0b00111000, 0b01110000, 0b00001111, 0b10000000, 0b00111000, 0b11110000, 0b00111000, 0b01100000, 0b00000111, 0b11000000, 0b00111000, 0b00000000, 0b00000110, 0b00000000, 0b00000011, 0b00000000, 0b00000011, 0b10000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000111, 0b10000000, 0b00000000, 0b00000000, 0b00110001, 0b10000000, 0b00111111, 0b11100000, 0b01110001, 0b11111000, 0b00111111, 0b11110000, 0b00000000, 0b00000000, 0b00001110, 0b00000000, 0b00000001, 0b10000000, 0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00000011, 0b11000000, 0b00000000, 0b00000000, 0b00000111, 0b10000000, 0b00001100, 0b00000000, 0b00011111, 0b11000000, 0b00011111, 0b11110000, 0b00111111, 0b11110000, 0b00111111, 0b11100000, 0b00000000, 0b11100000, 0b00111111, 0b11100000, 0b00011111, 0b11100000, 0b00001110, 0b00000000, 0b00111111, 0b11100000, 0b00111111, 0b10000000, 0b00000111, 0b10000000, 0b00000111, 0b10000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00001111, 0b00000000, 0b00111001, 0b11111000, 0b11100000, 0b00011000, 0b01111111, 0b11100000, 0b00001111, 0b11110000, 0b01111111, 0b11000000, 0b00111111, 0b11110000, 0b00111000, 0b00000000, 0b00001111, 0b11110000, 0b01100000, 0b00110000, 0b00011111, 0b11100000, 0b01111111, 0b11000000, 0b00110000, 0b00111000, 0b00111111, 0b11110000, 0b01100000, 0b00111000, 0b01110000, 0b01110000, 0b00011111, 0b11100000, 0b00110000, 0b00000000, 0b00111000, 0b11100000, 0b01110000, 0b01110000, 0b00111111, 0b11100000, 0b00000011, 0b00000000, 0b00011111, 0b11100000, 0b00000111, 0b10000000, 0b00111000, 0b01110000, 0b01110000, 0b00110000, 0b00000011, 0b00000000, 0b01111111, 0b11110000, 0b00001100, 0b00000000, 0b00000001, 0b11000000, 0b00000001, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00111111, 0b11110000, 0b00111111, 0b11100000, 0b00011111, 0b11110000, 0b00011111, 0b11110000, 0b00011111, 0b11100000, 0b00001110, 0b00000000, 0b00011111, 0b11110000, 0b00110000, 0b01110000, 0b00000011, 0b11110000, 0b00000000, 0b11000000, 0b00110000, 0b01110000, 0b00000011, 0b11110000, 0b01100000, 0b00111000, 0b00110000, 0b01110000, 0b00011111, 0b11100000, 0b00111111, 0b11100000, 0b00011111, 0b11110000, 0b00011000, 0b00000000, 0b00111111, 0b11100000, 0b00000111, 0b11110000, 0b00011111, 0b11110000, 0b00000111, 0b00000000, 0b00111000, 0b01100000, 0b00110000, 0b01110000, 0b00000111, 0b10000000, 0b00111111, 0b11110000, 0b00000110, 0b00000000, 0b00000011, 0b00000000, 0b00000011, 0b10000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000111, 0b00000000, 0b00000000, 0b00000000, 0b00110001, 0b10000000, 0b00111111, 0b11000000, 0b01100000, 0b11110000, 0b00011111, 0b00111000, 0b00000000, 0b00000000, 0b00000110, 0b00000000, 0b00000011, 0b10000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000011, 0b11000000, 0b00000000, 0b00000000, 0b00000111, 0b00000000, 0b00001100, 0b00000000, 0b00001111, 0b10000000, 0b00011111, 0b11110000, 0b00111111, 0b11110000, 0b00111111, 0b10000000, 0b00000000, 0b11100000, 0b00111111, 0b10000000, 0b00001111, 0b11000000, 0b00001110, 0b00000000, 0b00011111, 0b11000000, 0b00111110, 0b00000000, 0b00000111, 0b00000000, 0b00000111, 0b10000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000111, 0b00000000, 0b00111000, 0b00000000, 0b11100000, 0b00011000, 0b01111111, 0b11000000, 0b00000111, 0b11110000, 0b01111111, 0b00000000, 0b00111111, 0b11111000, 0b00111000, 0b00000000, 0b00000111, 0b11110000, 0b01100000, 0b00110000, 0b00111111, 0b11100000, 0b00011111, 0b10000000, 0b00110000, 0b00011000, 0b00111111, 0b11111000, 0b01100000, 0b00111000, 0b01110000, 0b01110000, 0b00001111, 0b10000000, 0b00110000, 0b00000000, 0b00011111, 0b11100000, 0b01110000, 0b00110000, 0b00011111, 0b11000000, 0b00000011, 0b00000000, 0b00001111, 0b11000000, 0b00000111, 0b00000000, 0b00110000, 0b01100000, 0b01100000, 0b00111000, 0b00000011, 0b00000000, 0b01111111, 0b11111000, 0b00001100, 0b00000000, 0b00000001, 0b11000000, 0b00000001, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00001111, 0b11110000, 0b00111111, 0b10000000, 0b00000111, 0b11110000, 0b00001111, 0b11100000, 0b00001111, 0b11100000, 0b00001110, 0b00000000, 0b00001111, 0b11110000, 0b00110000, 0b01110000, 0b00000001, 0b11110000, 0b00000000, 0b11000000, 0b00110000, 0b00111000, 0b00000001, 0b11110000, 0b01100000, 0b00111000, 0b00110000, 0b01110000, 0b00001111, 0b10000000, 0b00111111, 0b11000000, 0b00001111, 0b11110000, 0b00011000, 0b00000000, 0b00111111, 0b11000000, 0b00000011, 0b11110000, 0b00001111, 0b11100000, 0b00000111, 0b00000000, 0b00110000, 0b01100000, 0b01100000, 0b00111000, 0b00000011, 0b10000000, 0b00111111, 0b11110000, 0b00000110, 0b00000000, 0b00000011, 0b00000000, 0b00000011, 0b10000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000111, 0b00000000, 0b00000111, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000001, 0b10000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00011100, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00011100, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00001111, 0b10000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00001100, 0b00000000, 0b00000000, 0b11000000, 0b00000001, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b01110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b01110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000110, 0b00000000, 0b00000011, 0b00000000, 0b00000011, 0b10000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000011, 0b10000000, 0b00000111, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000111, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00011000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00001111, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00011110, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00001100, 0b00000000, 0b00000000, 0b11100000, 0b00000001, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b01100000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b01110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000110, 0b00000000, 0b00000011, 0b00000000, 0b00000011, 0b10000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000001, 0b11000000, 0b00001110, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00001110, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00011000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00011110, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00001111, 0b11100000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000011, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00001100, 0b00000000, 0b00000000, 0b11100000, 0b00000001, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b11100000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000001, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b01110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000110, 0b00000000, 0b00000000, 0b00000000, 0b00000110, 0b00000000, 0b00000011, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b11000000, 0b00011100, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000100, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00111000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00001000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000011, 0b11100000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000001, 0b11110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00001111, 0b11000000, 0b00000000, 0b01100000, 0b00011111, 0b11000000, 0b00000000, 0b00000000, 0b11111111, 0b11111000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00111111, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00111111, 0b10000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b01110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b01111110, 0b00000000, 0b00000000, 0b00000000, 0b00000011, 0b11100000, 0b00000011, 0b00000000, 0b00111111, 0b00000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00001000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b01110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00001111, 0b11000000, 0b00000000, 0b01100000, 0b00011111, 0b11000000, 0b00000000, 0b00000000, 0b11111111, 0b11111000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00111111, 0b10000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00111111, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b01110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b01111100, 0b00000000, 0b00000000, 0b00000000, 0b00000011, 0b11110000, 0b00000011, 0b00000000, 0b00111110, 0b00000000, 0b00000000, 0b00000000
+static const uint8_t __font_ubuntu_mono_16x24_bitmap[] = {
+    // U+0021 '!'
+    0b11100000,
+    0b11100000,
+    0b11100000,
+    0b11100000,
+    0b11100000,
+    0b11100000,
+    0b11100000,
+    0b11100000,
+    0b01100000,
+    0b01100000,
+    0b01100000,
+    0b01000000,
+    0b00000000,
+    0b01000000,
+    0b11100000,
+    0b11110000,
+    0b11100000,
+    // U+0022 '"'
+    0b11001100,
+    0b11001100,
+    0b11001100,
+    0b11001100,
+    0b11001100,
+    0b10001100,
+    0b10001000,
+    // U+0023 '#'
+    0b00001100, 0b01100000,
+    0b00011100, 0b11100000,
+    0b00011000, 0b11000000,
+    0b00011000, 0b11000000,
+    0b11111111, 0b11110000,
+    0b11111111, 0b11110000,
+    0b00111001, 0b11000000,
+    0b00110001, 0b11000000,
+    0b00110001, 0b10000000,
+    0b00110001, 0b10000000,
+    0b00110001, 0b10000000,
+    0b11111111, 0b11110000,
+    0b11111111, 0b11110000,
+    0b01100011, 0b00000000,
+    0b01100011, 0b00000000,
+    0b01100011, 0b00000000,
+    0b01100011, 0b00000000,
+    // U+0024 '$'
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00011111, 0b00000000,
+    0b01111111, 0b10000000,
+    0b11110001, 0b10000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11110000, 0b00000000,
+    0b01111100, 0b00000000,
+    0b00011111, 0b00000000,
+    0b00000111, 0b10000000,
+    0b00000001, 0b11000000,
+    0b00000001, 0b11000000,
+    0b00000001, 0b11000000,
+    0b10000001, 0b11000000,
+    0b11111111, 0b10000000,
+    0b11111111, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    // U+0025 '%'
+    0b00111000, 0b00110000,
+    0b01111100, 0b00110000,
+    0b11101100, 0b01100000,
+    0b11000110, 0b01100000,
+    0b11000110, 0b11000000,
+    0b11001101, 0b11000000,
+    0b01101101, 0b10000000,
+    0b00111011, 0b00000000,
+    0b00000011, 0b11110000,
+    0b00000111, 0b11111000,
+    0b00001111, 0b10011000,
+    0b00001101, 0b10011000,
+    0b00011001, 0b10011000,
+    0b00011001, 0b10011000,
+    0b00110001, 0b10011000,
+    0b01110001, 0b11111000,
+    0b01100000, 0b11110000,
+    // U+0026 '&'
+    0b00011110, 0b00000000,
+    0b00111111, 0b00000000,
+    0b01110011, 0b10000000,
+    0b01100001, 0b10000000,
+    0b01100011, 0b10000000,
+    0b01100011, 0b00000000,
+    0b00110111, 0b00000000,
+    0b00111110, 0b00000000,
+    0b00111100, 0b01100000,
+    0b01111110, 0b01100000,
+    0b11100111, 0b11000000,
+    0b11000011, 0b11000000,
+    0b11000011, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11100011, 0b11100000,
+    0b01111111, 0b11100000,
+    0b00111110, 0b01110000,
+    // U+0027 '''
+    0b11100000,
+    0b11100000,
+    0b01100000,
+    0b01100000,
+    0b01100000,
+    0b01100000,
+    0b01100000,
+    // U+0028 '('
+    0b00000110,
+    0b00001110,
+    0b00011100,
+    0b00111000,
+    0b00110000,
+    0b01110000,
+    0b01100000,
+    0b01100000,
+    0b11100000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11100000,
+    0b01100000,
+    0b01100000,
+    0b01110000,
+    0b00110000,
+    0b00111000,
+    0b00011100,
+    0b00001110,
+    0b00000110,
+    // U+0029 ')'
+    0b01000000,
+    0b11100000,
+    0b01110000,
+    0b00111000,
+    0b00011100,
+    0b00011100,
+    0b00001100,
+    0b00001110,
+    0b00000110,
+    0b00000110,
+    0b00000110,
+    0b00000110,
+    0b00000110,
+    0b00000110,
+    0b00000110,
+    0b00000110,
+    0b00001110,
+    0b00001100,
+    0b00011100,
+    0b00111000,
+    0b00111000,
+    0b01110000,
+    0b11100000,
+    0b01000000,
+    // U+002A '*'
+    0b00011100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b11101101, 0b11000000,
+    0b11111111, 0b11000000,
+    0b00111110, 0b00000000,
+    0b00011110, 0b00000000,
+    0b00110111, 0b00000000,
+    0b01110011, 0b10000000,
+    0b00100011, 0b00000000,
+    // U+002B '+'
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b11111111, 0b11100000,
+    0b11111111, 0b11100000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    // U+002C ','
+    0b00111000,
+    0b00111100,
+    0b00111100,
+    0b00111100,
+    0b00011000,
+    0b01110000,
+    0b11100000,
+    0b01000000,
+    // U+002D '-'
+    0b11111100,
+    0b11111100,
+    // U+002E '.'
+    0b11100000,
+    0b11110000,
+    0b11110000,
+    0b11100000,
+    // U+002F '/'
+    0b00000001, 0b10000000,
+    0b00000001, 0b10000000,
+    0b00000001, 0b10000000,
+    0b00000011, 0b10000000,
+    0b00000011, 0b00000000,
+    0b00000011, 0b00000000,
+    0b00000111, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00011100, 0b00000000,
+    0b00011100, 0b00000000,
+    0b00011000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b00110000, 0b00000000,
+    0b00110000, 0b00000000,
+    0b01110000, 0b00000000,
+    0b01100000, 0b00000000,
+    0b01100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11000000, 0b00000000,
+    // U+0030 '0'
+    0b00011111, 0b00000000,
+    0b00111111, 0b10000000,
+    0b01110001, 0b11000000,
+    0b01100000, 0b11100000,
+    0b01100000, 0b11100000,
+    0b11100000, 0b01100000,
+    0b11101110, 0b01100000,
+    0b11101110, 0b01100000,
+    0b11101110, 0b01100000,
+    0b11100100, 0b01100000,
+    0b11100000, 0b01100000,
+    0b11100000, 0b01100000,
+    0b01100000, 0b11100000,
+    0b01100000, 0b11100000,
+    0b01110001, 0b11000000,
+    0b00111111, 0b10000000,
+    0b00011111, 0b00000000,
+    // U+0031 '1'
+    0b00001110, 0b00000000,
+    0b00011110, 0b00000000,
+    0b00111110, 0b00000000,
+    0b11111110, 0b00000000,
+    0b11001110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b01111111, 0b11000000,
+    0b01111111, 0b11000000,
+    // U+0032 '2'
+    0b01111110, 0b00000000,
+    0b11111111, 0b00000000,
+    0b11000011, 0b10000000,
+    0b00000001, 0b10000000,
+    0b00000001, 0b10000000,
+    0b00000001, 0b10000000,
+    0b00000011, 0b10000000,
+    0b00000011, 0b00000000,
+    0b00000111, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00011100, 0b00000000,
+    0b00111000, 0b00000000,
+    0b01110000, 0b00000000,
+    0b01100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11111111, 0b11000000,
+    0b11111111, 0b11000000,
+    // U+0033 '3'
+    0b01111110, 0b00000000,
+    0b11111111, 0b00000000,
+    0b01000011, 0b10000000,
+    0b00000001, 0b10000000,
+    0b00000001, 0b10000000,
+    0b00000001, 0b10000000,
+    0b00000111, 0b00000000,
+    0b00111110, 0b00000000,
+    0b00011111, 0b00000000,
+    0b00000011, 0b10000000,
+    0b00000001, 0b11000000,
+    0b00000000, 0b11000000,
+    0b00000000, 0b11000000,
+    0b00000001, 0b11000000,
+    0b10000011, 0b10000000,
+    0b11111111, 0b10000000,
+    0b11111110, 0b00000000,
+    // U+0034 '4'
+    0b00000001, 0b11000000,
+    0b00000011, 0b11000000,
+    0b00000111, 0b11000000,
+    0b00001111, 0b11000000,
+    0b00001101, 0b11000000,
+    0b00011001, 0b11000000,
+    0b00111001, 0b11000000,
+    0b00110001, 0b11000000,
+    0b01100001, 0b11000000,
+    0b01100001, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11111111, 0b11110000,
+    0b11111111, 0b11110000,
+    0b00000001, 0b11000000,
+    0b00000001, 0b11000000,
+    0b00000001, 0b11000000,
+    0b00000001, 0b11000000,
+    // U+0035 '5'
+    0b01111111, 0b11000000,
+    0b01111111, 0b11000000,
+    0b01100000, 0b00000000,
+    0b01100000, 0b00000000,
+    0b01100000, 0b00000000,
+    0b01100000, 0b00000000,
+    0b01111100, 0b00000000,
+    0b01111111, 0b00000000,
+    0b00001111, 0b10000000,
+    0b00000001, 0b11000000,
+    0b00000001, 0b11000000,
+    0b00000000, 0b11000000,
+    0b00000000, 0b11000000,
+    0b00000001, 0b11000000,
+    0b10000011, 0b10000000,
+    0b11111111, 0b10000000,
+    0b11111110, 0b00000000,
+    // U+0036 '6'
+    0b00000011, 0b11000000,
+    0b00001111, 0b11000000,
+    0b00011100, 0b00000000,
+    0b00111000, 0b00000000,
+    0b01110000, 0b00000000,
+    0b01100000, 0b00000000,
+    0b01101111, 0b00000000,
+    0b11111111, 0b11000000,
+    0b11110001, 0b11000000,
+    0b11100000, 0b11100000,
+    0b11100000, 0b01100000,
+    0b11100000, 0b01100000,
+    0b01100000, 0b01100000,
+    0b01100000, 0b11100000,
+    0b01110000, 0b11000000,
+    0b00111111, 0b11000000,
+    0b00011111, 0b10000000,
+    // U+0037 '7'
+    0b11111111, 0b11100000,
+    0b11111111, 0b11000000,
+    0b00000001, 0b11000000,
+    0b00000001, 0b10000000,
+    0b00000011, 0b10000000,
+    0b00000011, 0b00000000,
+    0b00000111, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00011100, 0b00000000,
+    0b00011100, 0b00000000,
+    0b00011000, 0b00000000,
+    0b00011000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b00111000, 0b00000000,
+    // U+0038 '8'
+    0b00011111, 0b10000000,
+    0b00111111, 0b11000000,
+    0b01110000, 0b11000000,
+    0b01100000, 0b11100000,
+    0b01100000, 0b11100000,
+    0b01100000, 0b11100000,
+    0b01110000, 0b11000000,
+    0b00111001, 0b10000000,
+    0b00011111, 0b10000000,
+    0b00110011, 0b11000000,
+    0b01100000, 0b11100000,
+    0b11100000, 0b01100000,
+    0b11100000, 0b01100000,
+    0b11100000, 0b01100000,
+    0b01100000, 0b11100000,
+    0b01111111, 0b11000000,
+    0b00111111, 0b10000000,
+    // U+0039 '9'
+    0b00011111, 0b00000000,
+    0b00111111, 0b10000000,
+    0b01110001, 0b11000000,
+    0b11100000, 0b11100000,
+    0b11100000, 0b11100000,
+    0b11100000, 0b01100000,
+    0b11100000, 0b01100000,
+    0b01110000, 0b01100000,
+    0b01111111, 0b11100000,
+    0b00111111, 0b11100000,
+    0b00000000, 0b11100000,
+    0b00000000, 0b11100000,
+    0b00000001, 0b11000000,
+    0b00000001, 0b11000000,
+    0b00000111, 0b10000000,
+    0b01111111, 0b00000000,
+    0b01111100, 0b00000000,
+    // U+003A ':'
+    0b11100000,
+    0b11110000,
+    0b11110000,
+    0b11100000,
+    0b00000000,
+    0b00000000,
+    0b00000000,
+    0b00000000,
+    0b00000000,
+    0b11100000,
+    0b11110000,
+    0b11110000,
+    0b11100000,
+    // U+003B ';'
+    0b00111000,
+    0b00111100,
+    0b00111100,
+    0b00111000,
+    0b00000000,
+    0b00000000,
+    0b00000000,
+    0b00000000,
+    0b00000000,
+    0b00111000,
+    0b00111100,
+    0b00111100,
+    0b00111100,
+    0b00011000,
+    0b01111000,
+    0b11110000,
+    0b01000000,
+    // U+003C '<'
+    0b00000000, 0b11100000,
+    0b00000011, 0b11100000,
+    0b00001111, 0b10000000,
+    0b01111110, 0b00000000,
+    0b11110000, 0b00000000,
+    0b11110000, 0b00000000,
+    0b01111110, 0b00000000,
+    0b00001111, 0b10000000,
+    0b00000011, 0b11100000,
+    0b00000000, 0b11100000,
+    // U+003D '='
+    0b11111111, 0b11100000,
+    0b11111111, 0b11100000,
+    0b00000000, 0b00000000,
+    0b00000000, 0b00000000,
+    0b00000000, 0b00000000,
+    0b11111111, 0b11100000,
+    0b11111111, 0b11100000,
+    // U+003E '>'
+    0b11100000, 0b00000000,
+    0b01111100, 0b00000000,
+    0b00011111, 0b00000000,
+    0b00000111, 0b11000000,
+    0b00000001, 0b11110000,
+    0b00000001, 0b11110000,
+    0b00000111, 0b11000000,
+    0b00011111, 0b00000000,
+    0b01111100, 0b00000000,
+    0b11100000, 0b00000000,
+    // U+003F '?'
+    0b11111100,
+    0b11111110,
+    0b00000111,
+    0b00000011,
+    0b00000011,
+    0b00000111,
+    0b00001110,
+    0b00011100,
+    0b00011000,
+    0b00110000,
+    0b00110000,
+    0b00000000,
+    0b00000000,
+    0b00110000,
+    0b01111000,
+    0b01111000,
+    0b00111000,
+    // U+0040 '@'
+    0b00001111, 0b10000000,
+    0b00011111, 0b11000000,
+    0b00111000, 0b11100000,
+    0b01110000, 0b01100000,
+    0b01100000, 0b01110000,
+    0b01100001, 0b11110000,
+    0b11100111, 0b11110000,
+    0b11100111, 0b01110000,
+    0b11101110, 0b01110000,
+    0b11101100, 0b01110000,
+    0b11101100, 0b01110000,
+    0b11101100, 0b01110000,
+    0b11101110, 0b01110000,
+    0b11101110, 0b01110000,
+    0b01100111, 0b11110000,
+    0b01110011, 0b11110000,
+    0b01110000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b00111100, 0b00000000,
+    0b00011111, 0b11000000,
+    0b00000111, 0b11000000,
+    // U+0041 'A'
+    0b00000111, 0b00000000,
+    0b00000111, 0b10000000,
+    0b00001111, 0b10000000,
+    0b00001101, 0b11000000,
+    0b00001101, 0b11000000,
+    0b00011100, 0b11000000,
+    0b00011000, 0b11000000,
+    0b00011000, 0b11100000,
+    0b00111000, 0b01100000,
+    0b00110000, 0b01100000,
+    0b00110000, 0b01110000,
+    0b01111111, 0b11110000,
+    0b01111111, 0b11110000,
+    0b01100000, 0b00110000,
+    0b01100000, 0b00111000,
+    0b11100000, 0b00011000,
+    0b11100000, 0b00011000,
+    // U+0042 'B'
+    0b11111111, 0b00000000,
+    0b11111111, 0b10000000,
+    0b11100001, 0b11000000,
+    0b11100000, 0b11000000,
+    0b11100000, 0b11000000,
+    0b11100000, 0b11000000,
+    0b11100001, 0b11000000,
+    0b11111111, 0b10000000,
+    0b11111111, 0b10000000,
+    0b11100001, 0b11000000,
+    0b11100000, 0b11100000,
+    0b11100000, 0b01100000,
+    0b11100000, 0b01100000,
+    0b11100000, 0b01100000,
+    0b11100000, 0b11100000,
+    0b11111111, 0b11000000,
+    0b11111111, 0b10000000,
+    // U+0043 'C'
+    0b00001111, 0b11000000,
+    0b00011111, 0b11100000,
+    0b00111000, 0b00100000,
+    0b01110000, 0b00000000,
+    0b01100000, 0b00000000,
+    0b01100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b01100000, 0b00000000,
+    0b01110000, 0b00000000,
+    0b00111000, 0b00100000,
+    0b00011111, 0b11100000,
+    0b00001111, 0b11100000,
+    // U+0044 'D'
+    0b11111110, 0b00000000,
+    0b11111111, 0b10000000,
+    0b11100011, 0b11000000,
+    0b11100000, 0b11000000,
+    0b11100000, 0b11100000,
+    0b11100000, 0b01100000,
+    0b11100000, 0b01100000,
+    0b11100000, 0b01100000,
+    0b11100000, 0b01110000,
+    0b11100000, 0b01100000,
+    0b11100000, 0b01100000,
+    0b11100000, 0b01100000,
+    0b11100000, 0b11100000,
+    0b11100000, 0b11000000,
+    0b11100001, 0b11000000,
+    0b11111111, 0b10000000,
+    0b11111110, 0b00000000,
+    // U+0045 'E'
+    0b11111111, 0b11000000,
+    0b11111111, 0b11000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11111111, 0b10000000,
+    0b11111111, 0b10000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11111111, 0b11000000,
+    0b11111111, 0b11100000,
+    // U+0046 'F'
+    0b11111111, 0b11000000,
+    0b11111111, 0b11000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11111111, 0b10000000,
+    0b11111111, 0b10000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    // U+0047 'G'
+    0b00001111, 0b11000000,
+    0b00011111, 0b11100000,
+    0b00111000, 0b01100000,
+    0b01110000, 0b00000000,
+    0b01100000, 0b00000000,
+    0b01100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b01100000,
+    0b11100000, 0b01100000,
+    0b01100000, 0b01100000,
+    0b01100000, 0b01100000,
+    0b01110000, 0b01100000,
+    0b00111000, 0b01100000,
+    0b00011111, 0b11100000,
+    0b00001111, 0b11100000,
+    // U+0048 'H'
+    0b11000000, 0b01100000,
+    0b11000000, 0b01100000,
+    0b11000000, 0b01100000,
+    0b11000000, 0b01100000,
+    0b11000000, 0b01100000,
+    0b11000000, 0b01100000,
+    0b11000000, 0b01100000,
+    0b11111111, 0b11100000,
+    0b11111111, 0b11100000,
+    0b11000000, 0b01100000,
+    0b11000000, 0b01100000,
+    0b11000000, 0b01100000,
+    0b11000000, 0b01100000,
+    0b11000000, 0b01100000,
+    0b11000000, 0b01100000,
+    0b11000000, 0b01100000,
+    0b11000000, 0b01100000,
+    // U+0049 'I'
+    0b11111111, 0b10000000,
+    0b01111111, 0b10000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b01111111, 0b10000000,
+    0b11111111, 0b10000000,
+    // U+004A 'J'
+    0b00111111, 0b11000000,
+    0b00111111, 0b11000000,
+    0b00000000, 0b11000000,
+    0b00000000, 0b11000000,
+    0b00000000, 0b11000000,
+    0b00000000, 0b11000000,
+    0b00000000, 0b11000000,
+    0b00000000, 0b11000000,
+    0b00000000, 0b11000000,
+    0b00000000, 0b11000000,
+    0b00000000, 0b11000000,
+    0b00000000, 0b11000000,
+    0b00000000, 0b11000000,
+    0b00000000, 0b11000000,
+    0b01000001, 0b11000000,
+    0b11111111, 0b10000000,
+    0b00111111, 0b00000000,
+    // U+004B 'K'
+    0b11000000, 0b11100000,
+    0b11000001, 0b11000000,
+    0b11000011, 0b10000000,
+    0b11000111, 0b00000000,
+    0b11001110, 0b00000000,
+    0b11001110, 0b00000000,
+    0b11011100, 0b00000000,
+    0b11111000, 0b00000000,
+    0b11111000, 0b00000000,
+    0b11111100, 0b00000000,
+    0b11001110, 0b00000000,
+    0b11000111, 0b00000000,
+    0b11000011, 0b10000000,
+    0b11000011, 0b10000000,
+    0b11000001, 0b11000000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b01100000,
+    // U+004C 'L'
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11111111, 0b11000000,
+    0b11111111, 0b11100000,
+    // U+004D 'M'
+    0b01100000, 0b11100000,
+    0b01110000, 0b11100000,
+    0b01110001, 0b11100000,
+    0b01110001, 0b11100000,
+    0b11111001, 0b11100000,
+    0b11011011, 0b01100000,
+    0b11011011, 0b01100000,
+    0b11001111, 0b01100000,
+    0b11001111, 0b01100000,
+    0b11001110, 0b01100000,
+    0b11000110, 0b01100000,
+    0b11000000, 0b01100000,
+    0b11000000, 0b01110000,
+    0b11000000, 0b01110000,
+    0b11000000, 0b01110000,
+    0b11000000, 0b01110000,
+    0b11000000, 0b01110000,
+    // U+004E 'N'
+    0b11100000, 0b01100000,
+    0b11110000, 0b01100000,
+    0b11110000, 0b01100000,
+    0b11111000, 0b01100000,
+    0b11111000, 0b01100000,
+    0b11111100, 0b01100000,
+    0b11101100, 0b01100000,
+    0b11101110, 0b01100000,
+    0b11100110, 0b01100000,
+    0b11100111, 0b01100000,
+    0b11100011, 0b01100000,
+    0b11100011, 0b01100000,
+    0b11100001, 0b11100000,
+    0b11100001, 0b11100000,
+    0b11100001, 0b11100000,
+    0b11100000, 0b11100000,
+    0b11100000, 0b11100000,
+    // U+004F 'O'
+    0b00011111, 0b00000000,
+    0b00111111, 0b11000000,
+    0b01110000, 0b11100000,
+    0b11100000, 0b11100000,
+    0b11100000, 0b01100000,
+    0b11000000, 0b01110000,
+    0b11000000, 0b01110000,
+    0b11000000, 0b01110000,
+    0b11000000, 0b00110000,
+    0b11000000, 0b01110000,
+    0b11000000, 0b01110000,
+    0b11000000, 0b01110000,
+    0b11100000, 0b01100000,
+    0b11100000, 0b11100000,
+    0b01110000, 0b11100000,
+    0b00111111, 0b11000000,
+    0b00011111, 0b00000000,
+    // U+0050 'P'
+    0b11111111, 0b00000000,
+    0b11111111, 0b10000000,
+    0b11000001, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11000011, 0b10000000,
+    0b11111111, 0b00000000,
+    0b11111110, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    // U+0051 'Q'
+    0b00011111, 0b00000000,
+    0b00111111, 0b11000000,
+    0b01110001, 0b11000000,
+    0b11100000, 0b11100000,
+    0b11100000, 0b01100000,
+    0b11000000, 0b01110000,
+    0b11000000, 0b01110000,
+    0b11000000, 0b01110000,
+    0b11000000, 0b00110000,
+    0b11000000, 0b01110000,
+    0b11000000, 0b01110000,
+    0b11000000, 0b01110000,
+    0b11000000, 0b01110000,
+    0b11100000, 0b01100000,
+    0b01100000, 0b11100000,
+    0b01110001, 0b11000000,
+    0b00111111, 0b11000000,
+    0b00011111, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000111, 0b10000000,
+    0b00000011, 0b11100000,
+    0b00000000, 0b11100000,
+    // U+0052 'R'
+    0b11111111, 0b00000000,
+    0b11111111, 0b10000000,
+    0b11100001, 0b11000000,
+    0b11100000, 0b11000000,
+    0b11100000, 0b11100000,
+    0b11100000, 0b11100000,
+    0b11100000, 0b11000000,
+    0b11100001, 0b11000000,
+    0b11111111, 0b10000000,
+    0b11111111, 0b00000000,
+    0b11100011, 0b00000000,
+    0b11100011, 0b10000000,
+    0b11100001, 0b10000000,
+    0b11100001, 0b11000000,
+    0b11100000, 0b11000000,
+    0b11100000, 0b11100000,
+    0b11100000, 0b01100000,
+    // U+0053 'S'
+    0b00111111, 0b10000000,
+    0b01111111, 0b10000000,
+    0b11100000, 0b10000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11110000, 0b00000000,
+    0b01111100, 0b00000000,
+    0b00011111, 0b00000000,
+    0b00000111, 0b10000000,
+    0b00000001, 0b11000000,
+    0b00000001, 0b11000000,
+    0b00000000, 0b11000000,
+    0b00000000, 0b11000000,
+    0b10000001, 0b11000000,
+    0b11111111, 0b10000000,
+    0b01111111, 0b00000000,
+    // U+0054 'T'
+    0b11111111, 0b11110000,
+    0b11111111, 0b11100000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    // U+0055 'U'
+    0b11000000, 0b01100000,
+    0b11000000, 0b01100000,
+    0b11000000, 0b01100000,
+    0b11000000, 0b01100000,
+    0b11000000, 0b01100000,
+    0b11000000, 0b01100000,
+    0b11000000, 0b01100000,
+    0b11000000, 0b01100000,
+    0b11000000, 0b01100000,
+    0b11000000, 0b01100000,
+    0b11000000, 0b01100000,
+    0b11100000, 0b01100000,
+    0b11100000, 0b01100000,
+    0b11100000, 0b11100000,
+    0b01110000, 0b11100000,
+    0b00111111, 0b11000000,
+    0b00011111, 0b10000000,
+    // U+0056 'V'
+    0b11100000, 0b00011000,
+    0b11100000, 0b00011000,
+    0b01100000, 0b00111000,
+    0b01100000, 0b00110000,
+    0b01110000, 0b00110000,
+    0b00110000, 0b00110000,
+    0b00110000, 0b01110000,
+    0b00111000, 0b01100000,
+    0b00111000, 0b01100000,
+    0b00011000, 0b11100000,
+    0b00011000, 0b11000000,
+    0b00011100, 0b11000000,
+    0b00001101, 0b11000000,
+    0b00001101, 0b10000000,
+    0b00001111, 0b10000000,
+    0b00000111, 0b10000000,
+    0b00000111, 0b00000000,
+    // U+0057 'W'
+    0b11000000, 0b01110000,
+    0b11000000, 0b01110000,
+    0b11000000, 0b01110000,
+    0b11000000, 0b01110000,
+    0b11000000, 0b01110000,
+    0b11000000, 0b01100000,
+    0b11000110, 0b01100000,
+    0b11001110, 0b01100000,
+    0b11001110, 0b01100000,
+    0b11001111, 0b01100000,
+    0b11011011, 0b01100000,
+    0b11011011, 0b01100000,
+    0b11111001, 0b11100000,
+    0b01110001, 0b11100000,
+    0b01110001, 0b11100000,
+    0b01110000, 0b11100000,
+    0b01100000, 0b11000000,
+    // U+0058 'X'
+    0b11100000, 0b01100000,
+    0b01100000, 0b11100000,
+    0b01110000, 0b11000000,
+    0b00110001, 0b11000000,
+    0b00111001, 0b10000000,
+    0b00011011, 0b10000000,
+    0b00011111, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001111, 0b00000000,
+    0b00011111, 0b00000000,
+    0b00011011, 0b10000000,
+    0b00111001, 0b10000000,
+    0b00110001, 0b11000000,
+    0b01110000, 0b11000000,
+    0b01100000, 0b11100000,
+    0b11100000, 0b01100000,
+    0b11000000, 0b01110000,
+    // U+0059 'Y'
+    0b11100000, 0b00011000,
+    0b01100000, 0b00111000,
+    0b01110000, 0b00110000,
+    0b00110000, 0b01110000,
+    0b00111000, 0b01100000,
+    0b00011000, 0b11100000,
+    0b00011100, 0b11000000,
+    0b00001101, 0b11000000,
+    0b00001111, 0b10000000,
+    0b00000111, 0b10000000,
+    0b00000111, 0b00000000,
+    0b00000011, 0b00000000,
+    0b00000011, 0b00000000,
+    0b00000011, 0b00000000,
+    0b00000011, 0b00000000,
+    0b00000011, 0b00000000,
+    0b00000011, 0b00000000,
+    // U+005A 'Z'
+    0b01111111, 0b11100000,
+    0b01111111, 0b11100000,
+    0b00000000, 0b11100000,
+    0b00000001, 0b11000000,
+    0b00000001, 0b10000000,
+    0b00000011, 0b10000000,
+    0b00000111, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00011100, 0b00000000,
+    0b00111000, 0b00000000,
+    0b00110000, 0b00000000,
+    0b01110000, 0b00000000,
+    0b01100000, 0b00000000,
+    0b11111111, 0b11100000,
+    0b11111111, 0b11110000,
+    // U+005B '['
+    0b11111100,
+    0b11111100,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11111100,
+    0b11111100,
+    // U+005C
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b01100000, 0b00000000,
+    0b01100000, 0b00000000,
+    0b01110000, 0b00000000,
+    0b00110000, 0b00000000,
+    0b00110000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b00011000, 0b00000000,
+    0b00011000, 0b00000000,
+    0b00011100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000111, 0b00000000,
+    0b00000111, 0b00000000,
+    0b00000011, 0b00000000,
+    0b00000011, 0b10000000,
+    0b00000011, 0b10000000,
+    0b00000001, 0b10000000,
+    0b00000001, 0b10000000,
+    // U+005D ']'
+    0b11111100,
+    0b11111110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b11111110,
+    0b11111110,
+    // U+005E '^'
+    0b00001110, 0b00000000,
+    0b00001111, 0b00000000,
+    0b00011111, 0b00000000,
+    0b00011011, 0b10000000,
+    0b00110001, 0b10000000,
+    0b00110001, 0b11000000,
+    0b01100000, 0b11000000,
+    0b11100000, 0b01100000,
+    0b11000000, 0b01100000,
+    // U+005F '_'
+    0b11111111, 0b11111000,
+    0b11111111, 0b11111000,
+    // U+0060 '`'
+    0b10000000,
+    0b11000000,
+    0b11100000,
+    0b01100000,
+    0b00100000,
+    // U+0061 'a'
+    0b00111111, 0b10000000,
+    0b00111111, 0b11000000,
+    0b00000000, 0b11000000,
+    0b00000000, 0b11100000,
+    0b00000000, 0b11100000,
+    0b00011111, 0b11100000,
+    0b01111111, 0b11100000,
+    0b01110000, 0b11100000,
+    0b01100000, 0b11100000,
+    0b11100000, 0b11100000,
+    0b01110000, 0b11100000,
+    0b01111111, 0b11100000,
+    0b00011111, 0b11100000,
+    // U+0062 'b'
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11111111, 0b00000000,
+    0b11111111, 0b10000000,
+    0b11100001, 0b10000000,
+    0b11000001, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11000011, 0b10000000,
+    0b11111111, 0b10000000,
+    0b11111110, 0b00000000,
+    // U+0063 'c'
+    0b00001111, 0b11100000,
+    0b00111111, 0b11100000,
+    0b01111000, 0b00000000,
+    0b01100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b01100000, 0b00000000,
+    0b01111000, 0b00000000,
+    0b00111111, 0b11100000,
+    0b00001111, 0b11100000,
+    // U+0064 'd'
+    0b00000000, 0b11100000,
+    0b00000000, 0b11100000,
+    0b00000000, 0b11100000,
+    0b00000000, 0b11100000,
+    0b00000000, 0b11100000,
+    0b00000000, 0b11100000,
+    0b00011111, 0b11100000,
+    0b00111111, 0b11100000,
+    0b01110000, 0b11100000,
+    0b11100000, 0b11100000,
+    0b11100000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11100000, 0b11100000,
+    0b01100000, 0b11100000,
+    0b01110000, 0b11100000,
+    0b00111111, 0b11100000,
+    0b00011111, 0b11000000,
+    // U+0065 'e'
+    0b00011111, 0b10000000,
+    0b00111111, 0b11000000,
+    0b01110000, 0b11100000,
+    0b11100000, 0b01100000,
+    0b11000000, 0b01100000,
+    0b11111111, 0b11100000,
+    0b11111111, 0b11100000,
+    0b11000000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b01100000, 0b00000000,
+    0b01110000, 0b00000000,
+    0b00111111, 0b11000000,
+    0b00011111, 0b11000000,
+    // U+0066 'f'
+    0b00001111, 0b11100000,
+    0b00011111, 0b11100000,
+    0b00011000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b11111111, 0b11000000,
+    0b11111111, 0b10000000,
+    0b00111000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b00111000, 0b00000000,
+    // U+0067 'g'
+    0b00011111, 0b11000000,
+    0b00111111, 0b11100000,
+    0b01110000, 0b11100000,
+    0b11100000, 0b11100000,
+    0b11100000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11100000, 0b11100000,
+    0b11100000, 0b11100000,
+    0b01110000, 0b11100000,
+    0b00111111, 0b11100000,
+    0b00011111, 0b11100000,
+    0b00000000, 0b11100000,
+    0b00000000, 0b11000000,
+    0b00000001, 0b11000000,
+    0b01111111, 0b10000000,
+    0b01111111, 0b00000000,
+    // U+0068 'h'
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11111111, 0b00000000,
+    0b11111111, 0b10000000,
+    0b11000011, 0b10000000,
+    0b11000001, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11000001, 0b11000000,
+    // U+0069 'i'
+    0b00011100, 0b00000000,
+    0b00011100, 0b00000000,
+    0b00011100, 0b00000000,
+    0b00001000, 0b00000000,
+    0b00000000, 0b00000000,
+    0b00000000, 0b00000000,
+    0b11111100, 0b00000000,
+    0b11111100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00000111, 0b11100000,
+    0b00000011, 0b11100000,
+    // U+006A 'j'
+    0b00000111,
+    0b00001111,
+    0b00000111,
+    0b00000010,
+    0b00000000,
+    0b00000000,
+    0b01111111,
+    0b01111111,
+    0b00000011,
+    0b00000011,
+    0b00000011,
+    0b00000011,
+    0b00000011,
+    0b00000011,
+    0b00000011,
+    0b00000011,
+    0b00000011,
+    0b00000011,
+    0b00000011,
+    0b00000011,
+    0b00000011,
+    0b00000111,
+    0b11111110,
+    0b11111100,
+    // U+006B 'k'
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000001, 0b11000000,
+    0b11000011, 0b10000000,
+    0b11000111, 0b00000000,
+    0b11001110, 0b00000000,
+    0b11011100, 0b00000000,
+    0b11111000, 0b00000000,
+    0b11111000, 0b00000000,
+    0b11011100, 0b00000000,
+    0b11001110, 0b00000000,
+    0b11000111, 0b00000000,
+    0b11000011, 0b10000000,
+    0b11000001, 0b11000000,
+    0b11000000, 0b11100000,
+    // U+006C 'l'
+    0b11111100, 0b00000000,
+    0b11111100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00000111, 0b11100000,
+    0b00000011, 0b11100000,
+    // U+006D 'm'
+    0b11111011, 0b11000000,
+    0b11111111, 0b11100000,
+    0b11001110, 0b01110000,
+    0b11000110, 0b01110000,
+    0b11000110, 0b01110000,
+    0b11000110, 0b01110000,
+    0b11000110, 0b01110000,
+    0b11000110, 0b01110000,
+    0b11000000, 0b01110000,
+    0b11000000, 0b01110000,
+    0b11000000, 0b01110000,
+    0b11000000, 0b01110000,
+    0b11000000, 0b01110000,
+    // U+006E 'n'
+    0b11111110, 0b00000000,
+    0b11111111, 0b10000000,
+    0b11000011, 0b10000000,
+    0b11000001, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11000001, 0b11000000,
+    // U+006F 'o'
+    0b00011111, 0b00000000,
+    0b00111111, 0b11000000,
+    0b01110001, 0b11000000,
+    0b11100000, 0b11100000,
+    0b11100000, 0b01100000,
+    0b11000000, 0b01100000,
+    0b11000000, 0b01100000,
+    0b11000000, 0b01100000,
+    0b11100000, 0b01100000,
+    0b11100000, 0b11100000,
+    0b01110001, 0b11000000,
+    0b00111111, 0b11000000,
+    0b00011111, 0b00000000,
+    // U+0070 'p'
+    0b11111110, 0b00000000,
+    0b11111111, 0b10000000,
+    0b11000011, 0b10000000,
+    0b11000001, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11100011, 0b10000000,
+    0b11111111, 0b10000000,
+    0b11111111, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    // U+0071 'q'
+    0b00011111, 0b11000000,
+    0b00111111, 0b11100000,
+    0b01110000, 0b11100000,
+    0b11100000, 0b11100000,
+    0b11100000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11100000, 0b11100000,
+    0b11100000, 0b11100000,
+    0b01110000, 0b11100000,
+    0b00111111, 0b11100000,
+    0b00011111, 0b11100000,
+    0b00000000, 0b11100000,
+    0b00000000, 0b11100000,
+    0b00000000, 0b11100000,
+    0b00000000, 0b11100000,
+    0b00000000, 0b11100000,
+    // U+0072 'r'
+    0b01111111, 0b10000000,
+    0b11111111, 0b10000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    // U+0073 's'
+    0b00111111, 0b10000000,
+    0b01111111, 0b10000000,
+    0b11100000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b01111100, 0b00000000,
+    0b00111111, 0b00000000,
+    0b00000111, 0b10000000,
+    0b00000001, 0b11000000,
+    0b00000001, 0b11000000,
+    0b10000001, 0b11000000,
+    0b11111111, 0b10000000,
+    0b11111111, 0b00000000,
+    // U+0074 't'
+    0b00111000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b11111111, 0b11000000,
+    0b11111111, 0b11000000,
+    0b00111000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b00011000, 0b00000000,
+    0b00011111, 0b11000000,
+    0b00001111, 0b11000000,
+    // U+0075 'u'
+    0b11000001, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11100001, 0b11000000,
+    0b01111111, 0b11000000,
+    0b00111111, 0b10000000,
+    // U+0076 'v'
+    0b11000000, 0b01110000,
+    0b11100000, 0b01100000,
+    0b11100000, 0b01100000,
+    0b01100000, 0b11100000,
+    0b01110000, 0b11000000,
+    0b01110000, 0b11000000,
+    0b00110001, 0b11000000,
+    0b00111001, 0b10000000,
+    0b00011011, 0b10000000,
+    0b00011011, 0b00000000,
+    0b00011111, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001110, 0b00000000,
+    // U+0077 'w'
+    0b11100000, 0b00011000,
+    0b11100000, 0b00011000,
+    0b01100000, 0b00011000,
+    0b01100011, 0b00111000,
+    0b01100111, 0b00111000,
+    0b01100111, 0b00110000,
+    0b01100111, 0b10110000,
+    0b01111101, 0b10110000,
+    0b00111101, 0b10110000,
+    0b00111100, 0b11110000,
+    0b00111000, 0b11110000,
+    0b00111000, 0b01100000,
+    0b00110000, 0b01100000,
+    // U+0078 'x'
+    0b11100000, 0b11100000,
+    0b01110000, 0b11000000,
+    0b00110001, 0b11000000,
+    0b00111011, 0b10000000,
+    0b00011111, 0b00000000,
+    0b00001111, 0b00000000,
+    0b00001111, 0b00000000,
+    0b00011111, 0b00000000,
+    0b00011011, 0b10000000,
+    0b00110001, 0b11000000,
+    0b01110000, 0b11000000,
+    0b01100000, 0b11100000,
+    0b11000000, 0b01110000,
+    // U+0079 'y'
+    0b11100000, 0b01100000,
+    0b01100000, 0b01100000,
+    0b01100000, 0b11100000,
+    0b01110000, 0b11100000,
+    0b01110000, 0b11000000,
+    0b00110000, 0b11000000,
+    0b00111001, 0b11000000,
+    0b00011001, 0b11000000,
+    0b00011001, 0b10000000,
+    0b00011101, 0b10000000,
+    0b00001111, 0b10000000,
+    0b00001111, 0b00000000,
+    0b00000111, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00001100, 0b00000000,
+    0b11111100, 0b00000000,
+    0b11111000, 0b00000000,
+    // U+007A 'z'
+    0b11111111, 0b10000000,
+    0b11111111, 0b10000000,
+    0b00000011, 0b10000000,
+    0b00000111, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00011100, 0b00000000,
+    0b00111000, 0b00000000,
+    0b00110000, 0b00000000,
+    0b01110000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11111111, 0b11000000,
+    0b11111111, 0b11000000,
+    // U+007B '{'
+    0b00000011, 0b10000000,
+    0b00001111, 0b11000000,
+    0b00011100, 0b00000000,
+    0b00011000, 0b00000000,
+    0b00011000, 0b00000000,
+    0b00011000, 0b00000000,
+    0b00011000, 0b00000000,
+    0b00011000, 0b00000000,
+    0b00011000, 0b00000000,
+    0b00011000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b11110000, 0b00000000,
+    0b11110000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b00011000, 0b00000000,
+    0b00011000, 0b00000000,
+    0b00011000, 0b00000000,
+    0b00011000, 0b00000000,
+    0b00011000, 0b00000000,
+    0b00011000, 0b00000000,
+    0b00011000, 0b00000000,
+    0b00011000, 0b00000000,
+    0b00001111, 0b10000000,
+    0b00001111, 0b11000000,
+    // U+007C '|'
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    // U+007D '}'
+    0b11110000, 0b00000000,
+    0b11111100, 0b00000000,
+    0b00011100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000111, 0b10000000,
+    0b00000111, 0b10000000,
+    0b00000110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001100, 0b00000000,
+    0b11111100, 0b00000000,
+    0b11111000, 0b00000000,
+    // U+007E '~'
+    0b00111000, 0b00000000,
+    0b01111110, 0b01100000,
+    0b11001111, 0b11100000,
+    0b11000011, 0b11000000,
+    // fallback
+    0b11111111, 0b11110000,
+    0b10000000, 0b00010000,
+    0b10000000, 0b00010000,
+    0b10000000, 0b00010000,
+    0b10000000, 0b00010000,
+    0b10000000, 0b00010000,
+    0b10000000, 0b00010000,
+    0b10000000, 0b00010000,
+    0b10000000, 0b00010000,
+    0b10000000, 0b00010000,
+    0b10000000, 0b00010000,
+    0b10000000, 0b00010000,
+    0b10000000, 0b00010000,
+    0b10000000, 0b00010000,
+    0b11111111, 0b11110000,
 };
 
-static const uint8_t __font_jetbrains_mono_16x24[] = {
-    0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00011000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000111, 0b11100000, 0b00110000, 0b00000000, 0b00011111, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b01110000, 0b00000011, 0b00000000, 0b00111100, 0b00000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b11110000, 0b00011100, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000111, 0b11100000, 0b00111000, 0b00000000, 0b00011111, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00001100, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b11100000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000001, 0b11110000, 0b00000011, 0b00000000, 0b00111110, 0b00000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00001111, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000001, 0b11100000, 0b00001110, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b01110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000110, 0b00000000, 0b00111000, 0b00000000, 0b00000001, 0b11000000, 0b00000011, 0b10000000, 0b00000000, 0b00000000, 0b00000110, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000011, 0b10000000, 0b00000001, 0b11100000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000001, 0b11000000, 0b00000011, 0b00000000, 0b00000111, 0b00000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000011, 0b10000000, 0b00011100, 0b11100000, 0b00000110, 0b00111000, 0b00011111, 0b11100000, 0b01111100, 0b00001100, 0b00001111, 0b10000000, 0b00000011, 0b10000000, 0b00000011, 0b10000000, 0b00000111, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b01110000, 0b00001111, 0b11000000, 0b00000111, 0b10000000, 0b00001111, 0b11000000, 0b00111111, 0b11110000, 0b00000000, 0b11000000, 0b00111111, 0b11110000, 0b00000001, 0b10000000, 0b00111111, 0b11111000, 0b00001111, 0b11000000, 0b00001111, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00011111, 0b10000000, 0b00001111, 0b11100000, 0b00000011, 0b10000000, 0b00111111, 0b11000000, 0b00001111, 0b11000000, 0b00111111, 0b11000000, 0b00111111, 0b11111000, 0b00111111, 0b11111000, 0b00001111, 0b11000000, 0b00110000, 0b00110000, 0b00111111, 0b11110000, 0b00000000, 0b00110000, 0b00110000, 0b00111000, 0b00011000, 0b00000000, 0b00111000, 0b01111000, 0b00111000, 0b00110000, 0b00001111, 0b11000000, 0b00111111, 0b11100000, 0b00001111, 0b11000000, 0b00111111, 0b11000000, 0b00001111, 0b11000000, 0b01111111, 0b11111000, 0b00110000, 0b00110000, 0b01110000, 0b00011000, 0b11100011, 0b10001100, 0b01110000, 0b00111000, 0b01100000, 0b00011000, 0b00111111, 0b11110000, 0b00000110, 0b00000000, 0b00011000, 0b00000000, 0b00000001, 0b11000000, 0b00000111, 0b10000000, 0b00000000, 0b00000000, 0b00000111, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b00000011, 0b11111000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000011, 0b10000000, 0b00000000, 0b11100000, 0b00111000, 0b00000000, 0b01111110, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000110, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000011, 0b10000000, 0b00000011, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000011, 0b10000000, 0b00011100, 0b11100000, 0b00000110, 0b00110000, 0b00011011, 0b01110000, 0b01111110, 0b00011000, 0b00011111, 0b11000000, 0b00000011, 0b10000000, 0b00000011, 0b00000000, 0b00000011, 0b10000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b01100000, 0b00011111, 0b11100000, 0b00001111, 0b10000000, 0b00011111, 0b11100000, 0b00111111, 0b11110000, 0b00000001, 0b11000000, 0b00111111, 0b11110000, 0b00000011, 0b10000000, 0b00111111, 0b11111000, 0b00011111, 0b11100000, 0b00011111, 0b11100000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00011111, 0b11100000, 0b00011111, 0b11110000, 0b00000111, 0b10000000, 0b00111111, 0b11100000, 0b00011111, 0b11100000, 0b00111111, 0b11100000, 0b00111111, 0b11111000, 0b00111111, 0b11111000, 0b00011111, 0b11100000, 0b00110000, 0b00110000, 0b00111111, 0b11110000, 0b00000000, 0b00110000, 0b00110000, 0b00111000, 0b00011000, 0b00000000, 0b00111000, 0b01111000, 0b00111100, 0b00110000, 0b00011111, 0b11100000, 0b00111111, 0b11110000, 0b00011111, 0b11100000, 0b00111111, 0b11110000, 0b00011111, 0b11100000, 0b01111111, 0b11111000, 0b00110000, 0b00110000, 0b01110000, 0b00011000, 0b01100011, 0b10001100, 0b00111000, 0b00110000, 0b01110000, 0b00011000, 0b00111111, 0b11110000, 0b00000110, 0b00000000, 0b00011100, 0b00000000, 0b00000001, 0b11000000, 0b00000111, 0b10000000, 0b00000000, 0b00000000, 0b00000011, 0b10000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b00000011, 0b11111000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000011, 0b10000000, 0b00000000, 0b00000000, 0b00111000, 0b00000000, 0b01111110, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000110, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000011, 0b10000000, 0b00000011, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000011, 0b10000000, 0b00011100, 0b11100000, 0b00000110, 0b00110000, 0b00111011, 0b00110000, 0b11000110, 0b00111000, 0b00011000, 0b11100000, 0b00000011, 0b00000000, 0b00000111, 0b00000000, 0b00000001, 0b10000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b11100000, 0b00111000, 0b01110000, 0b00011101, 0b10000000, 0b00111000, 0b01110000, 0b00000000, 0b01100000, 0b00000001, 0b10000000, 0b00111000, 0b00000000, 0b00000011, 0b00000000, 0b00110000, 0b00111000, 0b00111000, 0b01110000, 0b00111000, 0b01110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b11100000, 0b00111000, 0b00111000, 0b00000111, 0b10000000, 0b00110000, 0b01110000, 0b00011100, 0b01110000, 0b00110000, 0b01110000, 0b00111000, 0b00000000, 0b00111000, 0b00000000, 0b00011100, 0b01110000, 0b00110000, 0b00110000, 0b00000011, 0b00000000, 0b00000000, 0b00110000, 0b00110000, 0b00110000, 0b00011000, 0b00000000, 0b00111100, 0b01111000, 0b00111100, 0b00110000, 0b00011000, 0b01110000, 0b00110000, 0b00111000, 0b00111000, 0b01110000, 0b00110000, 0b01110000, 0b00011000, 0b01110000, 0b00000011, 0b00000000, 0b00110000, 0b00110000, 0b00110000, 0b00111000, 0b01100011, 0b10001100, 0b00111000, 0b01110000, 0b00110000, 0b00111000, 0b00000000, 0b00110000, 0b00000110, 0b00000000, 0b00011100, 0b00000000, 0b00000001, 0b11000000, 0b00000110, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b00000111, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00111000, 0b00000000, 0b00000110, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000110, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000001, 0b10000000, 0b00000011, 0b00000000, 0b00000111, 0b00000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000011, 0b10000000, 0b00011100, 0b11100000, 0b00001100, 0b00110000, 0b00110011, 0b00111000, 0b11000110, 0b00110000, 0b00011000, 0b01100000, 0b00000011, 0b00000000, 0b00000110, 0b00000000, 0b00000001, 0b11000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b11100000, 0b00111000, 0b00110000, 0b00111001, 0b10000000, 0b00110000, 0b00110000, 0b00000000, 0b11000000, 0b00000011, 0b10000000, 0b00111000, 0b00000000, 0b00000111, 0b00000000, 0b00110000, 0b00111000, 0b00111000, 0b00110000, 0b00110000, 0b00111000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00010000, 0b00000000, 0b00000000, 0b00100000, 0b00000000, 0b00000000, 0b01110000, 0b00110000, 0b00011000, 0b00000111, 0b11000000, 0b00110000, 0b00110000, 0b00111000, 0b00111000, 0b00110000, 0b00110000, 0b00111000, 0b00000000, 0b00111000, 0b00000000, 0b00111000, 0b00110000, 0b00110000, 0b00110000, 0b00000011, 0b00000000, 0b00000000, 0b00110000, 0b00110000, 0b01110000, 0b00011000, 0b00000000, 0b00111100, 0b11111000, 0b00111100, 0b00110000, 0b00111000, 0b00110000, 0b00110000, 0b00011000, 0b00111000, 0b00110000, 0b00110000, 0b00111000, 0b00111000, 0b00110000, 0b00000011, 0b00000000, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b01100111, 0b10011100, 0b00011100, 0b01100000, 0b00111000, 0b00110000, 0b00000000, 0b01100000, 0b00000110, 0b00000000, 0b00001100, 0b00000000, 0b00000001, 0b11000000, 0b00001100, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b00000110, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00111000, 0b00000000, 0b00000110, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000110, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000001, 0b10000000, 0b00000011, 0b00000000, 0b00000111, 0b00000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00011100, 0b11100000, 0b00001100, 0b00110000, 0b00111011, 0b00000000, 0b11000110, 0b01100000, 0b00011000, 0b01100000, 0b00000011, 0b00000000, 0b00000110, 0b00000000, 0b00000001, 0b11000000, 0b00000011, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b11000000, 0b00110000, 0b00111000, 0b00110001, 0b10000000, 0b00110000, 0b00111000, 0b00000001, 0b10000000, 0b00000111, 0b00000000, 0b00111000, 0b00000000, 0b00000110, 0b00000000, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00111000, 0b00000011, 0b10000000, 0b00000011, 0b10000000, 0b00000000, 0b01111000, 0b00000000, 0b00000000, 0b00111000, 0b00000000, 0b00000000, 0b01110000, 0b01110000, 0b00011000, 0b00000110, 0b11000000, 0b00110000, 0b00110000, 0b00111000, 0b00111000, 0b00110000, 0b00110000, 0b00111000, 0b00000000, 0b00111000, 0b00000000, 0b00110000, 0b00111000, 0b00110000, 0b00110000, 0b00000011, 0b00000000, 0b00000000, 0b00110000, 0b00110000, 0b01100000, 0b00011000, 0b00000000, 0b00111100, 0b11011000, 0b00111110, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00011000, 0b00110000, 0b00111000, 0b00110000, 0b00111000, 0b00110000, 0b00110000, 0b00000011, 0b00000000, 0b00110000, 0b00110000, 0b00111000, 0b00110000, 0b01100111, 0b10011100, 0b00001100, 0b11100000, 0b00011000, 0b01110000, 0b00000000, 0b11100000, 0b00000110, 0b00000000, 0b00001110, 0b00000000, 0b00000001, 0b11000000, 0b00001100, 0b11100000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00001111, 0b11000000, 0b00110111, 0b11000000, 0b00001111, 0b11000000, 0b00001111, 0b10110000, 0b00001111, 0b11000000, 0b00000110, 0b00000000, 0b00001111, 0b10110000, 0b00110111, 0b11000000, 0b00111111, 0b10000000, 0b00111111, 0b11100000, 0b00111000, 0b00111000, 0b00000110, 0b00000000, 0b01111110, 0b11110000, 0b00110111, 0b11000000, 0b00001111, 0b11000000, 0b00110111, 0b11000000, 0b00001111, 0b10110000, 0b00011011, 0b11100000, 0b00001111, 0b11000000, 0b01111111, 0b11111000, 0b00110000, 0b00110000, 0b01110000, 0b00011000, 0b01100011, 0b00001100, 0b00110000, 0b00111000, 0b01110000, 0b00011000, 0b00111111, 0b11110000, 0b00000001, 0b10000000, 0b00000011, 0b00000000, 0b00000111, 0b00000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00011100, 0b11100000, 0b01111111, 0b11111100, 0b00111011, 0b00000000, 0b11000110, 0b11100000, 0b00011100, 0b00000000, 0b00000011, 0b00000000, 0b00001110, 0b00000000, 0b00000000, 0b11000000, 0b00000011, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000001, 0b11000000, 0b00110000, 0b00111000, 0b00000001, 0b10000000, 0b00000000, 0b00111000, 0b00000011, 0b10000000, 0b00000110, 0b00000000, 0b00111000, 0b00000000, 0b00001100, 0b00000000, 0b00000000, 0b01110000, 0b00111000, 0b00110000, 0b01110000, 0b00011000, 0b00000111, 0b10000000, 0b00000111, 0b10000000, 0b00000000, 0b11110000, 0b00000000, 0b00000000, 0b00111110, 0b00000000, 0b00000000, 0b01110000, 0b01100000, 0b00011100, 0b00001110, 0b11000000, 0b00110000, 0b00110000, 0b00110000, 0b00000000, 0b00110000, 0b00110000, 0b00111000, 0b00000000, 0b00111000, 0b00000000, 0b00110000, 0b00000000, 0b00110000, 0b00110000, 0b00000011, 0b00000000, 0b00000000, 0b00110000, 0b00110000, 0b11100000, 0b00011000, 0b00000000, 0b00110110, 0b11111000, 0b00110110, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00011000, 0b00110000, 0b00111000, 0b00110000, 0b00111000, 0b00111000, 0b00000000, 0b00000011, 0b00000000, 0b00110000, 0b00110000, 0b00111000, 0b00110000, 0b01100111, 0b10011000, 0b00001110, 0b11000000, 0b00011100, 0b01100000, 0b00000000, 0b11000000, 0b00000110, 0b00000000, 0b00000110, 0b00000000, 0b00000001, 0b11000000, 0b00011100, 0b01100000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00011111, 0b11100000, 0b00111111, 0b11100000, 0b00011111, 0b11110000, 0b00011111, 0b11110000, 0b00011111, 0b11100000, 0b00000110, 0b00000000, 0b00011111, 0b11110000, 0b00111111, 0b11100000, 0b00111111, 0b10000000, 0b00111111, 0b11100000, 0b00111000, 0b00110000, 0b00000110, 0b00000000, 0b01111111, 0b11111000, 0b00111111, 0b11100000, 0b00011111, 0b11100000, 0b00111111, 0b11100000, 0b00011111, 0b11110000, 0b00011111, 0b11110000, 0b00011111, 0b11110000, 0b01111111, 0b11111000, 0b00110000, 0b00110000, 0b00110000, 0b00111000, 0b01100011, 0b10011100, 0b00111000, 0b01110000, 0b00110000, 0b00111000, 0b00111111, 0b11110000, 0b00000001, 0b10000000, 0b00000011, 0b00000000, 0b00000110, 0b00000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00001100, 0b01100000, 0b00111111, 0b11111000, 0b00011111, 0b00000000, 0b01111110, 0b11000000, 0b00001100, 0b00000000, 0b00000011, 0b00000000, 0b00001110, 0b00000000, 0b00000000, 0b11000000, 0b01110011, 0b00111000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000001, 0b10000000, 0b00110000, 0b00111000, 0b00000001, 0b10000000, 0b00000000, 0b00110000, 0b00000111, 0b10000000, 0b00001110, 0b00000000, 0b00111111, 0b11000000, 0b00001111, 0b10000000, 0b00000000, 0b01100000, 0b00011000, 0b01110000, 0b01110000, 0b00111000, 0b00000111, 0b10000000, 0b00000111, 0b10000000, 0b00000011, 0b11000000, 0b00111111, 0b11110000, 0b00001111, 0b10000000, 0b00000000, 0b01110000, 0b01100001, 0b11111100, 0b00001100, 0b11000000, 0b00110000, 0b00110000, 0b00110000, 0b00000000, 0b00110000, 0b00110000, 0b00111000, 0b00000000, 0b00111000, 0b00000000, 0b00110000, 0b00000000, 0b00110000, 0b00110000, 0b00000011, 0b00000000, 0b00000000, 0b00110000, 0b00110000, 0b11000000, 0b00011000, 0b00000000, 0b00110111, 0b10111000, 0b00110110, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00011000, 0b00110000, 0b00111000, 0b00110000, 0b00111000, 0b00111000, 0b00000000, 0b00000011, 0b00000000, 0b00110000, 0b00110000, 0b00011000, 0b01110000, 0b01100110, 0b10011000, 0b00000111, 0b11000000, 0b00001100, 0b11100000, 0b00000001, 0b11000000, 0b00000110, 0b00000000, 0b00000110, 0b00000000, 0b00000001, 0b11000000, 0b00011000, 0b01110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00111000, 0b01110000, 0b00111100, 0b01110000, 0b00011100, 0b01110000, 0b00111000, 0b01110000, 0b00011000, 0b01110000, 0b01111111, 0b11111000, 0b00111000, 0b01110000, 0b00111100, 0b01110000, 0b00000001, 0b10000000, 0b00000000, 0b11100000, 0b00111000, 0b01110000, 0b00000110, 0b00000000, 0b01110011, 0b00011000, 0b00111100, 0b01110000, 0b00011000, 0b01110000, 0b00111100, 0b01110000, 0b00111000, 0b01110000, 0b00011100, 0b00110000, 0b00111000, 0b01110000, 0b00000110, 0b00000000, 0b00110000, 0b00110000, 0b00111000, 0b00110000, 0b01100011, 0b10011000, 0b00011100, 0b01100000, 0b00111000, 0b00110000, 0b00000000, 0b01110000, 0b00000001, 0b10000000, 0b00000011, 0b00000000, 0b00000110, 0b00000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00001100, 0b01100000, 0b00001100, 0b01100000, 0b00011111, 0b10000000, 0b01111101, 0b10000000, 0b00011110, 0b00000000, 0b00000011, 0b00000000, 0b00001110, 0b00000000, 0b00000000, 0b11000000, 0b01111111, 0b11111000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000001, 0b10000000, 0b00110011, 0b00111000, 0b00000001, 0b10000000, 0b00000000, 0b00110000, 0b00000111, 0b11100000, 0b00011100, 0b00110000, 0b00111111, 0b11100000, 0b00011111, 0b11100000, 0b00000000, 0b01100000, 0b00001111, 0b11100000, 0b00110000, 0b00111000, 0b00000011, 0b00000000, 0b00000011, 0b10000000, 0b00001111, 0b00000000, 0b00111111, 0b11111000, 0b00000011, 0b11100000, 0b00000000, 0b11100000, 0b01100011, 0b11111100, 0b00001100, 0b11100000, 0b00110000, 0b11100000, 0b00110000, 0b00000000, 0b00110000, 0b00110000, 0b00111111, 0b11110000, 0b00111000, 0b00000000, 0b00110000, 0b00000000, 0b00110000, 0b00110000, 0b00000011, 0b00000000, 0b00000000, 0b00110000, 0b00110001, 0b11000000, 0b00011000, 0b00000000, 0b00110111, 0b10111000, 0b00110011, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00111000, 0b00110000, 0b00111000, 0b00110000, 0b01110000, 0b00011110, 0b00000000, 0b00000011, 0b00000000, 0b00110000, 0b00110000, 0b00011000, 0b01100000, 0b01100110, 0b11011000, 0b00000111, 0b10000000, 0b00001110, 0b11000000, 0b00000001, 0b10000000, 0b00000110, 0b00000000, 0b00000111, 0b00000000, 0b00000001, 0b11000000, 0b00111000, 0b00110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00110000, 0b00111000, 0b00110000, 0b00111000, 0b00111000, 0b00111000, 0b00110000, 0b00111000, 0b00110000, 0b01111111, 0b11111000, 0b00111000, 0b00110000, 0b00111000, 0b00110000, 0b00000001, 0b10000000, 0b00000000, 0b11100000, 0b00111000, 0b11100000, 0b00000110, 0b00000000, 0b01110011, 0b00011000, 0b00111000, 0b00110000, 0b00111000, 0b00110000, 0b00111000, 0b00110000, 0b00111000, 0b00110000, 0b00011000, 0b00111000, 0b00110000, 0b00110000, 0b00000110, 0b00000000, 0b00110000, 0b00110000, 0b00111000, 0b00110000, 0b01100111, 0b10011000, 0b00001100, 0b11100000, 0b00011000, 0b01110000, 0b00000000, 0b11100000, 0b00000001, 0b10000000, 0b00000011, 0b00000000, 0b00000111, 0b00000000, 0b00011110, 0b00011000,
-    0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00011000, 0b01100000, 0b00000111, 0b11100000, 0b00000011, 0b10000000, 0b00111111, 0b00000100, 0b00000000, 0b00000000, 0b00001110, 0b00000000, 0b00000000, 0b11000000, 0b00011111, 0b11100000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000011, 0b10000000, 0b00110011, 0b10111000, 0b00000001, 0b10000000, 0b00000000, 0b01110000, 0b00000000, 0b11110000, 0b00011100, 0b01110000, 0b00000000, 0b11110000, 0b00111100, 0b01110000, 0b00000000, 0b11100000, 0b00001111, 0b11100000, 0b00111000, 0b01110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00111100, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b11110000, 0b00000111, 0b11100000, 0b01100011, 0b00011100, 0b00001100, 0b01100000, 0b00111111, 0b11000000, 0b00110000, 0b00000000, 0b00110000, 0b00110000, 0b00111111, 0b11110000, 0b00111111, 0b11110000, 0b00110001, 0b11111000, 0b00111111, 0b11110000, 0b00000011, 0b00000000, 0b00000000, 0b00110000, 0b00111111, 0b10000000, 0b00011000, 0b00000000, 0b00110011, 0b10111000, 0b00110011, 0b00110000, 0b00110000, 0b00110000, 0b00111111, 0b11110000, 0b00110000, 0b00111000, 0b00111111, 0b11110000, 0b00001111, 0b11000000, 0b00000011, 0b00000000, 0b00110000, 0b00110000, 0b00011100, 0b01100000, 0b01110110, 0b11011000, 0b00000011, 0b10000000, 0b00000111, 0b11000000, 0b00000011, 0b10000000, 0b00000110, 0b00000000, 0b00000011, 0b00000000, 0b00000001, 0b11000000, 0b00110000, 0b00110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00111000, 0b00110000, 0b00111000, 0b00111000, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00000110, 0b00000000, 0b00110000, 0b00110000, 0b00111000, 0b00110000, 0b00000001, 0b10000000, 0b00000000, 0b11100000, 0b00111000, 0b11000000, 0b00000110, 0b00000000, 0b01110011, 0b00011000, 0b00111000, 0b00110000, 0b00110000, 0b00110000, 0b00111000, 0b00110000, 0b00110000, 0b00110000, 0b00011000, 0b00111000, 0b00111000, 0b00000000, 0b00000110, 0b00000000, 0b00110000, 0b00110000, 0b00011000, 0b01110000, 0b01100111, 0b10011000, 0b00001110, 0b11000000, 0b00011000, 0b01110000, 0b00000000, 0b11000000, 0b00111111, 0b00000000, 0b00000011, 0b00000000, 0b00000011, 0b11111000, 0b00111111, 0b00011000,
-    0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00011000, 0b01100000, 0b00000011, 0b11110000, 0b00000011, 0b00000000, 0b01110011, 0b10001100, 0b00000000, 0b00000000, 0b00001110, 0b00000000, 0b00000000, 0b11000000, 0b00000011, 0b10000000, 0b01111111, 0b11111000, 0b00000000, 0b00000000, 0b00011111, 0b11100000, 0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00110011, 0b10111000, 0b00000001, 0b10000000, 0b00000000, 0b11100000, 0b00000000, 0b01110000, 0b00111000, 0b01110000, 0b00000000, 0b00110000, 0b00111000, 0b00110000, 0b00000000, 0b11000000, 0b00011100, 0b01110000, 0b00011111, 0b11110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00111000, 0b00000111, 0b11000000, 0b01100011, 0b00011100, 0b00011100, 0b01100000, 0b00111111, 0b11100000, 0b00110000, 0b00000000, 0b00110000, 0b00110000, 0b00111000, 0b00000000, 0b00111111, 0b11110000, 0b00110001, 0b11111000, 0b00111111, 0b11110000, 0b00000011, 0b00000000, 0b00000000, 0b00110000, 0b00111111, 0b10000000, 0b00011000, 0b00000000, 0b00110011, 0b00111000, 0b00110011, 0b00110000, 0b00110000, 0b00110000, 0b00111111, 0b11100000, 0b00110000, 0b00111000, 0b00111111, 0b11000000, 0b00000011, 0b11100000, 0b00000011, 0b00000000, 0b00110000, 0b00110000, 0b00011100, 0b01100000, 0b01110110, 0b11011000, 0b00000111, 0b10000000, 0b00000111, 0b10000000, 0b00000011, 0b00000000, 0b00000110, 0b00000000, 0b00000011, 0b10000000, 0b00000001, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00001111, 0b11110000, 0b00110000, 0b00110000, 0b00110000, 0b00000000, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00000110, 0b00000000, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00000001, 0b10000000, 0b00000000, 0b11100000, 0b00111001, 0b11000000, 0b00000110, 0b00000000, 0b01110011, 0b00011000, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00011000, 0b00111000, 0b00111110, 0b00000000, 0b00000110, 0b00000000, 0b00110000, 0b00110000, 0b00011000, 0b01100000, 0b01110110, 0b10011000, 0b00000111, 0b10000000, 0b00011100, 0b01100000, 0b00000001, 0b11000000, 0b00111111, 0b00000000, 0b00000011, 0b00000000, 0b00000011, 0b11111000, 0b00110011, 0b10111000,
-    0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00011000, 0b11100000, 0b00000011, 0b01110000, 0b00000110, 0b01111000, 0b01100001, 0b11011000, 0b00000000, 0b00000000, 0b00001110, 0b00000000, 0b00000000, 0b11000000, 0b00000111, 0b11000000, 0b01111111, 0b11111000, 0b00000000, 0b00000000, 0b00011111, 0b11100000, 0b00000000, 0b00000000, 0b00000111, 0b00000000, 0b00110000, 0b00111000, 0b00000001, 0b10000000, 0b00000001, 0b11000000, 0b00000000, 0b00110000, 0b00110000, 0b01110000, 0b00000000, 0b00110000, 0b00110000, 0b00111000, 0b00000001, 0b11000000, 0b00111000, 0b00110000, 0b00001111, 0b11100000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00111100, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b01111000, 0b00000110, 0b00000000, 0b01100011, 0b00011100, 0b00011000, 0b01100000, 0b00110000, 0b01110000, 0b00110000, 0b00000000, 0b00110000, 0b00110000, 0b00111000, 0b00000000, 0b00111000, 0b00000000, 0b00110000, 0b00111000, 0b00110000, 0b00110000, 0b00000011, 0b00000000, 0b00000000, 0b00110000, 0b00110001, 0b11000000, 0b00011000, 0b00000000, 0b00110000, 0b00111000, 0b00110001, 0b10110000, 0b00110000, 0b00110000, 0b00110000, 0b00000000, 0b00110000, 0b00111000, 0b00110001, 0b11000000, 0b00000000, 0b01110000, 0b00000011, 0b00000000, 0b00110000, 0b00110000, 0b00001100, 0b11100000, 0b00110100, 0b11011000, 0b00000111, 0b11000000, 0b00000011, 0b10000000, 0b00000111, 0b00000000, 0b00000110, 0b00000000, 0b00000011, 0b10000000, 0b00000001, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00011111, 0b11110000, 0b00110000, 0b00110000, 0b00110000, 0b00000000, 0b00110000, 0b00110000, 0b00111111, 0b11110000, 0b00000110, 0b00000000, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00000001, 0b10000000, 0b00000000, 0b11100000, 0b00111111, 0b10000000, 0b00000110, 0b00000000, 0b01110011, 0b00011000, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00011000, 0b00000000, 0b00011111, 0b11100000, 0b00000110, 0b00000000, 0b00110000, 0b00110000, 0b00011100, 0b01100000, 0b00110110, 0b11011000, 0b00000011, 0b10000000, 0b00001100, 0b11100000, 0b00000011, 0b10000000, 0b00000011, 0b10000000, 0b00000011, 0b00000000, 0b00000111, 0b00000000, 0b00110001, 0b11110000,
-    0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b01111111, 0b11111000, 0b00000011, 0b00111000, 0b00001110, 0b11111100, 0b11100000, 0b11111000, 0b00000000, 0b00000000, 0b00001110, 0b00000000, 0b00000000, 0b11000000, 0b00001110, 0b11000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000111, 0b00000000, 0b00110000, 0b00111000, 0b00000001, 0b10000000, 0b00000011, 0b10000000, 0b00000000, 0b00110000, 0b00110000, 0b01110000, 0b00000000, 0b00110000, 0b01110000, 0b00011000, 0b00000001, 0b11000000, 0b00110000, 0b00111000, 0b00000000, 0b11100000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00011111, 0b00000000, 0b00000000, 0b00000000, 0b00000001, 0b11110000, 0b00000110, 0b00000000, 0b01100011, 0b00011100, 0b00011111, 0b11110000, 0b00110000, 0b00111000, 0b00110000, 0b00000000, 0b00110000, 0b00110000, 0b00111000, 0b00000000, 0b00111000, 0b00000000, 0b00110000, 0b00111000, 0b00110000, 0b00110000, 0b00000011, 0b00000000, 0b00000000, 0b00110000, 0b00110000, 0b11000000, 0b00011000, 0b00000000, 0b00110000, 0b00111000, 0b00110001, 0b10110000, 0b00110000, 0b00110000, 0b00110000, 0b00000000, 0b00110000, 0b00111000, 0b00110000, 0b11000000, 0b00000000, 0b00111000, 0b00000011, 0b00000000, 0b00110000, 0b00110000, 0b00001100, 0b11000000, 0b00111100, 0b11011000, 0b00001110, 0b11000000, 0b00000011, 0b00000000, 0b00001110, 0b00000000, 0b00000110, 0b00000000, 0b00000001, 0b10000000, 0b00000001, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00111000, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00000000, 0b00110000, 0b00110000, 0b00111111, 0b11110000, 0b00000110, 0b00000000, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00000001, 0b10000000, 0b00000000, 0b11100000, 0b00111111, 0b10000000, 0b00000110, 0b00000000, 0b01110011, 0b00011000, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00011000, 0b00000000, 0b00000111, 0b11110000, 0b00000110, 0b00000000, 0b00110000, 0b00110000, 0b00001100, 0b11100000, 0b00110110, 0b11011000, 0b00000111, 0b10000000, 0b00001110, 0b11000000, 0b00000111, 0b00000000, 0b00000001, 0b10000000, 0b00000011, 0b00000000, 0b00000110, 0b00000000, 0b00110000, 0b11110000,
-    0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b01111111, 0b11110000, 0b00000011, 0b00111000, 0b00001101, 0b11001100, 0b11100000, 0b11110000, 0b00000000, 0b00000000, 0b00001110, 0b00000000, 0b00000000, 0b11000000, 0b00011100, 0b11100000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000110, 0b00000000, 0b00110000, 0b00111000, 0b00000001, 0b10000000, 0b00000111, 0b00000000, 0b00000000, 0b00110000, 0b00111111, 0b11110000, 0b00100000, 0b00111000, 0b01110000, 0b00011000, 0b00000001, 0b10000000, 0b01110000, 0b00011000, 0b00000000, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000111, 0b10000000, 0b00111111, 0b11110000, 0b00000111, 0b11000000, 0b00000110, 0b00000000, 0b01100011, 0b00011100, 0b00111111, 0b11110000, 0b00110000, 0b00111000, 0b00110000, 0b00000000, 0b00110000, 0b00110000, 0b00111000, 0b00000000, 0b00111000, 0b00000000, 0b00110000, 0b00111000, 0b00110000, 0b00110000, 0b00000011, 0b00000000, 0b00100000, 0b00110000, 0b00110000, 0b11100000, 0b00011000, 0b00000000, 0b00110000, 0b00111000, 0b00110001, 0b11110000, 0b00110000, 0b00110000, 0b00110000, 0b00000000, 0b00110000, 0b00111000, 0b00110000, 0b11100000, 0b00000000, 0b00111000, 0b00000011, 0b00000000, 0b00110000, 0b00110000, 0b00001110, 0b11000000, 0b00111100, 0b11111000, 0b00001100, 0b11100000, 0b00000011, 0b00000000, 0b00001100, 0b00000000, 0b00000110, 0b00000000, 0b00000001, 0b11000000, 0b00000001, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00000000, 0b00110000, 0b00110000, 0b00110000, 0b00000000, 0b00000110, 0b00000000, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00000001, 0b10000000, 0b00000000, 0b11100000, 0b00111001, 0b11000000, 0b00000110, 0b00000000, 0b01110011, 0b00011000, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00011000, 0b00000000, 0b00000000, 0b00110000, 0b00000110, 0b00000000, 0b00110000, 0b00110000, 0b00001100, 0b11000000, 0b00110100, 0b11110000, 0b00000111, 0b11000000, 0b00001110, 0b11000000, 0b00000110, 0b00000000, 0b00000001, 0b10000000, 0b00000011, 0b00000000, 0b00000110, 0b00000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00011000, 0b11000000, 0b00110011, 0b00111000, 0b00011001, 0b10001100, 0b11100000, 0b01110000, 0b00000000, 0b00000000, 0b00000110, 0b00000000, 0b00000001, 0b11000000, 0b00011000, 0b01110000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00001110, 0b00000000, 0b00110000, 0b00111000, 0b00000001, 0b10000000, 0b00001110, 0b00000000, 0b00110000, 0b00110000, 0b00111111, 0b11110000, 0b00110000, 0b00110000, 0b00110000, 0b00111000, 0b00000011, 0b10000000, 0b00110000, 0b00111000, 0b00000001, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000001, 0b11100000, 0b00111111, 0b11111000, 0b00011111, 0b00000000, 0b00000000, 0b00000000, 0b01100011, 0b00011000, 0b00111000, 0b00110000, 0b00110000, 0b00111000, 0b00111000, 0b00111000, 0b00110000, 0b00110000, 0b00111000, 0b00000000, 0b00111000, 0b00000000, 0b00110000, 0b00111000, 0b00110000, 0b00110000, 0b00000011, 0b00000000, 0b01110000, 0b00110000, 0b00110000, 0b01100000, 0b00011000, 0b00000000, 0b00110000, 0b00111000, 0b00110000, 0b11110000, 0b00110000, 0b00110000, 0b00110000, 0b00000000, 0b00110000, 0b00110000, 0b00110000, 0b01100000, 0b00110000, 0b00111000, 0b00000011, 0b00000000, 0b00110000, 0b00110000, 0b00000110, 0b11000000, 0b00111100, 0b11110000, 0b00011100, 0b01100000, 0b00000011, 0b00000000, 0b00011100, 0b00000000, 0b00000110, 0b00000000, 0b00000001, 0b11000000, 0b00000001, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00110000, 0b00111000, 0b00110000, 0b00111000, 0b00111000, 0b00110000, 0b00110000, 0b00110000, 0b00000000, 0b00000110, 0b00000000, 0b00111000, 0b01110000, 0b00110000, 0b00110000, 0b00000001, 0b10000000, 0b00000000, 0b11100000, 0b00111000, 0b11100000, 0b00000110, 0b00000000, 0b01110011, 0b00011000, 0b00110000, 0b00110000, 0b00110000, 0b00110000, 0b00111000, 0b00110000, 0b00110000, 0b00110000, 0b00011000, 0b00000000, 0b00000000, 0b00111000, 0b00000110, 0b00000000, 0b00111000, 0b00110000, 0b00001110, 0b11000000, 0b00111100, 0b11110000, 0b00001110, 0b11000000, 0b00000111, 0b11000000, 0b00001110, 0b00000000, 0b00000001, 0b10000000, 0b00000011, 0b00000000, 0b00000110, 0b00000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b11000000, 0b00110011, 0b00111000, 0b00111001, 0b10001100, 0b01100000, 0b11111000, 0b00000000, 0b00000000, 0b00000110, 0b00000000, 0b00000001, 0b11000000, 0b00011000, 0b00100000, 0b00000011, 0b00000000, 0b00000011, 0b10000000, 0b00000000, 0b00000000, 0b00000011, 0b10000000, 0b00001110, 0b00000000, 0b00111000, 0b00110000, 0b00000001, 0b10000000, 0b00011100, 0b00000000, 0b00110000, 0b00110000, 0b00000000, 0b01110000, 0b00110000, 0b00110000, 0b00110000, 0b00111000, 0b00000011, 0b00000000, 0b00110000, 0b00111000, 0b00000001, 0b10000000, 0b00000011, 0b00000000, 0b00000011, 0b10000000, 0b00000000, 0b01111000, 0b00000000, 0b00000000, 0b00111100, 0b00000000, 0b00000000, 0b00000000, 0b01100011, 0b11111000, 0b00110000, 0b00110000, 0b00110000, 0b00111000, 0b00111000, 0b00111000, 0b00110000, 0b00110000, 0b00111000, 0b00000000, 0b00111000, 0b00000000, 0b00111000, 0b00110000, 0b00110000, 0b00110000, 0b00000011, 0b00000000, 0b01110000, 0b01110000, 0b00110000, 0b01110000, 0b00011000, 0b00000000, 0b00110000, 0b00111000, 0b00110000, 0b11110000, 0b00111000, 0b00110000, 0b00110000, 0b00000000, 0b00111000, 0b00110000, 0b00110000, 0b01110000, 0b00110000, 0b00111000, 0b00000011, 0b00000000, 0b00111000, 0b00110000, 0b00000111, 0b11000000, 0b00111100, 0b01110000, 0b00011000, 0b01110000, 0b00000011, 0b00000000, 0b00011000, 0b00000000, 0b00000110, 0b00000000, 0b00000000, 0b11000000, 0b00000001, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00110000, 0b00111000, 0b00110000, 0b00111000, 0b00111000, 0b00111000, 0b00110000, 0b00111000, 0b00110000, 0b00000110, 0b00000000, 0b00011100, 0b11110000, 0b00110000, 0b00110000, 0b00000001, 0b10000000, 0b00000000, 0b11100000, 0b00111000, 0b01100000, 0b00000111, 0b00000000, 0b01110011, 0b00011000, 0b00110000, 0b00110000, 0b00111000, 0b00110000, 0b00111000, 0b00110000, 0b00111000, 0b00110000, 0b00011000, 0b00000000, 0b00110000, 0b00111000, 0b00000110, 0b00000000, 0b00111000, 0b00110000, 0b00000111, 0b11000000, 0b00111100, 0b11110000, 0b00011100, 0b11100000, 0b00000111, 0b10000000, 0b00011100, 0b00000000, 0b00000001, 0b10000000, 0b00000011, 0b00000000, 0b00000111, 0b00000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000011, 0b10000000, 0b00000000, 0b00000000, 0b00110000, 0b11000000, 0b00111111, 0b01110000, 0b00110001, 0b10001100, 0b01110001, 0b11011000, 0b00000000, 0b00000000, 0b00000111, 0b00000000, 0b00000001, 0b10000000, 0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00000011, 0b10000000, 0b00000000, 0b00000000, 0b00000111, 0b10000000, 0b00001100, 0b00000000, 0b00111000, 0b01110000, 0b00000001, 0b10000000, 0b00111000, 0b00000000, 0b00111000, 0b01110000, 0b00000000, 0b01110000, 0b00111000, 0b01110000, 0b00111000, 0b01110000, 0b00000111, 0b00000000, 0b00111000, 0b01110000, 0b00000011, 0b10000000, 0b00000111, 0b10000000, 0b00000011, 0b10000000, 0b00000000, 0b00111000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000111, 0b00000000, 0b01100001, 0b11110000, 0b00110000, 0b00111000, 0b00110000, 0b01110000, 0b00011100, 0b01110000, 0b00110000, 0b11110000, 0b00111000, 0b00000000, 0b00111000, 0b00000000, 0b00011100, 0b01110000, 0b00110000, 0b00110000, 0b00000011, 0b00000000, 0b00111000, 0b11100000, 0b00110000, 0b00110000, 0b00011000, 0b00000000, 0b00110000, 0b00111000, 0b00110000, 0b11110000, 0b00011000, 0b01110000, 0b00110000, 0b00000000, 0b00111000, 0b01110000, 0b00110000, 0b01110000, 0b00111000, 0b01110000, 0b00000011, 0b00000000, 0b00011100, 0b01110000, 0b00000111, 0b10000000, 0b00111100, 0b01110000, 0b00111000, 0b00110000, 0b00000011, 0b00000000, 0b00111000, 0b00000000, 0b00000110, 0b00000000, 0b00000000, 0b11100000, 0b00000001, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00111000, 0b01110000, 0b00111100, 0b01110000, 0b00011100, 0b01110000, 0b00111000, 0b01110000, 0b00011000, 0b01110000, 0b00000110, 0b00000000, 0b00011111, 0b11110000, 0b00110000, 0b00110000, 0b00000001, 0b10000000, 0b00000000, 0b11100000, 0b00111000, 0b01110000, 0b00000111, 0b00000000, 0b01110011, 0b00011000, 0b00110000, 0b00110000, 0b00011000, 0b01110000, 0b00111100, 0b01110000, 0b00111000, 0b01110000, 0b00011000, 0b00000000, 0b00111000, 0b00110000, 0b00000111, 0b00000000, 0b00011100, 0b01110000, 0b00000111, 0b10000000, 0b00111100, 0b11110000, 0b00011000, 0b01110000, 0b00000011, 0b10000000, 0b00111000, 0b00000000, 0b00000001, 0b10000000, 0b00000011, 0b00000000, 0b00000111, 0b00000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000111, 0b10000000, 0b00000000, 0b00000000, 0b00110000, 0b11000000, 0b00011111, 0b11100000, 0b01100000, 0b11111100, 0b01111111, 0b10011100, 0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00000011, 0b10000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000011, 0b10000000, 0b00000000, 0b00000000, 0b00000111, 0b10000000, 0b00011100, 0b00000000, 0b00011111, 0b11100000, 0b00111111, 0b11111000, 0b00111111, 0b11111000, 0b00011111, 0b11100000, 0b00000000, 0b01110000, 0b00011111, 0b11100000, 0b00011111, 0b11100000, 0b00000111, 0b00000000, 0b00011111, 0b11100000, 0b00000111, 0b00000000, 0b00000111, 0b10000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00001111, 0b00000000, 0b01100000, 0b00000000, 0b01110000, 0b00011000, 0b00111111, 0b11110000, 0b00011111, 0b11100000, 0b00111111, 0b11100000, 0b00111111, 0b11111000, 0b00111000, 0b00000000, 0b00011111, 0b11100000, 0b00110000, 0b00110000, 0b00111111, 0b11110000, 0b00111111, 0b11100000, 0b00110000, 0b00111000, 0b00011111, 0b11111000, 0b00110000, 0b00111000, 0b00110000, 0b01110000, 0b00011111, 0b11100000, 0b00110000, 0b00000000, 0b00011111, 0b11100000, 0b00110000, 0b00111000, 0b00011111, 0b11110000, 0b00000011, 0b00000000, 0b00011111, 0b11100000, 0b00000111, 0b10000000, 0b00111100, 0b01110000, 0b00110000, 0b00111000, 0b00000011, 0b00000000, 0b00111111, 0b11111000, 0b00000110, 0b00000000, 0b00000000, 0b01100000, 0b00000001, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00111111, 0b11110000, 0b00111111, 0b11100000, 0b00011111, 0b11110000, 0b00011111, 0b11110000, 0b00011111, 0b11100000, 0b00000110, 0b00000000, 0b00000111, 0b00110000, 0b00110000, 0b00110000, 0b00111111, 0b11111000, 0b00000000, 0b11100000, 0b00111000, 0b00111000, 0b00000011, 0b11111000, 0b01110011, 0b00011000, 0b00110000, 0b00110000, 0b00011111, 0b11100000, 0b00111111, 0b11100000, 0b00011111, 0b11110000, 0b00011000, 0b00000000, 0b00011111, 0b11110000, 0b00000111, 0b11110000, 0b00011111, 0b11100000, 0b00000111, 0b10000000, 0b00011100, 0b01110000, 0b00111000, 0b00110000, 0b00000011, 0b10000000, 0b00111111, 0b11110000, 0b00000011, 0b10000000, 0b00000011, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000011, 0b10000000, 0b00000000, 0b00000000, 0b00110001, 0b10000000, 0b00001111, 0b11000000, 0b11100000, 0b01111000, 0b00011110, 0b00001110, 0b00000000, 0b00000000, 0b00000011, 0b10000000, 0b00000111, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000011, 0b10000000, 0b00011000, 0b00000000, 0b00001111, 0b11000000, 0b00111111, 0b11111000, 0b00111111, 0b11111000, 0b00001111, 0b11000000, 0b00000000, 0b01110000, 0b00001111, 0b11000000, 0b00001111, 0b11000000, 0b00000110, 0b00000000, 0b00001111, 0b11000000, 0b00000111, 0b00000000, 0b00000011, 0b10000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000111, 0b00000000, 0b01110000, 0b00000000, 0b01110000, 0b00011000, 0b00111111, 0b11000000, 0b00001111, 0b11000000, 0b00111111, 0b11000000, 0b00111111, 0b11111000, 0b00111000, 0b00000000, 0b00001111, 0b11000000, 0b00110000, 0b00110000, 0b00111111, 0b11110000, 0b00001111, 0b10000000, 0b00110000, 0b00011000, 0b00011111, 0b11111000, 0b00110000, 0b00111000, 0b00110000, 0b01110000, 0b00001111, 0b11000000, 0b00110000, 0b00000000, 0b00001111, 0b11000000, 0b00110000, 0b00111000, 0b00001111, 0b11000000, 0b00000011, 0b00000000, 0b00001111, 0b11000000, 0b00000011, 0b10000000, 0b00111000, 0b01110000, 0b01110000, 0b00011000, 0b00000011, 0b00000000, 0b00111111, 0b11111000, 0b00000110, 0b00000000, 0b00000000, 0b01100000, 0b00000001, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00011111, 0b10110000, 0b00110111, 0b11000000, 0b00001111, 0b11000000, 0b00001111, 0b10110000, 0b00001111, 0b11000000, 0b00000110, 0b00000000, 0b00000000, 0b00110000, 0b00110000, 0b00110000, 0b00111111, 0b11111000, 0b00000000, 0b11100000, 0b00111000, 0b00111000, 0b00000001, 0b11111000, 0b01110011, 0b00011000, 0b00110000, 0b00110000, 0b00001111, 0b11000000, 0b00110111, 0b11000000, 0b00001111, 0b10110000, 0b00011000, 0b00000000, 0b00001111, 0b11100000, 0b00000011, 0b11111000, 0b00001111, 0b11000000, 0b00000011, 0b10000000, 0b00011100, 0b01110000, 0b01110000, 0b00111000, 0b00000011, 0b00000000, 0b00111111, 0b11110000, 0b00000011, 0b10000000, 0b00000011, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000001, 0b11100000, 0b00001111, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000111, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00011000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000111, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b11100000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000110, 0b00000000, 0b00000000, 0b01110000, 0b00000001, 0b11000000, 0b00000000, 0b00000000, 0b01111111, 0b11111000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000111, 0b00000000, 0b00000000, 0b00000000, 0b00000001, 0b10000000, 0b00000011, 0b00000000, 0b00000111, 0b00000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b11110000, 0b00011100, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000111, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00111000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000111, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00111000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b11100000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000111, 0b11100000, 0b00000000, 0b00110000, 0b00011111, 0b11000000, 0b00000000, 0b00000000, 0b01111111, 0b11111000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b01110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000001, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000111, 0b00000000, 0b00000000, 0b00000000, 0b00000001, 0b11110000, 0b00000011, 0b00000000, 0b00111110, 0b00000000, 0b00000000, 0b00000000,
-    0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000011, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00011000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000111, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000111, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00011111, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b01110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000111, 0b11100000, 0b00000000, 0b00111000, 0b00011111, 0b11000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00001111, 0b11100000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00111111, 0b10000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b00110000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b00000110, 0b00000000, 0b00000000, 0b00000000, 0b00000000, 0b11110000, 0b00000011, 0b00000000, 0b00111100, 0b00000000, 0b00000000, 0b00000000
+static const Glyph __font_ubuntu_mono_16x24_glyphs[] = {
+    {     0,  0,  0,  0,  0, 16 }, // U+0020 ' '
+    {     0,  4, 17,  5,  2, 16 }, // U+0021 '!'
+    {    17,  6,  7,  4,  0, 16 }, // U+0022 '"'
+    {    24, 12, 17,  1,  2, 16 }, // U+0023 '#'
+    {    58, 10, 22,  2,  0, 16 }, // U+0024 '$'
+    {   102, 13, 17,  0,  2, 16 }, // U+0025 '%'
+    {   136, 12, 17,  1,  2, 16 }, // U+0026 '&'
+    {   170,  3,  7,  5,  0, 16 }, // U+0027 '''
+    {   177,  7, 23,  3,  0, 16 }, // U+0028 '('
+    {   200,  7, 24,  3,  0, 16 }, // U+0029 ')'
+    {   224, 10, 10,  2,  2, 16 }, // U+002A '*'
+    {   244, 11, 12,  1,  6, 16 }, // U+002B '+'
+    {   268,  6,  8,  4, 15, 16 }, // U+002C ','
+    {   276,  6,  2,  4, 11, 16 }, // U+002D '-'
+    {   278,  4,  4,  5, 15, 16 }, // U+002E '.'
+    {   282,  9, 24,  2,  0, 16 }, // U+002F '/'
+    {   330, 11, 17,  1,  2, 16 }, // U+0030 '0'
+    {   364, 10, 17,  2,  2, 16 }, // U+0031 '1'
+    {   398, 10, 17,  2,  2, 16 }, // U+0032 '2'
+    {   432, 10, 17,  2,  2, 16 }, // U+0033 '3'
+    {   466, 12, 17,  1,  2, 16 }, // U+0034 '4'
+    {   500, 10, 17,  2,  2, 16 }, // U+0035 '5'
+    {   534, 11, 17,  1,  2, 16 }, // U+0036 '6'
+    {   568, 11, 17,  2,  2, 16 }, // U+0037 '7'
+    {   602, 11, 17,  1,  2, 16 }, // U+0038 '8'
+    {   636, 11, 17,  1,  2, 16 }, // U+0039 '9'
+    {   670,  4, 13,  5,  6, 16 }, // U+003A ':'
+    {   683,  6, 17,  3,  6, 16 }, // U+003B ';'
+    {   700, 11, 10,  1,  7, 16 }, // U+003C '<'
+    {   720, 11,  7,  1,  8, 16 }, // U+003D '='
+    {   734, 12, 10,  1,  7, 16 }, // U+003E '>'
+    {   754,  8, 17,  3,  2, 16 }, // U+003F '?'
+    {   771, 12, 21,  1,  2, 16 }, // U+0040 '@'
+    {   813, 13, 17,  0,  2, 16 }, // U+0041 'A'
+    {   847, 11, 17,  1,  2, 16 }, // U+0042 'B'
+    {   881, 11, 17,  1,  2, 16 }, // U+0043 'C'
+    {   915, 12, 17,  1,  2, 16 }, // U+0044 'D'
+    {   949, 11, 17,  2,  2, 16 }, // U+0045 'E'
+    {   983, 10, 17,  2,  2, 16 }, // U+0046 'F'
+    {  1017, 11, 17,  1,  2, 16 }, // U+0047 'G'
+    {  1051, 11, 17,  1,  2, 16 }, // U+0048 'H'
+    {  1085,  9, 17,  2,  2, 16 }, // U+0049 'I'
+    {  1119, 10, 17,  1,  2, 16 }, // U+004A 'J'
+    {  1153, 11, 17,  2,  2, 16 }, // U+004B 'K'
+    {  1187, 11, 17,  2,  2, 16 }, // U+004C 'L'
+    {  1221, 12, 17,  1,  2, 16 }, // U+004D 'M'
+    {  1255, 11, 17,  1,  2, 16 }, // U+004E 'N'
+    {  1289, 12, 17,  1,  2, 16 }, // U+004F 'O'
+    {  1323, 10, 17,  2,  2, 16 }, // U+0050 'P'
+    {  1357, 12, 22,  1,  2, 16 }, // U+0051 'Q'
+    {  1401, 11, 17,  1,  2, 16 }, // U+0052 'R'
+    {  1435, 10, 17,  2,  2, 16 }, // U+0053 'S'
+    {  1469, 12, 17,  1,  2, 16 }, // U+0054 'T'
+    {  1503, 11, 17,  1,  2, 16 }, // U+0055 'U'
+    {  1537, 13, 17,  0,  2, 16 }, // U+0056 'V'
+    {  1571, 12, 17,  1,  2, 16 }, // U+0057 'W'
+    {  1605, 12, 17,  1,  2, 16 }, // U+0058 'X'
+    {  1639, 13, 17,  0,  2, 16 }, // U+0059 'Y'
+    {  1673, 12, 17,  1,  2, 16 }, // U+005A 'Z'
+    {  1707,  6, 24,  4,  0, 16 }, // U+005B '['
+    {  1731,  9, 24,  2,  0, 16 }, // U+005C
+    {  1779,  7, 24,  3,  0, 16 }, // U+005D ']'
+    {  1803, 11,  9,  1,  2, 16 }, // U+005E '^'
+    {  1821, 13,  2,  0, 22, 16 }, // U+005F '_'
+    {  1825,  3,  5,  5,  0, 16 }, // U+0060 '`'
+    {  1830, 11, 13,  1,  6, 16 }, // U+0061 'a'
+    {  1856, 11, 19,  2,  0, 16 }, // U+0062 'b'
+    {  1894, 11, 13,  1,  6, 16 }, // U+0063 'c'
+    {  1920, 11, 19,  1,  0, 16 }, // U+0064 'd'
+    {  1958, 11, 13,  1,  6, 16 }, // U+0065 'e'
+    {  1984, 11, 19,  2,  0, 16 }, // U+0066 'f'
+    {  2022, 11, 18,  1,  6, 16 }, // U+0067 'g'
+    {  2058, 10, 19,  2,  0, 16 }, // U+0068 'h'
+    {  2096, 11, 19,  1,  0, 16 }, // U+0069 'i'
+    {  2134,  8, 24,  2,  0, 16 }, // U+006A 'j'
+    {  2158, 11, 19,  2,  0, 16 }, // U+006B 'k'
+    {  2196, 11, 19,  1,  0, 16 }, // U+006C 'l'
+    {  2234, 12, 13,  1,  6, 16 }, // U+006D 'm'
+    {  2260, 10, 13,  2,  6, 16 }, // U+006E 'n'
+    {  2286, 11, 13,  1,  6, 16 }, // U+006F 'o'
+    {  2312, 11, 18,  2,  6, 16 }, // U+0070 'p'
+    {  2348, 11, 18,  1,  6, 16 }, // U+0071 'q'
+    {  2384,  9, 13,  3,  6, 16 }, // U+0072 'r'
+    {  2410, 10, 13,  2,  6, 16 }, // U+0073 's'
+    {  2436, 10, 17,  2,  2, 16 }, // U+0074 't'
+    {  2470, 10, 13,  2,  6, 16 }, // U+0075 'u'
+    {  2496, 12, 13,  1,  6, 16 }, // U+0076 'v'
+    {  2522, 13, 13,  0,  6, 16 }, // U+0077 'w'
+    {  2548, 12, 13,  1,  6, 16 }, // U+0078 'x'
+    {  2574, 11, 18,  1,  6, 16 }, // U+0079 'y'
+    {  2610, 10, 13,  2,  6, 16 }, // U+007A 'z'
+    {  2636, 10, 24,  2,  0, 16 }, // U+007B '{'
+    {  2684,  2, 24,  6,  0, 16 }, // U+007C '|'
+    {  2708,  9, 24,  2,  0, 16 }, // U+007D '}'
+    {  2756, 11,  4,  1, 10, 16 }, // U+007E '~'
+    {  2764, 12, 15,  2,  4, 16 }, // fallback
+};
+
+static const FontRange __font_ubuntu_mono_16x24_ranges[] = {
+    { 0x0020,  95,   0 },
 };
 
 Font font_ubuntu_mono_16x24 = {
-    .first_char = 0x20,
-    .num_chars = 95,
-    .char_width = 16,
-    .char_height = 24,
-    .size = sizeof(__font_ubuntu_mono_16x24),
+    .version = FONT_VERSION,
+    .encoding = FONT_ENCODING_RAW,
+    .line_height = 24,
+    .baseline = 19,
+    .num_glyphs = 96,
+    .num_ranges = 1,
+    .fallback = 95,
+    .size = sizeof(__font_ubuntu_mono_16x24_bitmap),
     .name = "Ubuntu Mono",
-    .font_array = __font_ubuntu_mono_16x24,
+    .ranges = __font_ubuntu_mono_16x24_ranges,
+    .glyphs = __font_ubuntu_mono_16x24_glyphs,
+    .bitmap = __font_ubuntu_mono_16x24_bitmap,
+};
+
+static const uint8_t __font_jetbrains_mono_16x24_bitmap[] = {
+    // U+0021 '!'
+    0b01110000,
+    0b01110000,
+    0b01110000,
+    0b01110000,
+    0b01100000,
+    0b01100000,
+    0b01100000,
+    0b01100000,
+    0b01100000,
+    0b01100000,
+    0b01100000,
+    0b01100000,
+    0b01100000,
+    0b00000000,
+    0b00000000,
+    0b01110000,
+    0b11110000,
+    0b01110000,
+    // U+0022 '"'
+    0b11100111,
+    0b11100111,
+    0b11100111,
+    0b11100111,
+    0b11100111,
+    0b11100111,
+    0b01100011,
+    0b01100011,
+    // U+0023 '#'
+    0b00001100, 0b01110000,
+    0b00001100, 0b01100000,
+    0b00001100, 0b01100000,
+    0b00011000, 0b01100000,
+    0b00011000, 0b01100000,
+    0b11111111, 0b11111000,
+    0b01111111, 0b11110000,
+    0b00011000, 0b11000000,
+    0b00110000, 0b11000000,
+    0b00110000, 0b11000000,
+    0b00110001, 0b11000000,
+    0b11111111, 0b11110000,
+    0b11111111, 0b11100000,
+    0b00110001, 0b10000000,
+    0b01100001, 0b10000000,
+    0b01100001, 0b10000000,
+    0b01100001, 0b10000000,
+    0b01100011, 0b00000000,
+    // U+0024 '$'
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00111111, 0b00000000,
+    0b01111111, 0b10000000,
+    0b01101101, 0b11000000,
+    0b11101100, 0b11000000,
+    0b11001100, 0b11100000,
+    0b11101100, 0b00000000,
+    0b11101100, 0b00000000,
+    0b01111100, 0b00000000,
+    0b01111110, 0b00000000,
+    0b00011111, 0b10000000,
+    0b00001111, 0b11000000,
+    0b00001101, 0b11000000,
+    0b00001100, 0b11100000,
+    0b00001100, 0b11100000,
+    0b11001100, 0b11100000,
+    0b11001100, 0b11100000,
+    0b11111101, 0b11000000,
+    0b01111111, 0b10000000,
+    0b00111111, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    // U+0025 '%'
+    0b01111100, 0b00001100,
+    0b01111110, 0b00011000,
+    0b11000110, 0b00111000,
+    0b11000110, 0b00110000,
+    0b11000110, 0b01100000,
+    0b11000110, 0b11100000,
+    0b01111110, 0b11000000,
+    0b01111101, 0b10000000,
+    0b00000011, 0b10000000,
+    0b00000011, 0b00000000,
+    0b00000110, 0b01111000,
+    0b00001110, 0b11111100,
+    0b00001101, 0b11001100,
+    0b00011001, 0b10001100,
+    0b00111001, 0b10001100,
+    0b00110001, 0b10001100,
+    0b01100000, 0b11111100,
+    0b11100000, 0b01111000,
+    // U+0026 '&'
+    0b00001111, 0b10000000,
+    0b00011111, 0b11000000,
+    0b00011000, 0b11100000,
+    0b00011000, 0b01100000,
+    0b00011000, 0b01100000,
+    0b00011100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00011110, 0b00000000,
+    0b00111111, 0b00000100,
+    0b01110011, 0b10001100,
+    0b01100001, 0b11011000,
+    0b11100000, 0b11111000,
+    0b11100000, 0b11110000,
+    0b11100000, 0b01110000,
+    0b01100000, 0b11111000,
+    0b01110001, 0b11011000,
+    0b01111111, 0b10011100,
+    0b00011110, 0b00001110,
+    // U+0027 '''
+    0b11100000,
+    0b11100000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    // U+0028 '('
+    0b00000011,
+    0b00001111,
+    0b00011110,
+    0b00111000,
+    0b00110000,
+    0b01110000,
+    0b01100000,
+    0b01100000,
+    0b11100000,
+    0b11100000,
+    0b11100000,
+    0b11100000,
+    0b11100000,
+    0b11100000,
+    0b11100000,
+    0b11100000,
+    0b01100000,
+    0b01100000,
+    0b01110000,
+    0b00110000,
+    0b00111000,
+    0b00011110,
+    0b00001111,
+    0b00000011,
+    // U+0029 ')'
+    0b11000000,
+    0b11100000,
+    0b01110000,
+    0b00111000,
+    0b00011100,
+    0b00001100,
+    0b00001110,
+    0b00001110,
+    0b00000110,
+    0b00000110,
+    0b00000110,
+    0b00000110,
+    0b00000110,
+    0b00000110,
+    0b00000110,
+    0b00000110,
+    0b00001110,
+    0b00001110,
+    0b00001100,
+    0b00011100,
+    0b00111000,
+    0b01111000,
+    0b11100000,
+    0b11000000,
+    // U+002A '*'
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b11100110, 0b01110000,
+    0b11111111, 0b11110000,
+    0b00111111, 0b11000000,
+    0b00000111, 0b00000000,
+    0b00001111, 0b10000000,
+    0b00011101, 0b10000000,
+    0b00111001, 0b11000000,
+    0b00110000, 0b11100000,
+    0b00110000, 0b01000000,
+    // U+002B '+'
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b11111111, 0b11110000,
+    0b11111111, 0b11110000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    // U+002C ','
+    0b01110000,
+    0b01110000,
+    0b01110000,
+    0b01100000,
+    0b11100000,
+    0b11100000,
+    0b11100000,
+    // U+002D '-'
+    0b11111111,
+    0b11111111,
+    // U+002E '.'
+    0b01110000,
+    0b11110000,
+    0b11110000,
+    0b01110000,
+    // U+002F '/'
+    0b00000000, 0b11000000,
+    0b00000000, 0b11000000,
+    0b00000001, 0b11000000,
+    0b00000001, 0b11000000,
+    0b00000001, 0b10000000,
+    0b00000011, 0b10000000,
+    0b00000011, 0b10000000,
+    0b00000011, 0b00000000,
+    0b00000111, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00011100, 0b00000000,
+    0b00011100, 0b00000000,
+    0b00011000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b00110000, 0b00000000,
+    0b01110000, 0b00000000,
+    0b01100000, 0b00000000,
+    0b01100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11000000, 0b00000000,
+    // U+0030 '0'
+    0b00111111, 0b00000000,
+    0b01111111, 0b10000000,
+    0b11100001, 0b11000000,
+    0b11100000, 0b11000000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11001100, 0b11100000,
+    0b11001110, 0b11100000,
+    0b11001110, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11100000, 0b11000000,
+    0b11100001, 0b11000000,
+    0b01111111, 0b10000000,
+    0b00111111, 0b00000000,
+    // U+0031 '1'
+    0b00011110, 0b00000000,
+    0b00111110, 0b00000000,
+    0b01110110, 0b00000000,
+    0b11100110, 0b00000000,
+    0b11000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b11111111, 0b11100000,
+    0b11111111, 0b11100000,
+    // U+0032 '2'
+    0b00111111, 0b00000000,
+    0b01111111, 0b10000000,
+    0b11100001, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11100000,
+    0b00000000, 0b11100000,
+    0b00000000, 0b11000000,
+    0b00000000, 0b11000000,
+    0b00000001, 0b11000000,
+    0b00000011, 0b10000000,
+    0b00000111, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00011100, 0b00000000,
+    0b00111000, 0b00000000,
+    0b01110000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11111111, 0b11100000,
+    0b11111111, 0b11100000,
+    // U+0033 '3'
+    0b11111111, 0b11000000,
+    0b11111111, 0b11000000,
+    0b00000001, 0b10000000,
+    0b00000011, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00011110, 0b00000000,
+    0b00011111, 0b10000000,
+    0b00000011, 0b11000000,
+    0b00000001, 0b11000000,
+    0b00000000, 0b11000000,
+    0b00000000, 0b11000000,
+    0b00000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11100001, 0b11000000,
+    0b01111111, 0b10000000,
+    0b00111111, 0b00000000,
+    // U+0034 '4'
+    0b00000011, 0b00000000,
+    0b00000111, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00011100, 0b00000000,
+    0b00011000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b01110000, 0b11000000,
+    0b01110001, 0b11000000,
+    0b11100001, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11111111, 0b11000000,
+    0b11111111, 0b11000000,
+    0b00000001, 0b11000000,
+    0b00000001, 0b11000000,
+    0b00000001, 0b11000000,
+    0b00000001, 0b11000000,
+    // U+0035 '5'
+    0b11111111, 0b11000000,
+    0b11111111, 0b11000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11111111, 0b00000000,
+    0b11111111, 0b10000000,
+    0b00000011, 0b11000000,
+    0b00000000, 0b11000000,
+    0b00000000, 0b11000000,
+    0b00000000, 0b11000000,
+    0b10000000, 0b11100000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11100001, 0b11000000,
+    0b01111111, 0b10000000,
+    0b00111111, 0b00000000,
+    // U+0036 '6'
+    0b00000011, 0b00000000,
+    0b00000111, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00011000, 0b00000000,
+    0b00011111, 0b00000000,
+    0b00111111, 0b11000000,
+    0b01111000, 0b11100000,
+    0b01110000, 0b01100000,
+    0b01100000, 0b01110000,
+    0b11100000, 0b00110000,
+    0b11100000, 0b00110000,
+    0b01100000, 0b01110000,
+    0b01100000, 0b01110000,
+    0b01110000, 0b11100000,
+    0b00111111, 0b11000000,
+    0b00011111, 0b10000000,
+    // U+0037 '7'
+    0b11111111, 0b11100000,
+    0b11111111, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11000000,
+    0b00000001, 0b11000000,
+    0b00000001, 0b10000000,
+    0b00000001, 0b10000000,
+    0b00000011, 0b10000000,
+    0b00000011, 0b00000000,
+    0b00000111, 0b00000000,
+    0b00000111, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00011100, 0b00000000,
+    0b00011100, 0b00000000,
+    0b00011000, 0b00000000,
+    // U+0038 '8'
+    0b00011111, 0b10000000,
+    0b00111111, 0b11000000,
+    0b01110000, 0b11100000,
+    0b01110000, 0b01100000,
+    0b01100000, 0b01100000,
+    0b01110000, 0b01100000,
+    0b00110000, 0b11100000,
+    0b00011111, 0b11000000,
+    0b00011111, 0b11000000,
+    0b00111000, 0b11100000,
+    0b01110000, 0b01100000,
+    0b01100000, 0b01110000,
+    0b11100000, 0b00110000,
+    0b01100000, 0b01110000,
+    0b01100000, 0b01110000,
+    0b01110000, 0b11100000,
+    0b00111111, 0b11000000,
+    0b00011111, 0b10000000,
+    // U+0039 '9'
+    0b00011111, 0b10000000,
+    0b00111111, 0b11000000,
+    0b01110000, 0b11100000,
+    0b01100000, 0b01110000,
+    0b01100000, 0b01110000,
+    0b11100000, 0b00110000,
+    0b11100000, 0b01110000,
+    0b01100000, 0b01110000,
+    0b01110000, 0b11100000,
+    0b00111111, 0b11100000,
+    0b00011111, 0b11000000,
+    0b00000001, 0b11000000,
+    0b00000001, 0b10000000,
+    0b00000011, 0b10000000,
+    0b00000011, 0b00000000,
+    0b00000111, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001110, 0b00000000,
+    // U+003A ':'
+    0b01110000,
+    0b11110000,
+    0b11110000,
+    0b01100000,
+    0b00000000,
+    0b00000000,
+    0b00000000,
+    0b00000000,
+    0b00000000,
+    0b00000000,
+    0b01100000,
+    0b11110000,
+    0b11110000,
+    0b01110000,
+    // U+003B ';'
+    0b01110000,
+    0b11110000,
+    0b11110000,
+    0b01110000,
+    0b00000000,
+    0b00000000,
+    0b00000000,
+    0b00000000,
+    0b00000000,
+    0b00000000,
+    0b01110000,
+    0b01110000,
+    0b01100000,
+    0b01100000,
+    0b11100000,
+    0b11100000,
+    0b11100000,
+    // U+003C '<'
+    0b00000000, 0b01000000,
+    0b00000001, 0b11100000,
+    0b00000011, 0b11000000,
+    0b00001111, 0b00000000,
+    0b00111100, 0b00000000,
+    0b11110000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11110000, 0b00000000,
+    0b01111100, 0b00000000,
+    0b00011110, 0b00000000,
+    0b00000111, 0b10000000,
+    0b00000001, 0b11100000,
+    0b00000000, 0b11100000,
+    // U+003D '='
+    0b11111111, 0b11000000,
+    0b11111111, 0b11100000,
+    0b00000000, 0b00000000,
+    0b00000000, 0b00000000,
+    0b00000000, 0b00000000,
+    0b00000000, 0b00000000,
+    0b11111111, 0b11000000,
+    0b11111111, 0b11100000,
+    // U+003E '>'
+    0b10000000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11111000, 0b00000000,
+    0b00111110, 0b00000000,
+    0b00001111, 0b10000000,
+    0b00000011, 0b11000000,
+    0b00000000, 0b11100000,
+    0b00000001, 0b11100000,
+    0b00000111, 0b11000000,
+    0b00011111, 0b00000000,
+    0b01111100, 0b00000000,
+    0b11110000, 0b00000000,
+    0b11000000, 0b00000000,
+    // U+003F '?'
+    0b11111100, 0b00000000,
+    0b11111111, 0b00000000,
+    0b00000111, 0b00000000,
+    0b00000011, 0b10000000,
+    0b00000011, 0b10000000,
+    0b00000011, 0b10000000,
+    0b00000011, 0b10000000,
+    0b00000111, 0b00000000,
+    0b00111111, 0b00000000,
+    0b00111110, 0b00000000,
+    0b00110000, 0b00000000,
+    0b00110000, 0b00000000,
+    0b00110000, 0b00000000,
+    0b00000000, 0b00000000,
+    0b00000000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b01111000, 0b00000000,
+    0b00111000, 0b00000000,
+    // U+0040 '@'
+    0b00011111, 0b11000000,
+    0b00111111, 0b11100000,
+    0b01110000, 0b01110000,
+    0b01100000, 0b00110000,
+    0b11100000, 0b00110000,
+    0b11000000, 0b00111000,
+    0b11000011, 0b11111000,
+    0b11000111, 0b11111000,
+    0b11000110, 0b00111000,
+    0b11000110, 0b00111000,
+    0b11000110, 0b00111000,
+    0b11000110, 0b00111000,
+    0b11000110, 0b00111000,
+    0b11000110, 0b00110000,
+    0b11000111, 0b11110000,
+    0b11000011, 0b11100000,
+    0b11000000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b01100000, 0b00000000,
+    0b01110000, 0b00000000,
+    0b00111111, 0b10000000,
+    // U+0041 'A'
+    0b00000111, 0b00000000,
+    0b00001111, 0b00000000,
+    0b00001111, 0b00000000,
+    0b00001111, 0b10000000,
+    0b00001101, 0b10000000,
+    0b00011101, 0b10000000,
+    0b00011001, 0b10000000,
+    0b00011001, 0b11000000,
+    0b00011000, 0b11000000,
+    0b00111000, 0b11000000,
+    0b00110000, 0b11000000,
+    0b00111111, 0b11100000,
+    0b01111111, 0b11100000,
+    0b01110000, 0b01100000,
+    0b01100000, 0b01100000,
+    0b01100000, 0b01110000,
+    0b11100000, 0b00110000,
+    0b11100000, 0b00110000,
+    // U+0042 'B'
+    0b11111111, 0b00000000,
+    0b11111111, 0b10000000,
+    0b11000001, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000011, 0b10000000,
+    0b11111111, 0b00000000,
+    0b11111111, 0b10000000,
+    0b11000001, 0b11000000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000001, 0b11000000,
+    0b11111111, 0b11000000,
+    0b11111111, 0b00000000,
+    // U+0043 'C'
+    0b00111111, 0b00000000,
+    0b01111111, 0b10000000,
+    0b01110001, 0b11000000,
+    0b11100000, 0b11100000,
+    0b11100000, 0b11100000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11100000, 0b11100000,
+    0b11100000, 0b11100000,
+    0b01110001, 0b11000000,
+    0b01111111, 0b10000000,
+    0b00111111, 0b00000000,
+    // U+0044 'D'
+    0b11111111, 0b00000000,
+    0b11111111, 0b10000000,
+    0b11000001, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000011, 0b11000000,
+    0b11111111, 0b10000000,
+    0b11111111, 0b00000000,
+    // U+0045 'E'
+    0b11111111, 0b11100000,
+    0b11111111, 0b11100000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11111111, 0b11000000,
+    0b11111111, 0b11000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11111111, 0b11100000,
+    0b11111111, 0b11100000,
+    // U+0046 'F'
+    0b11111111, 0b11100000,
+    0b11111111, 0b11100000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11111111, 0b11000000,
+    0b11111111, 0b11000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    // U+0047 'G'
+    0b00111111, 0b00000000,
+    0b01111111, 0b10000000,
+    0b01110001, 0b11000000,
+    0b11100000, 0b11000000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000111, 0b11100000,
+    0b11000111, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11100000, 0b11000000,
+    0b01110001, 0b11000000,
+    0b01111111, 0b10000000,
+    0b00111111, 0b00000000,
+    // U+0048 'H'
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11111111, 0b11000000,
+    0b11111111, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    // U+0049 'I'
+    0b11111111, 0b11000000,
+    0b11111111, 0b11000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b11111111, 0b11000000,
+    0b11111111, 0b11000000,
+    // U+004A 'J'
+    0b00000000, 0b01100000,
+    0b00000000, 0b01100000,
+    0b00000000, 0b01100000,
+    0b00000000, 0b01100000,
+    0b00000000, 0b01100000,
+    0b00000000, 0b01100000,
+    0b00000000, 0b01100000,
+    0b00000000, 0b01100000,
+    0b00000000, 0b01100000,
+    0b00000000, 0b01100000,
+    0b00000000, 0b01100000,
+    0b00000000, 0b01100000,
+    0b01000000, 0b01100000,
+    0b11100000, 0b01100000,
+    0b11100000, 0b11100000,
+    0b01110001, 0b11000000,
+    0b01111111, 0b11000000,
+    0b00011111, 0b00000000,
+    // U+004B 'K'
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11000001, 0b10000000,
+    0b11000011, 0b10000000,
+    0b11000011, 0b00000000,
+    0b11000111, 0b00000000,
+    0b11111110, 0b00000000,
+    0b11111110, 0b00000000,
+    0b11000111, 0b00000000,
+    0b11000011, 0b00000000,
+    0b11000011, 0b10000000,
+    0b11000001, 0b10000000,
+    0b11000001, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b01100000,
+    // U+004C 'L'
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11111111, 0b11000000,
+    0b11111111, 0b11000000,
+    // U+004D 'M'
+    0b11100001, 0b11100000,
+    0b11100001, 0b11100000,
+    0b11110001, 0b11100000,
+    0b11110011, 0b11100000,
+    0b11110011, 0b01100000,
+    0b11011011, 0b11100000,
+    0b11011110, 0b11100000,
+    0b11011110, 0b11100000,
+    0b11001110, 0b11100000,
+    0b11001100, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    // U+004E 'N'
+    0b11100000, 0b11000000,
+    0b11110000, 0b11000000,
+    0b11110000, 0b11000000,
+    0b11110000, 0b11000000,
+    0b11111000, 0b11000000,
+    0b11011000, 0b11000000,
+    0b11011000, 0b11000000,
+    0b11001100, 0b11000000,
+    0b11001100, 0b11000000,
+    0b11001100, 0b11000000,
+    0b11000110, 0b11000000,
+    0b11000110, 0b11000000,
+    0b11000111, 0b11000000,
+    0b11000011, 0b11000000,
+    0b11000011, 0b11000000,
+    0b11000011, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11000001, 0b11000000,
+    // U+004F 'O'
+    0b00111111, 0b00000000,
+    0b01111111, 0b10000000,
+    0b01100001, 0b11000000,
+    0b11100000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11100000, 0b11000000,
+    0b01100001, 0b11000000,
+    0b01111111, 0b10000000,
+    0b00111111, 0b00000000,
+    // U+0050 'P'
+    0b11111111, 0b10000000,
+    0b11111111, 0b11000000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b01100000,
+    0b11000000, 0b01100000,
+    0b11000000, 0b01100000,
+    0b11000000, 0b01100000,
+    0b11000000, 0b11100000,
+    0b11111111, 0b11000000,
+    0b11111111, 0b10000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    // U+0051 'Q'
+    0b00111111, 0b00000000,
+    0b01111111, 0b10000000,
+    0b11100001, 0b11000000,
+    0b11100000, 0b11000000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11000000,
+    0b11100000, 0b11000000,
+    0b11100001, 0b11000000,
+    0b01111111, 0b10000000,
+    0b00111111, 0b00000000,
+    0b00000011, 0b10000000,
+    0b00000011, 0b10000000,
+    0b00000001, 0b11000000,
+    // U+0052 'R'
+    0b11111111, 0b00000000,
+    0b11111111, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000001, 0b11000000,
+    0b11111111, 0b11000000,
+    0b11111111, 0b00000000,
+    0b11000111, 0b00000000,
+    0b11000011, 0b00000000,
+    0b11000011, 0b10000000,
+    0b11000001, 0b10000000,
+    0b11000001, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    // U+0053 'S'
+    0b00111111, 0b00000000,
+    0b01111111, 0b10000000,
+    0b01100001, 0b11000000,
+    0b11100000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b01111000, 0b00000000,
+    0b00111111, 0b00000000,
+    0b00001111, 0b10000000,
+    0b00000001, 0b11000000,
+    0b00000000, 0b11100000,
+    0b00000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11100001, 0b11000000,
+    0b01111111, 0b11000000,
+    0b00111111, 0b00000000,
+    // U+0054 'T'
+    0b11111111, 0b11110000,
+    0b11111111, 0b11110000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    // U+0055 'U'
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11100000, 0b11000000,
+    0b01110001, 0b11000000,
+    0b01111111, 0b10000000,
+    0b00111111, 0b00000000,
+    // U+0056 'V'
+    0b11100000, 0b00110000,
+    0b11100000, 0b00110000,
+    0b01100000, 0b01110000,
+    0b01100000, 0b01100000,
+    0b01110000, 0b01100000,
+    0b01110000, 0b01100000,
+    0b00110000, 0b11100000,
+    0b00110000, 0b11000000,
+    0b00111000, 0b11000000,
+    0b00111000, 0b11000000,
+    0b00011001, 0b11000000,
+    0b00011001, 0b10000000,
+    0b00011101, 0b10000000,
+    0b00001101, 0b10000000,
+    0b00001111, 0b10000000,
+    0b00001111, 0b00000000,
+    0b00001111, 0b00000000,
+    0b00000111, 0b00000000,
+    // U+0057 'W'
+    0b11100011, 0b10001100,
+    0b01100011, 0b10001100,
+    0b01100011, 0b10001100,
+    0b01100111, 0b10011100,
+    0b01100111, 0b10011100,
+    0b01100111, 0b10011000,
+    0b01100110, 0b10011000,
+    0b01100110, 0b11011000,
+    0b01110110, 0b11011000,
+    0b01110110, 0b11011000,
+    0b00110100, 0b11011000,
+    0b00111100, 0b11011000,
+    0b00111100, 0b11111000,
+    0b00111100, 0b11110000,
+    0b00111100, 0b01110000,
+    0b00111100, 0b01110000,
+    0b00111100, 0b01110000,
+    0b00111000, 0b01110000,
+    // U+0058 'X'
+    0b11100000, 0b01110000,
+    0b01110000, 0b01100000,
+    0b01110000, 0b11100000,
+    0b00111000, 0b11000000,
+    0b00011001, 0b11000000,
+    0b00011101, 0b10000000,
+    0b00001111, 0b10000000,
+    0b00001111, 0b00000000,
+    0b00000111, 0b00000000,
+    0b00001111, 0b00000000,
+    0b00001111, 0b10000000,
+    0b00011101, 0b10000000,
+    0b00011001, 0b11000000,
+    0b00111000, 0b11000000,
+    0b00110000, 0b11100000,
+    0b01110000, 0b01100000,
+    0b01100000, 0b01110000,
+    0b11100000, 0b00110000,
+    // U+0059 'Y'
+    0b11000000, 0b00110000,
+    0b11100000, 0b00110000,
+    0b01100000, 0b01110000,
+    0b01110000, 0b01100000,
+    0b00110000, 0b11100000,
+    0b00111000, 0b11000000,
+    0b00011001, 0b11000000,
+    0b00011101, 0b10000000,
+    0b00001111, 0b10000000,
+    0b00001111, 0b00000000,
+    0b00000111, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    // U+005A 'Z'
+    0b11111111, 0b11000000,
+    0b11111111, 0b11000000,
+    0b00000000, 0b11000000,
+    0b00000001, 0b10000000,
+    0b00000011, 0b10000000,
+    0b00000011, 0b00000000,
+    0b00000111, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00011100, 0b00000000,
+    0b00111000, 0b00000000,
+    0b00110000, 0b00000000,
+    0b01110000, 0b00000000,
+    0b01100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11111111, 0b11100000,
+    0b11111111, 0b11100000,
+    // U+005B '['
+    0b11111100,
+    0b11111100,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11111100,
+    0b11111100,
+    // U+005C
+    0b11000000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b01100000, 0b00000000,
+    0b01110000, 0b00000000,
+    0b01110000, 0b00000000,
+    0b00110000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b00011000, 0b00000000,
+    0b00011000, 0b00000000,
+    0b00011100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000111, 0b00000000,
+    0b00000111, 0b00000000,
+    0b00000011, 0b00000000,
+    0b00000011, 0b10000000,
+    0b00000001, 0b10000000,
+    0b00000001, 0b10000000,
+    0b00000001, 0b11000000,
+    0b00000000, 0b11000000,
+    0b00000000, 0b11100000,
+    // U+005D ']'
+    0b11111110,
+    0b11111110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b00001110,
+    0b11111110,
+    0b11111110,
+    // U+005E '^'
+    0b00001110, 0b00000000,
+    0b00011110, 0b00000000,
+    0b00011110, 0b00000000,
+    0b00011011, 0b00000000,
+    0b00110011, 0b00000000,
+    0b00110011, 0b10000000,
+    0b01110001, 0b10000000,
+    0b01100001, 0b11000000,
+    0b11100000, 0b11000000,
+    0b11000000, 0b11000000,
+    // U+005F '_'
+    0b11111111, 0b11110000,
+    0b11111111, 0b11110000,
+    // U+0060 '`'
+    0b11000000,
+    0b01100000,
+    0b01110000,
+    0b00111000,
+    // U+0061 'a'
+    0b00111111, 0b00000000,
+    0b01111111, 0b10000000,
+    0b11100001, 0b11000000,
+    0b11000000, 0b11000000,
+    0b00000000, 0b11000000,
+    0b00111111, 0b11000000,
+    0b01111111, 0b11000000,
+    0b11100000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11100001, 0b11000000,
+    0b11111111, 0b11000000,
+    0b01111110, 0b11000000,
+    // U+0062 'b'
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11011111, 0b00000000,
+    0b11111111, 0b10000000,
+    0b11110001, 0b11000000,
+    0b11100000, 0b11000000,
+    0b11100000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11100000, 0b11000000,
+    0b11100000, 0b11000000,
+    0b11110001, 0b11000000,
+    0b11111111, 0b10000000,
+    0b11011111, 0b00000000,
+    // U+0063 'c'
+    0b00111111, 0b00000000,
+    0b01111111, 0b11000000,
+    0b01110001, 0b11000000,
+    0b11100000, 0b11100000,
+    0b11100000, 0b11100000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11100000, 0b11100000,
+    0b11100000, 0b11100000,
+    0b01110001, 0b11000000,
+    0b01111111, 0b11000000,
+    0b00111111, 0b00000000,
+    // U+0064 'd'
+    0b00000000, 0b11000000,
+    0b00000000, 0b11000000,
+    0b00000000, 0b11000000,
+    0b00000000, 0b11000000,
+    0b00111110, 0b11000000,
+    0b01111111, 0b11000000,
+    0b11100001, 0b11000000,
+    0b11100000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11100000, 0b11000000,
+    0b11100001, 0b11000000,
+    0b01111111, 0b11000000,
+    0b00111110, 0b11000000,
+    // U+0065 'e'
+    0b00111111, 0b00000000,
+    0b01111111, 0b10000000,
+    0b01100001, 0b11000000,
+    0b11100000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11111111, 0b11000000,
+    0b11111111, 0b11000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11100000, 0b11000000,
+    0b01100001, 0b11000000,
+    0b01111111, 0b10000000,
+    0b00111111, 0b00000000,
+    // U+0066 'f'
+    0b00000111, 0b11110000,
+    0b00000111, 0b11110000,
+    0b00001110, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b11111111, 0b11110000,
+    0b11111111, 0b11110000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    // U+0067 'g'
+    0b00111110, 0b11000000,
+    0b01111111, 0b11000000,
+    0b11100001, 0b11000000,
+    0b11100000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11100001, 0b11000000,
+    0b01110011, 0b11000000,
+    0b01111111, 0b11000000,
+    0b00011100, 0b11000000,
+    0b00000000, 0b11000000,
+    0b00000000, 0b11000000,
+    0b00000001, 0b11000000,
+    0b00111111, 0b10000000,
+    // U+0068 'h'
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11011111, 0b00000000,
+    0b11111111, 0b10000000,
+    0b11110001, 0b11000000,
+    0b11100000, 0b11000000,
+    0b11100000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    // U+0069 'i'
+    0b00001110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00000000, 0b00000000,
+    0b00000000, 0b00000000,
+    0b11111110, 0b00000000,
+    0b11111110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b11111111, 0b11100000,
+    0b11111111, 0b11100000,
+    // U+006A 'j'
+    0b00000011, 0b10000000,
+    0b00000111, 0b10000000,
+    0b00000011, 0b10000000,
+    0b00000000, 0b00000000,
+    0b00000000, 0b00000000,
+    0b00000000, 0b00000000,
+    0b11111111, 0b10000000,
+    0b11111111, 0b10000000,
+    0b00000011, 0b10000000,
+    0b00000011, 0b10000000,
+    0b00000011, 0b10000000,
+    0b00000011, 0b10000000,
+    0b00000011, 0b10000000,
+    0b00000011, 0b10000000,
+    0b00000011, 0b10000000,
+    0b00000011, 0b10000000,
+    0b00000011, 0b10000000,
+    0b00000011, 0b10000000,
+    0b00000011, 0b10000000,
+    0b00000011, 0b10000000,
+    0b00000011, 0b00000000,
+    0b00000111, 0b00000000,
+    0b11111110, 0b00000000,
+    // U+006B 'k'
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11100000, 0b11100000,
+    0b11100000, 0b11000000,
+    0b11100001, 0b11000000,
+    0b11100011, 0b10000000,
+    0b11100011, 0b00000000,
+    0b11100111, 0b00000000,
+    0b11111110, 0b00000000,
+    0b11111110, 0b00000000,
+    0b11100111, 0b00000000,
+    0b11100011, 0b10000000,
+    0b11100001, 0b10000000,
+    0b11100001, 0b11000000,
+    0b11100000, 0b11100000,
+    0b11100000, 0b11100000,
+    // U+006C 'l'
+    0b11111100, 0b00000000,
+    0b11111100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00000111, 0b11110000,
+    0b00000011, 0b11110000,
+    // U+006D 'm'
+    0b11111101, 0b11100000,
+    0b11111111, 0b11110000,
+    0b11100110, 0b00110000,
+    0b11100110, 0b00110000,
+    0b11100110, 0b00110000,
+    0b11100110, 0b00110000,
+    0b11100110, 0b00110000,
+    0b11100110, 0b00110000,
+    0b11100110, 0b00110000,
+    0b11100110, 0b00110000,
+    0b11100110, 0b00110000,
+    0b11100110, 0b00110000,
+    0b11100110, 0b00110000,
+    0b11100110, 0b00110000,
+    // U+006E 'n'
+    0b11011111, 0b00000000,
+    0b11111111, 0b10000000,
+    0b11110001, 0b11000000,
+    0b11100000, 0b11000000,
+    0b11100000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    // U+006F 'o'
+    0b00111111, 0b00000000,
+    0b01111111, 0b10000000,
+    0b01100001, 0b11000000,
+    0b11100000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11100000, 0b11000000,
+    0b01100001, 0b11000000,
+    0b01111111, 0b10000000,
+    0b00111111, 0b00000000,
+    // U+0070 'p'
+    0b11011111, 0b00000000,
+    0b11111111, 0b10000000,
+    0b11110001, 0b11000000,
+    0b11100000, 0b11000000,
+    0b11100000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11100000, 0b11000000,
+    0b11100000, 0b11000000,
+    0b11110001, 0b11000000,
+    0b11111111, 0b10000000,
+    0b11011111, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    // U+0071 'q'
+    0b00111110, 0b11000000,
+    0b01111111, 0b11000000,
+    0b11100001, 0b11000000,
+    0b11100000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11100000, 0b11000000,
+    0b11100001, 0b11000000,
+    0b01111111, 0b11000000,
+    0b00111110, 0b11000000,
+    0b00000000, 0b11000000,
+    0b00000000, 0b11000000,
+    0b00000000, 0b11000000,
+    // U+0072 'r'
+    0b11011111, 0b00000000,
+    0b11111111, 0b10000000,
+    0b11100001, 0b10000000,
+    0b11000001, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11000001, 0b11000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    0b11000000, 0b00000000,
+    // U+0073 's'
+    0b00111111, 0b00000000,
+    0b01111111, 0b11000000,
+    0b11100001, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11100000, 0b00000000,
+    0b11111000, 0b00000000,
+    0b01111111, 0b10000000,
+    0b00011111, 0b11000000,
+    0b00000000, 0b11000000,
+    0b00000000, 0b11100000,
+    0b11000000, 0b11100000,
+    0b11100000, 0b11000000,
+    0b01111111, 0b11000000,
+    0b00111111, 0b10000000,
+    // U+0074 't'
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b11111111, 0b11110000,
+    0b11111111, 0b11110000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001111, 0b11100000,
+    0b00000111, 0b11110000,
+    // U+0075 'u'
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11000000, 0b11000000,
+    0b11100000, 0b11000000,
+    0b11100000, 0b11000000,
+    0b01110001, 0b11000000,
+    0b01111111, 0b10000000,
+    0b00111111, 0b00000000,
+    // U+0076 'v'
+    0b11100000, 0b00110000,
+    0b01100000, 0b01110000,
+    0b01110000, 0b01100000,
+    0b01110000, 0b01100000,
+    0b00110000, 0b11100000,
+    0b00110000, 0b11000000,
+    0b00111000, 0b11000000,
+    0b00011001, 0b11000000,
+    0b00011001, 0b10000000,
+    0b00011101, 0b10000000,
+    0b00001111, 0b10000000,
+    0b00001111, 0b00000000,
+    0b00001111, 0b00000000,
+    0b00000111, 0b00000000,
+    // U+0077 'w'
+    0b11000110, 0b00011000,
+    0b11000111, 0b00111000,
+    0b11000111, 0b00110000,
+    0b11001111, 0b00110000,
+    0b11001111, 0b00110000,
+    0b11101101, 0b00110000,
+    0b01101101, 0b10110000,
+    0b01101101, 0b10110000,
+    0b01101001, 0b11100000,
+    0b01111001, 0b11100000,
+    0b01111001, 0b11100000,
+    0b01111001, 0b11100000,
+    0b00111000, 0b11100000,
+    0b00111000, 0b11100000,
+    // U+0078 'x'
+    0b01100000, 0b01110000,
+    0b01110000, 0b11100000,
+    0b00111000, 0b11000000,
+    0b00011001, 0b11000000,
+    0b00011101, 0b10000000,
+    0b00001111, 0b00000000,
+    0b00000111, 0b00000000,
+    0b00001111, 0b00000000,
+    0b00001111, 0b10000000,
+    0b00011101, 0b10000000,
+    0b00111001, 0b11000000,
+    0b00110000, 0b11100000,
+    0b01110000, 0b01100000,
+    0b11100000, 0b01110000,
+    // U+0079 'y'
+    0b11100000, 0b00110000,
+    0b01100000, 0b01110000,
+    0b01110000, 0b01100000,
+    0b00110000, 0b11100000,
+    0b00110000, 0b11100000,
+    0b00111000, 0b11000000,
+    0b00011001, 0b11000000,
+    0b00011101, 0b10000000,
+    0b00011101, 0b10000000,
+    0b00001111, 0b10000000,
+    0b00001111, 0b00000000,
+    0b00000111, 0b00000000,
+    0b00000111, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001100, 0b00000000,
+    // U+007A 'z'
+    0b11111111, 0b11000000,
+    0b11111111, 0b11000000,
+    0b00000001, 0b11000000,
+    0b00000011, 0b10000000,
+    0b00000011, 0b00000000,
+    0b00000111, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00011100, 0b00000000,
+    0b00011000, 0b00000000,
+    0b00111000, 0b00000000,
+    0b01110000, 0b00000000,
+    0b11100000, 0b00000000,
+    0b11111111, 0b11000000,
+    0b11111111, 0b11000000,
+    // U+007B '{'
+    0b00000001, 0b11000000,
+    0b00000111, 0b11000000,
+    0b00000111, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b11111100, 0b00000000,
+    0b11111100, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00001110, 0b00000000,
+    0b00000110, 0b00000000,
+    0b00000111, 0b11000000,
+    0b00000011, 0b11000000,
+    // U+007C '|'
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    0b11000000,
+    // U+007D '}'
+    0b11110000, 0b00000000,
+    0b11111000, 0b00000000,
+    0b00011100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00011100, 0b00000000,
+    0b00011100, 0b00000000,
+    0b00011100, 0b00000000,
+    0b00011000, 0b00000000,
+    0b00011000, 0b00000000,
+    0b00011100, 0b00000000,
+    0b00001111, 0b11100000,
+    0b00001111, 0b11100000,
+    0b00011100, 0b00000000,
+    0b00011000, 0b00000000,
+    0b00011000, 0b00000000,
+    0b00011000, 0b00000000,
+    0b00011100, 0b00000000,
+    0b00011100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00001100, 0b00000000,
+    0b00011100, 0b00000000,
+    0b11111000, 0b00000000,
+    0b11110000, 0b00000000,
+    // U+007E '~'
+    0b01111000, 0b01100000,
+    0b11111100, 0b01100000,
+    0b11001110, 0b11100000,
+    0b11000111, 0b11000000,
+    0b11000011, 0b11000000,
+    // fallback
+    0b11111111, 0b11110000,
+    0b10000000, 0b00010000,
+    0b10000000, 0b00010000,
+    0b10000000, 0b00010000,
+    0b10000000, 0b00010000,
+    0b10000000, 0b00010000,
+    0b10000000, 0b00010000,
+    0b10000000, 0b00010000,
+    0b10000000, 0b00010000,
+    0b10000000, 0b00010000,
+    0b10000000, 0b00010000,
+    0b10000000, 0b00010000,
+    0b10000000, 0b00010000,
+    0b10000000, 0b00010000,
+    0b10000000, 0b00010000,
+    0b10000000, 0b00010000,
+    0b11111111, 0b11110000,
+};
+
+static const Glyph __font_jetbrains_mono_16x24_glyphs[] = {
+    {     0,  0,  0,  0,  0, 16 }, // U+0020 ' '
+    {     0,  4, 18,  5,  3, 16 }, // U+0021 '!'
+    {    18,  8,  8,  3,  3, 16 }, // U+0022 '"'
+    {    26, 13, 18,  1,  3, 16 }, // U+0023 '#'
+    {    62, 11, 24,  2,  0, 16 }, // U+0024 '$'
+    {   110, 14, 18,  0,  3, 16 }, // U+0025 '%'
+    {   146, 15, 18,  0,  3, 16 }, // U+0026 '&'
+    {   182,  3,  8,  6,  3, 16 }, // U+0027 '''
+    {   190,  8, 24,  4,  0, 16 }, // U+0028 '('
+    {   214,  7, 24,  3,  0, 16 }, // U+0029 ')'
+    {   238, 12, 13,  1,  5, 16 }, // U+002A '*'
+    {   264, 12, 12,  1,  7, 16 }, // U+002B '+'
+    {   288,  4,  7,  5, 17, 16 }, // U+002C ','
+    {   295,  8,  2,  3, 12, 16 }, // U+002D '-'
+    {   297,  4,  4,  5, 17, 16 }, // U+002E '.'
+    {   301, 10, 24,  2,  0, 16 }, // U+002F '/'
+    {   349, 11, 18,  2,  3, 16 }, // U+0030 '0'
+    {   385, 11, 18,  2,  3, 16 }, // U+0031 '1'
+    {   421, 11, 18,  2,  3, 16 }, // U+0032 '2'
+    {   457, 10, 18,  2,  3, 16 }, // U+0033 '3'
+    {   493, 10, 18,  2,  3, 16 }, // U+0034 '4'
+    {   529, 11, 18,  2,  3, 16 }, // U+0035 '5'
+    {   565, 12, 18,  1,  3, 16 }, // U+0036 '6'
+    {   601, 11, 18,  2,  3, 16 }, // U+0037 '7'
+    {   637, 12, 18,  1,  3, 16 }, // U+0038 '8'
+    {   673, 12, 18,  1,  3, 16 }, // U+0039 '9'
+    {   709,  4, 14,  5,  7, 16 }, // U+003A ':'
+    {   723,  4, 17,  5,  7, 16 }, // U+003B ';'
+    {   740, 11, 13,  2,  6, 16 }, // U+003C '<'
+    {   766, 11,  8,  2,  9, 16 }, // U+003D '='
+    {   782, 11, 13,  2,  6, 16 }, // U+003E '>'
+    {   808,  9, 18,  3,  3, 16 }, // U+003F '?'
+    {   844, 13, 21,  1,  3, 16 }, // U+0040 '@'
+    {   886, 12, 18,  1,  3, 16 }, // U+0041 'A'
+    {   922, 11, 18,  2,  3, 16 }, // U+0042 'B'
+    {   958, 11, 18,  2,  3, 16 }, // U+0043 'C'
+    {   994, 10, 18,  2,  3, 16 }, // U+0044 'D'
+    {  1030, 11, 18,  2,  3, 16 }, // U+0045 'E'
+    {  1066, 11, 18,  2,  3, 16 }, // U+0046 'F'
+    {  1102, 11, 18,  2,  3, 16 }, // U+0047 'G'
+    {  1138, 10, 18,  2,  3, 16 }, // U+0048 'H'
+    {  1174, 10, 18,  2,  3, 16 }, // U+0049 'I'
+    {  1210, 11, 18,  1,  3, 16 }, // U+004A 'J'
+    {  1246, 11, 18,  2,  3, 16 }, // U+004B 'K'
+    {  1282, 10, 18,  3,  3, 16 }, // U+004C 'L'
+    {  1318, 11, 18,  2,  3, 16 }, // U+004D 'M'
+    {  1354, 10, 18,  2,  3, 16 }, // U+004E 'N'
+    {  1390, 10, 18,  2,  3, 16 }, // U+004F 'O'
+    {  1426, 11, 18,  2,  3, 16 }, // U+0050 'P'
+    {  1462, 11, 21,  2,  3, 16 }, // U+0051 'Q'
+    {  1504, 11, 18,  2,  3, 16 }, // U+0052 'R'
+    {  1540, 11, 18,  2,  3, 16 }, // U+0053 'S'
+    {  1576, 12, 18,  1,  3, 16 }, // U+0054 'T'
+    {  1612, 10, 18,  2,  3, 16 }, // U+0055 'U'
+    {  1648, 12, 18,  1,  3, 16 }, // U+0056 'V'
+    {  1684, 14, 18,  0,  3, 16 }, // U+0057 'W'
+    {  1720, 12, 18,  1,  3, 16 }, // U+0058 'X'
+    {  1756, 12, 18,  1,  3, 16 }, // U+0059 'Y'
+    {  1792, 11, 18,  2,  3, 16 }, // U+005A 'Z'
+    {  1828,  6, 24,  5,  0, 16 }, // U+005B '['
+    {  1852, 11, 24,  2,  0, 16 }, // U+005C
+    {  1900,  7, 24,  3,  0, 16 }, // U+005D ']'
+    {  1924, 10, 10,  2,  2, 16 }, // U+005E '^'
+    {  1944, 12,  2,  1, 21, 16 }, // U+005F '_'
+    {  1948,  5,  4,  4,  1, 16 }, // U+0060 '`'
+    {  1952, 10, 14,  2,  7, 16 }, // U+0061 'a'
+    {  1980, 10, 18,  2,  3, 16 }, // U+0062 'b'
+    {  2016, 11, 14,  2,  7, 16 }, // U+0063 'c'
+    {  2044, 10, 18,  2,  3, 16 }, // U+0064 'd'
+    {  2080, 10, 14,  2,  7, 16 }, // U+0065 'e'
+    {  2108, 12, 18,  1,  3, 16 }, // U+0066 'f'
+    {  2144, 10, 17,  2,  7, 16 }, // U+0067 'g'
+    {  2178, 10, 18,  2,  3, 16 }, // U+0068 'h'
+    {  2214, 11, 19,  2,  2, 16 }, // U+0069 'i'
+    {  2252,  9, 23,  2,  1, 16 }, // U+006A 'j'
+    {  2298, 11, 18,  2,  3, 16 }, // U+006B 'k'
+    {  2334, 12, 18,  1,  3, 16 }, // U+006C 'l'
+    {  2370, 12, 14,  1,  7, 16 }, // U+006D 'm'
+    {  2398, 10, 14,  2,  7, 16 }, // U+006E 'n'
+    {  2426, 10, 14,  2,  7, 16 }, // U+006F 'o'
+    {  2454, 10, 17,  2,  7, 16 }, // U+0070 'p'
+    {  2488, 10, 17,  2,  7, 16 }, // U+0071 'q'
+    {  2522, 10, 14,  3,  7, 16 }, // U+0072 'r'
+    {  2550, 11, 14,  2,  7, 16 }, // U+0073 's'
+    {  2578, 12, 18,  1,  3, 16 }, // U+0074 't'
+    {  2614, 10, 14,  2,  7, 16 }, // U+0075 'u'
+    {  2642, 12, 14,  1,  7, 16 }, // U+0076 'v'
+    {  2670, 13, 14,  1,  7, 16 }, // U+0077 'w'
+    {  2698, 12, 14,  1,  7, 16 }, // U+0078 'x'
+    {  2726, 12, 17,  1,  7, 16 }, // U+0079 'y'
+    {  2760, 10, 14,  2,  7, 16 }, // U+007A 'z'
+    {  2788, 10, 24,  2,  0, 16 }, // U+007B '{'
+    {  2836,  2, 24,  6,  0, 16 }, // U+007C '|'
+    {  2860, 11, 24,  2,  0, 16 }, // U+007D '}'
+    {  2908, 11,  5,  2, 10, 16 }, // U+007E '~'
+    {  2918, 12, 17,  2,  4, 16 }, // fallback
+};
+
+static const FontRange __font_jetbrains_mono_16x24_ranges[] = {
+    { 0x0020,  95,   0 },
 };
 
 Font font_jetbrains_mono_16x24 = {
-    .first_char = 0x20,
-    .num_chars = 95,
-    .char_width = 16,
-    .char_height = 24,
-    .size = sizeof(__font_jetbrains_mono_16x24),
+    .version = FONT_VERSION,
+    .encoding = FONT_ENCODING_RAW,
+    .line_height = 24,
+    .baseline = 21,
+    .num_glyphs = 96,
+    .num_ranges = 1,
+    .fallback = 95,
+    .size = sizeof(__font_jetbrains_mono_16x24_bitmap),
     .name = "Jetbrains Mono",
-    .font_array = __font_jetbrains_mono_16x24,
+    .ranges = __font_jetbrains_mono_16x24_ranges,
+    .glyphs = __font_jetbrains_mono_16x24_glyphs,
+    .bitmap = __font_jetbrains_mono_16x24_bitmap,
 };
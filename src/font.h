@@ -1,20 +1,99 @@
 #pragma once
 
+#include <stddef.h>
 #include <stdint.h>
 
 #ifndef ___FONT_H
 #define ___FONT_H
 
+// 4 added glyph encodings, 3 sparse code point ranges, 2 glyph-major bitmaps; 1 was a single bitmap strip
+#define FONT_VERSION 4
+
+// Glyph bitmaps stored as byte-padded rows
+#define FONT_ENCODING_RAW 0
+// Nibble run lengths over row deltas, decoded through glyph_cache.h
+#define FONT_ENCODING_RLE 1
+
+/**
+ * One glyph: a bitmap cropped to its ink bounds plus the metrics to place it.
+ *
+ * Decoded, the bitmap is `height` rows of (width + 7) / 8 bytes, MSB is the leftmost pixel, 1 = ink; `offset`
+ * is where the glyph's data starts in Font.bitmap. Glyphs without ink (space) have a zero width and height.
+ */
+typedef struct Glyph {
+    uint32_t offset;
+    uint8_t width;
+    uint8_t height;
+    // Ink bounds relative to the pen position at the top of the line
+    int8_t x_offset;
+    int8_t y_offset;
+    uint8_t advance;
+} Glyph;
+
+/**
+ * `count` consecutive code points from `first`, drawn with glyphs[glyph_index] onwards.
+ */
+typedef struct FontRange {
+    uint32_t first;
+    uint16_t count;
+    uint16_t glyph_index;
+} FontRange;
+
 typedef struct Font {
-    uint8_t first_char;
-    uint8_t num_chars;
-    uint8_t char_width;
-    uint8_t char_height;
-    uint16_t size;
+    uint8_t version;
+    uint8_t encoding;
+    uint8_t line_height;
+    // Distance from the top of the line to the baseline
+    uint8_t baseline;
+    uint16_t num_glyphs;
+    // Sorted by code point, not overlapping
+    uint16_t num_ranges;
+    // Glyph drawn for code points the font does not cover
+    uint16_t fallback;
+    uint32_t size;
     const char* name;
-    const uint8_t* font_array;
+    const FontRange* ranges;
+    const Glyph* glyphs;
+    const uint8_t* bitmap;
 } Font;
 
+/**
+ * Returns the glyph for code point `c`, or the fallback glyph when the font does not cover it.
+ *
+ * The first range (ASCII in the built-in fonts) is checked directly; the rest are binary searched.
+ */
+static inline const Glyph* font_get_glyph(const Font* font, uint32_t c)
+{
+    const FontRange* range = &font->ranges[0];
+
+    if (c - range->first < range->count) {
+        return &font->glyphs[range->glyph_index + c - range->first];
+    }
+
+    uint16_t low = 1;
+    uint16_t high = font->num_ranges;
+
+    while (low < high) {
+        uint16_t mid = (low + high) / 2;
+        range = &font->ranges[mid];
+
+        if (c < range->first) {
+            high = mid;
+        } else if (c - range->first >= range->count) {
+            low = mid + 1;
+        } else {
+            return &font->glyphs[range->glyph_index + c - range->first];
+        }
+    }
+
+    return &font->glyphs[font->fallback];
+}
+
+static inline size_t font_glyph_row_bytes(const Glyph* glyph)
+{
+    return (glyph->width + 7) / 8;
+}
+
 extern Font font_ubuntu_mono_16x24;
 extern Font font_jetbrains_mono_16x24;
 
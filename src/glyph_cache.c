@@ -0,0 +1,248 @@
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glyph_cache.h"
+
+// Power of two, at least GLYPH_CACHE_SLOTS so chains stay short
+#define GLYPH_CACHE_BUCKETS 64
+#define GLYPH_CACHE_NONE 0xff
+
+_Static_assert(GLYPH_CACHE_SLOTS < GLYPH_CACHE_NONE, "slot indices are 8-bit");
+
+/**
+ * Decoded glyphs of RLE-encoded fonts, looked up by glyph through a hash table and evicted least
+ * recently used first. Only the display task draws text, so the cache is not locked.
+ */
+typedef struct glyph_cache_slot {
+    // Glyph records are unique across fonts, so the pointer alone is the key
+    const Glyph* glyph;
+    uint8_t hash_next;
+    uint8_t lru_prev;
+    uint8_t lru_next;
+    uint8_t data[GLYPH_CACHE_SLOT_SIZE];
+} glyph_cache_slot;
+
+// Allocated on the first encoded glyph, so firmware with only raw fonts pays no DRAM
+static glyph_cache_slot* slots;
+static uint8_t* scratch;
+static uint8_t buckets[GLYPH_CACHE_BUCKETS];
+static uint8_t lru_head = GLYPH_CACHE_NONE;
+static uint8_t lru_tail = GLYPH_CACHE_NONE;
+static uint8_t used;
+static uint8_t limit = GLYPH_CACHE_SLOTS;
+static glyph_cache_stats stats;
+
+static inline uint8_t glyph_hash(const Glyph* glyph)
+{
+    // Glyph tables are 12-byte records, so the low address bits carry little information
+    uintptr_t key = (uintptr_t) glyph / sizeof(Glyph);
+
+    return (key ^ (key >> 6)) & (GLYPH_CACHE_BUCKETS - 1);
+}
+
+/**
+ * Sets `count` bits from bit `bit` of a row-major bitmap with `row_bytes` bytes per row.
+ */
+static void set_bits(uint8_t* out, size_t row_bytes, uint8_t width, uint32_t bit, uint32_t count)
+{
+    while (count > 0) {
+        uint8_t* row = out + bit / width * row_bytes;
+        uint8_t x = bit % width;
+        uint8_t n = count < (uint32_t) (width - x) ? count : width - x;
+
+        bit += n;
+        count -= n;
+
+        while (n > 0) {
+            uint8_t shift = x % 8;
+            uint8_t take = n < 8 - shift ? n : 8 - shift;
+
+            row[x / 8] |= (uint8_t) (0xff00 >> take) >> shift;
+            x += take;
+            n -= take;
+        }
+    }
+}
+
+/**
+ * Decodes an FONT_ENCODING_RLE glyph into `height` byte-padded rows.
+ *
+ * The stream is nibbles, high first: alternating runs of 0 and 1 bits over the glyph's rows, each run a sum
+ * of nibbles that ends at the first nibble below 15. The decoded rows are XOR deltas of the row above.
+ */
+static void decode_rle(const uint8_t* src, const Glyph* glyph, uint8_t* out)
+{
+    size_t row_bytes = font_glyph_row_bytes(glyph);
+    uint32_t total = (uint32_t) glyph->width * glyph->height;
+    uint32_t bit = 0;
+    uint32_t nibble = 0;
+    uint8_t ink = 0;
+
+    memset(out, 0, row_bytes * glyph->height);
+
+    while (bit < total) {
+        uint32_t run = 0;
+        uint8_t value;
+
+        do {
+            value = (src[nibble / 2] >> (nibble % 2 ? 0 : 4)) & 0x0f;
+            nibble++;
+            run += value;
+        } while (value == 15);
+
+        if (run > total - bit) {
+            run = total - bit;
+        }
+        if (ink) {
+            set_bits(out, row_bytes, glyph->width, bit, run);
+        }
+
+        bit += run;
+        ink = !ink;
+    }
+
+    for (uint16_t y = 1; y < glyph->height; y++) {
+        for (size_t i = 0; i < row_bytes; i++) {
+            out[y * row_bytes + i] ^= out[(y - 1) * row_bytes + i];
+        }
+    }
+}
+
+static void lru_unlink(uint8_t index)
+{
+    glyph_cache_slot* slot = &slots[index];
+
+    if (slot->lru_prev != GLYPH_CACHE_NONE) {
+        slots[slot->lru_prev].lru_next = slot->lru_next;
+    } else {
+        lru_head = slot->lru_next;
+    }
+    if (slot->lru_next != GLYPH_CACHE_NONE) {
+        slots[slot->lru_next].lru_prev = slot->lru_prev;
+    } else {
+        lru_tail = slot->lru_prev;
+    }
+}
+
+static void lru_push_front(uint8_t index)
+{
+    glyph_cache_slot* slot = &slots[index];
+
+    slot->lru_prev = GLYPH_CACHE_NONE;
+    slot->lru_next = lru_head;
+    if (lru_head != GLYPH_CACHE_NONE) {
+        slots[lru_head].lru_prev = index;
+    } else {
+        lru_tail = index;
+    }
+    lru_head = index;
+}
+
+static void hash_remove(uint8_t index)
+{
+    uint8_t* link = &buckets[glyph_hash(slots[index].glyph)];
+
+    while (*link != index) {
+        link = &slots[*link].hash_next;
+    }
+    *link = slots[index].hash_next;
+}
+
+void glyph_cache_clear()
+{
+    memset(buckets, GLYPH_CACHE_NONE, sizeof(buckets));
+    lru_head = GLYPH_CACHE_NONE;
+    lru_tail = GLYPH_CACHE_NONE;
+    used = 0;
+}
+
+void glyph_cache_set_limit(uint8_t new_limit)
+{
+    limit = new_limit > GLYPH_CACHE_SLOTS ? GLYPH_CACHE_SLOTS : new_limit;
+    glyph_cache_clear();
+}
+
+/**
+ * Returns the glyph's bitmap as byte-padded rows: straight from flash for raw fonts, decoded through the
+ * cache for RLE fonts. Returns NULL when an encoded glyph is larger than GLYPH_CACHE_SCRATCH_SIZE or the cache
+ * could not be allocated.
+ */
+const uint8_t* glyph_cache_bitmap(const Font* font, const Glyph* glyph)
+{
+    if (font->encoding == FONT_ENCODING_RAW || glyph->width == 0) {
+        return font->bitmap + glyph->offset;
+    }
+
+    size_t size = font_glyph_row_bytes(glyph) * glyph->height;
+    const uint8_t* src = font->bitmap + glyph->offset;
+
+    if (!slots) {
+        slots = malloc(GLYPH_CACHE_SLOTS * sizeof(glyph_cache_slot));
+        scratch = malloc(GLYPH_CACHE_SCRATCH_SIZE);
+        if (!slots || !scratch) {
+            free(slots);
+            free(scratch);
+            slots = NULL;
+            scratch = NULL;
+            return NULL;
+        }
+        glyph_cache_clear();
+    }
+
+    uint8_t* bucket = &buckets[glyph_hash(glyph)];
+
+    for (uint8_t index = *bucket; index != GLYPH_CACHE_NONE; index = slots[index].hash_next) {
+        if (slots[index].glyph == glyph) {
+            stats.hits++;
+            if (index != lru_head) {
+                lru_unlink(index);
+                lru_push_front(index);
+            }
+            return slots[index].data;
+        }
+    }
+
+    stats.misses++;
+
+    if (size > GLYPH_CACHE_SLOT_SIZE || limit == 0) {
+        if (size > GLYPH_CACHE_SCRATCH_SIZE) {
+            return NULL;
+        }
+        stats.uncached++;
+        decode_rle(src, glyph, scratch);
+        return scratch;
+    }
+
+    uint8_t index;
+
+    if (used < limit) {
+        index = used++;
+    } else {
+        index = lru_tail;
+        lru_unlink(index);
+        hash_remove(index);
+        stats.evictions++;
+    }
+
+    glyph_cache_slot* slot = &slots[index];
+    slot->glyph = glyph;
+    slot->hash_next = *bucket;
+    *bucket = index;
+    lru_push_front(index);
+
+    decode_rle(src, glyph, slot->data);
+
+    return slot->data;
+}
+
+void glyph_cache_get_stats(glyph_cache_stats* out)
+{
+    *out = stats;
+    out->memory_bytes = slots ? GLYPH_CACHE_SLOTS * sizeof(glyph_cache_slot) + GLYPH_CACHE_SCRATCH_SIZE : 0;
+}
+
+void glyph_cache_reset_stats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
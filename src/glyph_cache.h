@@ -0,0 +1,40 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "font.h"
+
+#ifndef ___GLYPH_CACHE_H
+#define ___GLYPH_CACHE_H
+
+// Decoded glyphs kept in DRAM; the active limit can be lowered at runtime
+#ifndef GLYPH_CACHE_SLOTS
+#define GLYPH_CACHE_SLOTS 32
+#endif
+
+// Decoded bytes per slot; 64 holds any glyph up to 16 x 32 or 24 x 21 pixels
+#ifndef GLYPH_CACHE_SLOT_SIZE
+#define GLYPH_CACHE_SLOT_SIZE 64
+#endif
+
+// Larger glyphs are decoded here on every draw; glyphs beyond this are not drawn
+#define GLYPH_CACHE_SCRATCH_SIZE 512
+
+typedef struct glyph_cache_stats {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+    // Misses for glyphs too large for a slot
+    uint32_t uncached;
+    // 0 until the first encoded glyph is drawn
+    uint32_t memory_bytes;
+} glyph_cache_stats;
+
+const uint8_t* glyph_cache_bitmap(const Font* font, const Glyph* glyph);
+void glyph_cache_set_limit(uint8_t limit);
+void glyph_cache_clear();
+
+void glyph_cache_get_stats(glyph_cache_stats* stats);
+void glyph_cache_reset_stats();
+
+#endif
@@ -1,20 +1,61 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/param.h>
+
 #include "esp_event.h"
 #include "esp_http_server.h"
 #include "esp_log.h"
 #include "cJSON.h"
 
+#include "benchmark.h"
+#include "display.h"
 #include "epaper.h"
+#include "metrics.h"
 #include "page/index.html.h"
-#include "font.h"
+#include "proto.h"
+#include "rle.h"
+#include "slots.h"
+
+#define HTTP_MAX_URI_HANDLERS 20
 
-#define MAX(a, b) ((a) > (b) ? (a) : (b))
+// Largest JSON request body accepted by /draw_batch
+#define HTTP_BATCH_MAX_BODY 16384
+// Binary bodies are received and parsed in chunks of this size
+#define HTTP_STREAM_CHUNK_SIZE 256
+// Longest a streamed command waits for room in the display queue
+#define HTTP_STREAM_SUBMIT_TIMEOUT_MS 5000
+// Longest /framebuffer waits for the display task to finish a refresh in progress
+#define HTTP_FRAMEBUFFER_LOCK_TIMEOUT_MS 30000
 
 static const char* TAG = "http.c";
 
-static void (*on_draw_text)(const char* text, int x, int y);
+/**
+ * Answers a queued display command without waiting for the refresh.
+ *
+ * The ticket is returned in the `X-Display-Ticket` header; 503 means the display queue is full.
+ */
+static esp_err_t send_display_ticket(httpd_req_t* req, uint32_t ticket)
+{
+    char ticket_str[11];
+
+    if (!ticket) {
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        httpd_resp_send(req, "Busy", HTTPD_RESP_USE_STRLEN);
+        return ESP_OK;
+    }
+
+    snprintf(ticket_str, sizeof(ticket_str), "%lu", (unsigned long) ticket);
+    httpd_resp_set_hdr(req, "X-Display-Ticket", ticket_str);
+
+    const char resp[] = "OK";
+    return httpd_resp_send(req, resp, HTTPD_RESP_USE_STRLEN);
+}
 
 static esp_err_t root_http_handler(httpd_req_t* req)
 {
+    metrics_count(METRICS_COUNTER_REQUESTS);
+
     httpd_resp_send(req, (const char*) index_html, index_html_len);
 
     ESP_LOGI(TAG, "root_http_handler");
@@ -24,39 +65,117 @@ static esp_err_t root_http_handler(httpd_req_t* req)
 
 static esp_err_t toggle_screen_color_http_handler(httpd_req_t* req)
 {
-    const char resp[] = "OK";
-    httpd_resp_send(req, resp, HTTPD_RESP_USE_STRLEN);
-
-    epaper_toggle_screen_color();
-    epaper_deep_sleep();
+    metrics_count(METRICS_COUNTER_REQUESTS);
 
     ESP_LOGI(TAG, "toggle_screen_color_http_handler");
 
-    return ESP_OK;
+    return send_display_ticket(req, display_toggle_screen_color());
 }
 
 static esp_err_t clear_screen_http_handler(httpd_req_t* req)
 {
-    const char resp[] = "OK";
-    httpd_resp_send(req, resp, HTTPD_RESP_USE_STRLEN);
-
-    epaper_clear_screen();
-    epaper_deep_sleep();
+    metrics_count(METRICS_COUNTER_REQUESTS);
 
     ESP_LOGI(TAG, "clear_screen_http_handler");
 
-    return ESP_OK;
+    return send_display_ticket(req, display_clear());
 }
 
 static esp_err_t dummy_screen_http_handler(httpd_req_t* req)
 {
-    const char resp[] = "OK";
-    httpd_resp_send(req, resp, HTTPD_RESP_USE_STRLEN);
+    metrics_count(METRICS_COUNTER_REQUESTS);
 
-    epaper_dummy_screen();
-    epaper_deep_sleep();
+    return send_display_ticket(req, display_dummy_screen());
+}
 
-    return ESP_OK;
+static bool is_binary_request(httpd_req_t* req)
+{
+    char content_type[32];
+
+    return httpd_req_get_hdr_value_str(req, "Content-Type", content_type, sizeof(content_type)) == ESP_OK
+        && strcmp(content_type, "application/octet-stream") == 0;
+}
+
+/**
+ * Parser context; the last command is held back so it can carry the refresh.
+ */
+typedef struct stream_ctx {
+    display_command pending;
+    bool has_pending;
+    bool dropped;
+    uint32_t ticket;
+} stream_ctx;
+
+static void stream_submit(stream_ctx* ctx, bool refresh)
+{
+    uint32_t ticket = display_submit_wait(&ctx->pending, refresh, HTTP_STREAM_SUBMIT_TIMEOUT_MS);
+
+    if (ticket) {
+        ctx->ticket = ticket;
+    } else {
+        ctx->dropped = true;
+    }
+}
+
+static void stream_on_command(const display_command* command, void* arg)
+{
+    stream_ctx* ctx = (stream_ctx*) arg;
+
+    if (ctx->has_pending) {
+        stream_submit(ctx, false);
+    }
+
+    ctx->pending = *command;
+    ctx->has_pending = true;
+}
+
+/**
+ * Handles a binary draw request (see proto.h), parsing each chunk as it is received.
+ *
+ * Needs no body-sized buffer and no heap; commands are queued as soon as they are complete.
+ */
+static esp_err_t draw_stream_http_handler(httpd_req_t* req)
+{
+    uint8_t chunk[HTTP_STREAM_CHUNK_SIZE];
+    size_t remaining = req->content_len;
+    stream_ctx ctx = { 0 };
+    proto_parser parser;
+
+    proto_parser_init(&parser, stream_on_command, &ctx);
+
+    while (remaining > 0) {
+        int ret = httpd_req_recv(req, (char*) chunk, MIN(remaining, sizeof(chunk)));
+        if (ret == HTTPD_SOCK_ERR_TIMEOUT) {
+            continue;
+        }
+        if (ret <= 0) {
+            return ESP_FAIL;
+        }
+        remaining -= ret;
+
+        if (!proto_parser_feed(&parser, chunk, ret)) {
+            break;
+        }
+    }
+
+    bool complete = proto_parser_finish(&parser);
+
+    // After an error the commands already parsed stay applied and go out with the next refresh
+    if (ctx.has_pending) {
+        stream_submit(&ctx, complete && !(parser.flags & PROTO_FLAG_NO_REFRESH));
+    }
+
+    ESP_LOGI(TAG, "draw_stream_http_handler: %lu command(s)", (unsigned long) parser.commands);
+
+    if (!complete || parser.commands == 0) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Malformed or empty command stream");
+        return ESP_FAIL;
+    }
+    if (ctx.dropped) {
+        return send_display_ticket(req, 0);
+    }
+
+    return send_display_ticket(req, ctx.ticket);
 }
 
 /**
@@ -71,21 +190,39 @@ static esp_err_t dummy_screen_http_handler(httpd_req_t* req)
  *   "y": 20
  * }
  * ```
+ *
+ * With "w" and "h" the text is wrapped inside that box, see proto_parse_json_text() for the layout keys:
+ *
+ * ```json
+ * { "text": "A longer message", "x": 20, "y": 20, "w": 300, "h": 100, "align": "center", "ellipsis": true }
+ * ```
  */
 static esp_err_t draw_text_http_handler(httpd_req_t* req)
 {
     static char content[4096];
 
-    memset(content, 0, sizeof(content));
+    metrics_count(METRICS_COUNTER_REQUESTS);
+
+    if (is_binary_request(req)) {
+        return draw_stream_http_handler(req);
+    }
 
     int content_length = req->content_len;
-    if (content_length <= 0) {
+    if (content_length <= 0 || content_length >= sizeof(content)) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Missing or oversized body");
         return ESP_FAIL;
     }
 
-    int received = httpd_req_recv(req, content, MAX(content_length, sizeof(content)));
-    if (received != content_length) {
-        return ESP_FAIL;
+    int received = 0;
+    while (received < content_length) {
+        int ret = httpd_req_recv(req, content + received, content_length - received);
+        if (ret == HTTPD_SOCK_ERR_TIMEOUT) {
+            continue;
+        }
+        if (ret <= 0) {
+            return ESP_FAIL;
+        }
+        received += ret;
     }
     content[content_length] = '\0';
 
@@ -107,33 +244,581 @@ static esp_err_t draw_text_http_handler(httpd_req_t* req)
     }
 
     ESP_LOGI(TAG, "draw_text_http_handler: %s, %d, %d", text_json->valuestring, x_json->valueint, y_json->valueint);
-    on_draw_text(text_json->valuestring, x_json->valueint, y_json->valueint);
+    display_command command = { 0 };
+    proto_parse_json_text(root, &command);
+    uint32_t ticket = display_submit(&command);
 
     cJSON_Delete(root);
 
-    const char resp[] = "OK";
-    httpd_resp_send(req, resp, HTTPD_RESP_USE_STRLEN);
+    return send_display_ticket(req, ticket);
+}
 
-    return ESP_OK;
+/**
+ * Reads the whole request body into a NUL-terminated heap buffer; the caller frees it.
+ */
+static char* http_recv_body(httpd_req_t* req, size_t max_length)
+{
+    size_t content_length = req->content_len;
+    size_t received = 0;
+
+    if (content_length == 0 || content_length > max_length) {
+        return NULL;
+    }
+
+    char* content = malloc(content_length + 1);
+    if (!content) {
+        return NULL;
+    }
+
+    while (received < content_length) {
+        int ret = httpd_req_recv(req, content + received, content_length - received);
+        if (ret == HTTPD_SOCK_ERR_TIMEOUT) {
+            continue;
+        }
+        if (ret <= 0) {
+            free(content);
+            return NULL;
+        }
+        received += ret;
+    }
+    content[content_length] = '\0';
+
+    return content;
+}
+
+/**
+ * Applies an ordered list of operations with a single refresh.
+ *
+ * Example JSON Body:
+ *
+ * ```json
+ * {
+ *   "refresh": true,
+ *   "ops": [
+ *     { "op": "clear" },
+ *     { "op": "color", "color": "white" },
+ *     { "op": "text", "text": "Hello, World!", "x": 20, "y": 20 },
+ *     { "op": "text", "text": "Wrapped to the box", "x": 20, "y": 80, "w": 200, "h": 48, "align": "right" },
+ *     { "op": "line", "x1": 20, "y1": 50, "x2": 300, "y2": 50, "color": 0 },
+ *     { "op": "run", "x": 20, "y": 60, "length": 100, "color": 0 },
+ *     { "op": "fill", "x": 400, "y": 20, "w": 100, "h": 40, "color": 2 },
+ *     { "op": "bitmap", "x": 520, "y": 20, "w": 8, "h": 2, "data": "ff81", "color": 0 },
+ *     { "op": "text", "id": 7, "text": "12:00", "x": 600, "y": 20 },
+ *     { "op": "rect", "x": 20, "y": 300, "w": 200, "h": 100, "r": 12, "width": 3 },
+ *     { "op": "circle", "x": 400, "y": 350, "r": 40, "fill": true, "color": 2 },
+ *     { "op": "polygon", "points": [[500, 400], [560, 300], [620, 400]] },
+ *     { "op": "line", "x1": 20, "y1": 450, "x2": 780, "y2": 420, "width": 4 }
+ *   ]
+ * }
+ * ```
+ *
+ * Pixel colors are 0 for black, 1 for white and 2 for red; text is drawn in black or red. Bitmap rows are
+ * (w + 7) / 8 hex-coded bytes, MSB first. Rectangles, rounded with "r", and circles are outlined "width" pixels
+ * wide unless "fill" is set; polygons are always filled. Drawing again with the same "id" replaces that item and
+ * redraws only its area; `{ "op": "remove", "id": 7 }` takes it off the screen. With `"refresh": false` the
+ * operations only change the framebuffer and reach the panel with the next refresh.
+ *
+ * Requests sent as `application/octet-stream` use the binary protocol instead.
+ */
+static esp_err_t draw_batch_http_handler(httpd_req_t* req)
+{
+    metrics_count(METRICS_COUNTER_REQUESTS);
+
+    if (is_binary_request(req)) {
+        return draw_stream_http_handler(req);
+    }
+
+    char* content = http_recv_body(req, HTTP_BATCH_MAX_BODY);
+    if (!content) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Missing or oversized body");
+        return ESP_FAIL;
+    }
+
+    cJSON* root = cJSON_Parse(content);
+    free(content);
+
+    const cJSON* ops_json = cJSON_GetObjectItem(root, "ops");
+    const cJSON* refresh_json = cJSON_GetObjectItem(root, "refresh");
+    int count = cJSON_IsArray(ops_json) ? cJSON_GetArraySize(ops_json) : 0;
+
+    if (count <= 0 || count > DISPLAY_BATCH_MAX_COMMANDS) {
+        cJSON_Delete(root);
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Expected a non-empty ops array of at most 128 entries");
+        return ESP_FAIL;
+    }
+
+    display_command* commands = malloc(count * sizeof(display_command));
+    if (!commands) {
+        cJSON_Delete(root);
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Out of memory");
+        return ESP_FAIL;
+    }
+
+    const cJSON* op_json;
+    int i = 0;
+
+    cJSON_ArrayForEach(op_json, ops_json)
+    {
+        if (!proto_parse_json_op(op_json, &commands[i])) {
+            free(commands);
+            cJSON_Delete(root);
+            httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid op");
+            return ESP_FAIL;
+        }
+        i++;
+    }
+
+    bool refresh = !cJSON_IsBool(refresh_json) || cJSON_IsTrue(refresh_json);
+    cJSON_Delete(root);
+
+    ESP_LOGI(TAG, "draw_batch_http_handler: %d op(s), refresh=%d", count, refresh);
+    uint32_t ticket = display_submit_batch(commands, count, refresh);
+
+    free(commands);
+
+    return send_display_ticket(req, ticket);
+}
+
+static void send_chunk_emit(const uint8_t* data, size_t length, void* ctx)
+{
+    httpd_resp_send_chunk((httpd_req_t*) ctx, (const char*) data, length);
+}
+
+#if !EPAPER_BANDED
+static int query_int(const char* query, const char* key, int fallback)
+{
+    char value[8];
+
+    if (httpd_query_key_value(query, key, value, sizeof(value)) != ESP_OK) {
+        return fallback;
+    }
+
+    return atoi(value);
 }
 
-void http_register_on_draw_text(void (*callback)(const char* text, int x, int y))
+static bool query_is_packbits(const char* query)
 {
-    on_draw_text = callback;
+    char value[16];
+
+    return httpd_query_key_value(query, "encoding", value, sizeof(value)) == ESP_OK && strcmp(value, "packbits") == 0;
+}
+
+/**
+ * Byte-aligned rectangle of the framebuffer, walked row segment by row segment.
+ */
+typedef struct frame_cursor {
+    uint8_t* buffer;
+    int x;
+    int y;
+    int w;
+    int h;
+    size_t row_bytes;
+    size_t offset;
+} frame_cursor;
+
+/**
+ * Reads the `x`, `y`, `w`, `h` query parameters; the default is the full screen.
+ */
+static bool frame_cursor_from_query(const char* query, frame_cursor* cursor)
+{
+    cursor->buffer = epaper_get_buffer();
+    cursor->x = query_int(query, "x", 0);
+    cursor->y = query_int(query, "y", 0);
+    cursor->w = query_int(query, "w", DISPLAY_WIDTH);
+    cursor->h = query_int(query, "h", DISPLAY_HEIGHT);
+    cursor->row_bytes = cursor->w / 8;
+    cursor->offset = 0;
+
+    return cursor->x >= 0 && cursor->y >= 0 && cursor->w > 0 && cursor->h > 0 && cursor->x % 8 == 0
+        && cursor->w % 8 == 0 && cursor->x + cursor->w <= DISPLAY_WIDTH && cursor->y + cursor->h <= DISPLAY_HEIGHT;
+}
+
+static size_t frame_cursor_size(const frame_cursor* cursor)
+{
+    return cursor->row_bytes * cursor->h;
+}
+
+/**
+ * Returns where the cursor points and how many bytes follow contiguously in the framebuffer.
+ */
+static uint8_t* frame_cursor_span(const frame_cursor* cursor, size_t* length)
+{
+    size_t row = cursor->offset / cursor->row_bytes;
+    size_t column = cursor->offset % cursor->row_bytes;
+
+    // Full-width rows are contiguous, so a span may cover many of them
+    if (cursor->row_bytes == DISPLAY_STRIDE) {
+        *length = frame_cursor_size(cursor) - cursor->offset;
+    } else {
+        *length = cursor->row_bytes - column;
+    }
+
+    return cursor->buffer + (cursor->y + row) * DISPLAY_STRIDE + cursor->x / 8 + column;
+}
+
+static void frame_cursor_write(const uint8_t* data, size_t length, void* ctx)
+{
+    frame_cursor* cursor = (frame_cursor*) ctx;
+
+    while (length > 0) {
+        size_t span;
+        uint8_t* dst = frame_cursor_span(cursor, &span);
+        size_t n = MIN(length, span);
+
+        memcpy(dst, data, n);
+        cursor->offset += n;
+        data += n;
+        length -= n;
+    }
+}
+
+static void frame_cursor_fill(uint8_t value, size_t length, void* ctx)
+{
+    frame_cursor* cursor = (frame_cursor*) ctx;
+
+    while (length > 0) {
+        size_t span;
+        uint8_t* dst = frame_cursor_span(cursor, &span);
+        size_t n = MIN(length, span);
+
+        memset(dst, value, n);
+        cursor->offset += n;
+        length -= n;
+    }
 }
 
-static void noop_draw_text(const char* text, int x, int y)
+/**
+ * Receives the body straight into the framebuffer; each httpd_req_recv() writes at its destination offset.
+ */
+static bool framebuffer_recv_raw(httpd_req_t* req, frame_cursor* cursor)
 {
-    ESP_LOGI(TAG, "noop_draw_text");
+    while (cursor->offset < frame_cursor_size(cursor)) {
+        size_t span;
+        uint8_t* dst = frame_cursor_span(cursor, &span);
+
+        int ret = httpd_req_recv(req, (char*) dst, span);
+        if (ret == HTTPD_SOCK_ERR_TIMEOUT) {
+            continue;
+        }
+        if (ret <= 0) {
+            return false;
+        }
+        cursor->offset += ret;
+    }
+
+    return true;
 }
 
+/**
+ * Receives a PackBits body in small chunks and decodes it into the framebuffer as it arrives.
+ */
+static bool framebuffer_recv_packbits(httpd_req_t* req, frame_cursor* cursor)
+{
+    uint8_t chunk[HTTP_STREAM_CHUNK_SIZE];
+    size_t remaining = req->content_len;
+    rle_sink sink = { .write = frame_cursor_write, .fill = frame_cursor_fill, .ctx = cursor };
+    rle_decoder decoder;
+
+    rle_decoder_init(&decoder, &sink, frame_cursor_size(cursor));
+
+    while (remaining > 0) {
+        int ret = httpd_req_recv(req, (char*) chunk, MIN(remaining, sizeof(chunk)));
+        if (ret == HTTPD_SOCK_ERR_TIMEOUT) {
+            continue;
+        }
+        if (ret <= 0 || !rle_decoder_feed(&decoder, chunk, ret)) {
+            return false;
+        }
+        remaining -= ret;
+    }
+
+    return rle_decoder_finish(&decoder);
+}
+
+/**
+ * Receives a 1-bit frame straight into the framebuffer and refreshes it.
+ *
+ * Query: `x`, `y`, `w`, `h` select a sub-rectangle (default: the full screen); `x` and `w` must be multiples of
+ * 8. `refresh=0` writes the framebuffer only. The frame is `h` rows of `w / 8` bytes, MSB first, 1 = white.
+ * With `encoding=packbits` the body is PackBits-coded (see rle.h) and decoded while it is received.
+ */
+static esp_err_t framebuffer_post_http_handler(httpd_req_t* req)
+{
+    char query[64] = "";
+    frame_cursor cursor;
+
+    metrics_count(METRICS_COUNTER_REQUESTS);
+
+    httpd_req_get_url_query_str(req, query, sizeof(query));
+
+    bool refresh = query_int(query, "refresh", 1) != 0;
+    bool packbits = query_is_packbits(query);
+
+    if (!frame_cursor_from_query(query, &cursor)) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid rectangle");
+        return ESP_FAIL;
+    }
+
+    if (!packbits && req->content_len != frame_cursor_size(&cursor)) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Body size does not match the rectangle");
+        return ESP_FAIL;
+    }
+
+    if (!display_lock_framebuffer(HTTP_FRAMEBUFFER_LOCK_TIMEOUT_MS)) {
+        return send_display_ticket(req, 0);
+    }
+
+    bool complete = packbits ? framebuffer_recv_packbits(req, &cursor) : framebuffer_recv_raw(req, &cursor);
+
+    // A partial upload still changed the rows it reached
+    if (cursor.offset > 0) {
+        int rows = MIN(cursor.h, (cursor.offset + cursor.row_bytes - 1) / cursor.row_bytes);
+
+        epaper_mark_damaged(cursor.x, cursor.y, cursor.w, rows);
+        display_mark_written(cursor.x, cursor.y, cursor.w, cursor.h);
+    }
+
+    display_unlock_framebuffer();
+
+    ESP_LOGI(TAG, "framebuffer_post_http_handler: x=%d y=%d w=%d h=%d, %u byte(s)%s", cursor.x, cursor.y, cursor.w,
+        cursor.h, (unsigned) cursor.offset, packbits ? " (packbits)" : "");
+
+    if (!complete) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Incomplete or malformed frame");
+        return ESP_FAIL;
+    }
+
+    if (!refresh) {
+        return httpd_resp_send(req, "OK", HTTPD_RESP_USE_STRLEN);
+    }
+
+    return send_display_ticket(req, display_refresh());
+}
+
+/**
+ * Sends the framebuffer, or the `x`, `y`, `w`, `h` sub-rectangle, in the upload format.
+ *
+ * `encoding=packbits` compresses it on the fly; raw rows are sent straight from the framebuffer.
+ */
+static esp_err_t framebuffer_get_http_handler(httpd_req_t* req)
+{
+    char query[64] = "";
+    frame_cursor cursor;
+
+    metrics_count(METRICS_COUNTER_REQUESTS);
+
+    httpd_req_get_url_query_str(req, query, sizeof(query));
+
+    bool packbits = query_is_packbits(query);
+
+    if (!frame_cursor_from_query(query, &cursor)) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid rectangle");
+        return ESP_FAIL;
+    }
+
+    if (!display_lock_framebuffer(HTTP_FRAMEBUFFER_LOCK_TIMEOUT_MS)) {
+        return send_display_ticket(req, 0);
+    }
+
+    httpd_resp_set_type(req, "application/octet-stream");
+
+    if (packbits) {
+        rle_encoder encoder;
+
+        rle_encoder_init(&encoder, send_chunk_emit, req);
+
+        while (cursor.offset < frame_cursor_size(&cursor)) {
+            size_t span;
+            const uint8_t* src = frame_cursor_span(&cursor, &span);
+
+            rle_encoder_feed(&encoder, src, span);
+            cursor.offset += span;
+        }
+
+        size_t encoded = rle_encoder_finish(&encoder);
+        ESP_LOGI(TAG, "framebuffer_get_http_handler: %u byte(s) packed to %u", (unsigned) frame_cursor_size(&cursor),
+            (unsigned) encoded);
+    } else {
+        while (cursor.offset < frame_cursor_size(&cursor)) {
+            size_t span;
+            const uint8_t* src = frame_cursor_span(&cursor, &span);
+
+            httpd_resp_send_chunk(req, (const char*) src, span);
+            cursor.offset += span;
+        }
+    }
+
+    display_unlock_framebuffer();
+
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+#else
+/**
+ * There is no framebuffer to upload to or download in banded mode.
+ */
+static esp_err_t framebuffer_banded_http_handler(httpd_req_t* req)
+{
+    metrics_count(METRICS_COUNTER_REQUESTS);
+
+    httpd_resp_send_err(req, HTTPD_501_METHOD_NOT_IMPLEMENTED, "No framebuffer in banded mode");
+    return ESP_FAIL;
+}
+#endif
+
+/**
+ * Sends the saved slots as JSON: name, saves so far, which planes are kept and the size of the display list.
+ */
+static esp_err_t slots_get_http_handler(httpd_req_t* req)
+{
+    slot_info slots[SLOTS_COUNT];
+    size_t count = slots_list(slots, SLOTS_COUNT);
+    char output[160 * SLOTS_COUNT];
+    int length = snprintf(output, sizeof(output), "{\"slots\": [");
+
+    metrics_count(METRICS_COUNTER_REQUESTS);
+
+    for (size_t i = 0; i < count; i++) {
+        length += snprintf(output + length, sizeof(output) - length,
+            "%s{\"name\": \"%s\", \"sequence\": %lu, \"black\": %s, \"red\": %s, \"scene_bytes\": %lu}",
+            i > 0 ? ", " : "", slots[i].name, (unsigned long) slots[i].sequence, slots[i].black ? "true" : "false",
+            slots[i].red ? "true" : "false", (unsigned long) slots[i].scene_size);
+    }
+
+    length += snprintf(output + length, sizeof(output) - length, "], \"capacity\": %d}\n", SLOTS_COUNT);
+
+    httpd_resp_set_type(req, "application/json");
+
+    return httpd_resp_send(req, output, length);
+}
+
+static bool slot_exists(const char* name)
+{
+    slot_info slots[SLOTS_COUNT];
+    size_t count = slots_list(slots, SLOTS_COUNT);
+
+    for (size_t i = 0; i < count; i++) {
+        if (strcmp(slots[i].name, name) == 0) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * POST /slots/save, /slots/show and /slots/delete with `name` in the query. Saving takes the screen as it is once
+ * the commands queued before are drawn; showing and deleting answer 404 for a slot that was never saved.
+ */
+static esp_err_t slots_post_http_handler(httpd_req_t* req)
+{
+    char query[64] = "";
+    char name[SLOTS_NAME_MAX_LEN + 1] = "";
+    const char* action = req->uri + strlen("/slots/");
+
+    metrics_count(METRICS_COUNTER_REQUESTS);
+
+    httpd_req_get_url_query_str(req, query, sizeof(query));
+
+    if (httpd_query_key_value(query, "name", name, sizeof(name)) != ESP_OK || !slots_name_valid(name)) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Expected a name of 1 to 15 letters, digits, - or _");
+        return ESP_FAIL;
+    }
+
+    if (strncmp(action, "save", 4) == 0) {
+        return send_display_ticket(req, display_save_slot(name));
+    }
+
+    if (!slot_exists(name)) {
+        httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "No such slot");
+        return ESP_FAIL;
+    }
+
+    if (strncmp(action, "show", 4) == 0) {
+        return send_display_ticket(req, display_show_slot(name));
+    }
+
+    return send_display_ticket(req, display_delete_slot(name));
+}
+
+#if EPAPER_METRICS
+/**
+ * Sends the phase histograms, counters and memory statistics of metrics.h in the Prometheus text format, or as
+ * JSON with `format=json`.
+ */
+static esp_err_t metrics_http_handler(httpd_req_t* req)
+{
+    char query[32] = "";
+    char format[8] = "";
+
+    metrics_count(METRICS_COUNTER_REQUESTS);
+
+    httpd_req_get_url_query_str(req, query, sizeof(query));
+    httpd_query_key_value(query, "format", format, sizeof(format));
+
+    bool json = strcmp(format, "json") == 0;
+
+    httpd_resp_set_type(req, json ? "application/json" : "text/plain; version=0.0.4");
+    metrics_write(json ? METRICS_FORMAT_JSON : METRICS_FORMAT_TEXT, send_chunk_emit, req);
+
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+#endif
+
+#if EPAPER_BENCHMARK && !EPAPER_BANDED
+/**
+ * Runs the workloads in benchmark.h and sends their results as CSV, or as JSON with `format=json`.
+ *
+ * Query: `ms` is the minimum time per workload. Drawing waits until the benchmark is done. The workloads draw
+ * into the framebuffer and send it to the controller without refreshing, so the framebuffer is put back
+ * afterwards and the panel keeps showing what it showed.
+ */
+static esp_err_t benchmark_http_handler(httpd_req_t* req)
+{
+    static benchmark_result results[BENCHMARK_WORKLOADS];
+    static char output[1536];
+    char query[64] = "";
+    char format[8] = "";
+
+    metrics_count(METRICS_COUNTER_REQUESTS);
+
+    httpd_req_get_url_query_str(req, query, sizeof(query));
+    httpd_query_key_value(query, "format", format, sizeof(format));
+
+    int min_time_ms = query_int(query, "ms", BENCHMARK_MIN_TIME_MS);
+    bool json = strcmp(format, "json") == 0;
+
+    if (!display_lock_framebuffer(HTTP_FRAMEBUFFER_LOCK_TIMEOUT_MS)) {
+        return send_display_ticket(req, 0);
+    }
+
+    epaper_snapshot snapshot;
+
+    if (!epaper_snapshot_take(&snapshot)) {
+        display_unlock_framebuffer();
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Out of memory");
+        return ESP_FAIL;
+    }
+
+    size_t count = benchmark_run(MAX(min_time_ms, 0), results, BENCHMARK_WORKLOADS);
+
+    epaper_snapshot_restore(&snapshot);
+    display_unlock_framebuffer();
+
+    size_t length = benchmark_format_results(results, count, json ? BENCHMARK_FORMAT_JSON : BENCHMARK_FORMAT_CSV,
+        output, sizeof(output));
+
+    httpd_resp_set_type(req, json ? "application/json" : "text/csv");
+
+    return httpd_resp_send(req, output, length);
+}
+#endif
+
 void http_server_init()
 {
     httpd_config_t config = HTTPD_DEFAULT_CONFIG();
+    config.max_uri_handlers = HTTP_MAX_URI_HANDLERS;
     httpd_handle_t server = NULL;
 
-    http_register_on_draw_text(noop_draw_text);
-
     if (httpd_start(&server, &config) == ESP_OK) {
         httpd_uri_t root_uri = {
             .uri = "/",
@@ -166,10 +851,93 @@ void http_server_init()
             .user_ctx = NULL
         };
 
+        httpd_uri_t draw_batch_uri = {
+            .uri = "/draw_batch",
+            .method = HTTP_POST,
+            .handler = draw_batch_http_handler,
+            .user_ctx = NULL
+        };
+
+        httpd_uri_t framebuffer_post_uri = {
+            .uri = "/framebuffer",
+            .method = HTTP_POST,
+#if EPAPER_BANDED
+            .handler = framebuffer_banded_http_handler,
+#else
+            .handler = framebuffer_post_http_handler,
+#endif
+            .user_ctx = NULL
+        };
+        httpd_uri_t framebuffer_get_uri = {
+            .uri = "/framebuffer",
+            .method = HTTP_GET,
+#if EPAPER_BANDED
+            .handler = framebuffer_banded_http_handler,
+#else
+            .handler = framebuffer_get_http_handler,
+#endif
+            .user_ctx = NULL
+        };
+
         httpd_register_uri_handler(server, &root_uri);
         httpd_register_uri_handler(server, &toggle_screen_color_uri);
         httpd_register_uri_handler(server, &clear_screen_uri);
         httpd_register_uri_handler(server, &dummy_screen_uri);
         httpd_register_uri_handler(server, &draw_text_uri);
+        httpd_register_uri_handler(server, &draw_batch_uri);
+        httpd_register_uri_handler(server, &framebuffer_post_uri);
+        httpd_register_uri_handler(server, &framebuffer_get_uri);
+
+        httpd_uri_t slots_get_uri = {
+            .uri = "/slots",
+            .method = HTTP_GET,
+            .handler = slots_get_http_handler,
+            .user_ctx = NULL
+        };
+        httpd_uri_t slots_save_uri = {
+            .uri = "/slots/save",
+            .method = HTTP_POST,
+            .handler = slots_post_http_handler,
+            .user_ctx = NULL
+        };
+        httpd_uri_t slots_show_uri = {
+            .uri = "/slots/show",
+            .method = HTTP_POST,
+            .handler = slots_post_http_handler,
+            .user_ctx = NULL
+        };
+        httpd_uri_t slots_delete_uri = {
+            .uri = "/slots/delete",
+            .method = HTTP_POST,
+            .handler = slots_post_http_handler,
+            .user_ctx = NULL
+        };
+
+        httpd_register_uri_handler(server, &slots_get_uri);
+        httpd_register_uri_handler(server, &slots_save_uri);
+        httpd_register_uri_handler(server, &slots_show_uri);
+        httpd_register_uri_handler(server, &slots_delete_uri);
+
+#if EPAPER_METRICS
+        httpd_uri_t metrics_uri = {
+            .uri = "/metrics",
+            .method = HTTP_GET,
+            .handler = metrics_http_handler,
+            .user_ctx = NULL
+        };
+
+        httpd_register_uri_handler(server, &metrics_uri);
+#endif
+
+#if EPAPER_BENCHMARK && !EPAPER_BANDED
+        httpd_uri_t benchmark_uri = {
+            .uri = "/benchmark",
+            .method = HTTP_GET,
+            .handler = benchmark_http_handler,
+            .user_ctx = NULL
+        };
+
+        httpd_register_uri_handler(server, &benchmark_uri);
+#endif
     }
 }
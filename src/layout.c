@@ -0,0 +1,259 @@
+#include "layout.h"
+#include "utf8.h"
+
+#define LAYOUT_ELLIPSIS_CHAR 0x2026
+
+typedef struct layout_state {
+    const Font* font;
+    const Rect* box;
+    const LayoutOptions* options;
+    layout_line_fn on_line;
+    void* ctx;
+    Rect* used;
+    int16_t line_pitch;
+    uint16_t max_lines;
+    uint16_t lines;
+    uint16_t ellipsis_width;
+    bool truncated;
+} layout_state;
+
+uint32_t layout_measure(const Font* font, const char* text, size_t length)
+{
+    const char* end = text + length;
+    uint32_t width = 0;
+    uint32_t c;
+
+    while (text < end && (c = utf8_next(&text)) != 0) {
+        width += font_get_glyph(font, c)->advance;
+    }
+
+    return width;
+}
+
+/**
+ * Returns the glyph to draw `count` times as the ellipsis: U+2026 when the font has it, '.' three times if not.
+ */
+const Glyph* layout_ellipsis_glyph(const Font* font, uint8_t* count)
+{
+    const Glyph* glyph = font_get_glyph(font, LAYOUT_ELLIPSIS_CHAR);
+
+    if (glyph != &font->glyphs[font->fallback]) {
+        *count = 1;
+        return glyph;
+    }
+
+    *count = 3;
+    return font_get_glyph(font, '.');
+}
+
+/**
+ * Cuts the line back until it fits next to the ellipsis, dropping trailing spaces. Only the one line is
+ * measured again.
+ */
+static void layout_ellipsize(const layout_state* state, LayoutLine* line)
+{
+    uint16_t box_width = state->box->w;
+
+    if (state->ellipsis_width > box_width) {
+        return;
+    }
+
+    uint16_t available = box_width - state->ellipsis_width;
+
+    if (line->width > available) {
+        const char* p = line->text;
+        const char* end = line->text + line->length;
+        const char* fit = line->text;
+        uint32_t width = 0;
+        uint32_t fit_width = 0;
+
+        while (p < end) {
+            uint32_t c = utf8_next(&p);
+            uint8_t advance = font_get_glyph(state->font, c)->advance;
+
+            if (width + advance > available) {
+                break;
+            }
+            width += advance;
+            if (c != ' ') {
+                fit = p;
+                fit_width = width;
+            }
+        }
+
+        line->length = fit - line->text;
+        line->width = fit_width;
+    }
+
+    line->width += state->ellipsis_width;
+    line->ellipsis = true;
+}
+
+/**
+ * Places the line [text, end) and hands it out. Returns false once the box is full and text is left over.
+ */
+static bool layout_emit(layout_state* state, const char* text, const char* end, uint32_t width, bool cut, bool more)
+{
+    if (state->lines >= state->max_lines) {
+        state->truncated = true;
+        return false;
+    }
+
+    const Rect* box = state->box;
+    bool last = state->lines + 1 == state->max_lines;
+    LayoutLine line = { .text = text, .length = end - text, .width = width };
+
+    if (cut || (more && last)) {
+        state->truncated = true;
+        if (state->options->flags & LAYOUT_ELLIPSIS) {
+            layout_ellipsize(state, &line);
+        }
+    }
+
+    uint16_t slack = line.width < box->w ? box->w - line.width : 0;
+
+    if (state->options->align == LAYOUT_ALIGN_CENTER) {
+        line.x = box->x + slack / 2;
+    } else if (state->options->align == LAYOUT_ALIGN_RIGHT) {
+        line.x = box->x + slack;
+    } else {
+        line.x = box->x;
+    }
+    line.y = box->y + state->lines * state->line_pitch;
+
+    if (line.width > 0) {
+        Rect rect = { .x = line.x, .y = line.y, .w = line.width, .h = state->font->line_height };
+
+        if (state->used->w == 0) {
+            *state->used = rect;
+        } else {
+            rect_union(state->used, &rect, state->used);
+        }
+    }
+
+    state->lines++;
+    state->on_line(&line, state->ctx);
+
+    return !(more && last);
+}
+
+/**
+ * Lays `text` out in `box` in one pass over the string and calls `on_line` for every line that fits.
+ *
+ * Lines break at '\n' and, with LAYOUT_WRAP, at the last space that keeps them inside the box, or inside a word
+ * wider than the box. Without LAYOUT_WRAP a line is cut at the last whole glyph that fits. Lines below the box
+ * are dropped; with LAYOUT_ELLIPSIS the last line shown, and every cut line, ends in an ellipsis.
+ *
+ * `used` receives the bounding box of everything placed. Returns false when text was cut or dropped.
+ */
+bool layout_text(const Font* font, const char* text, const Rect* box, const LayoutOptions* options,
+    layout_line_fn on_line, void* ctx, Rect* used)
+{
+    layout_state state = {
+        .font = font,
+        .box = box,
+        .options = options,
+        .on_line = on_line,
+        .ctx = ctx,
+        .used = used,
+        .line_pitch = font->line_height + options->line_spacing,
+    };
+    uint8_t ellipsis_count;
+    const Glyph* ellipsis = layout_ellipsis_glyph(font, &ellipsis_count);
+    bool wrap = options->flags & LAYOUT_WRAP;
+
+    *used = (Rect) { 0 };
+    state.ellipsis_width = ellipsis->advance * ellipsis_count;
+
+    if (state.line_pitch <= 0) {
+        state.line_pitch = 1;
+    }
+    if (box->h >= font->line_height && box->w > 0) {
+        state.max_lines = 1 + (box->h - font->line_height) / state.line_pitch;
+    }
+
+    const char* p = text;
+    const char* line_start = text;
+    // Just past the last non-space glyph of the line, and the width up to there
+    const char* content_end = text;
+    uint32_t content_width = 0;
+    uint32_t line_width = 0;
+    // Where the last run of spaces begins and ends, and the width after it
+    const char* break_start = NULL;
+    uint32_t break_width = 0;
+    const char* break_end = NULL;
+    uint32_t after_break_width = 0;
+    bool cut = false;
+
+    while (true) {
+        const char* start = p;
+        uint32_t c = utf8_next(&p);
+
+        if (c == 0 || c == '\n') {
+            if (!layout_emit(&state, line_start, content_end, content_width, cut, c != 0 && *p != 0)) {
+                return false;
+            }
+            if (c == 0) {
+                return !state.truncated;
+            }
+
+            line_start = content_end = p;
+            line_width = content_width = 0;
+            break_start = NULL;
+            cut = false;
+            continue;
+        }
+
+        if (cut || c == '\r') {
+            continue;
+        }
+
+        uint8_t advance = font_get_glyph(font, c)->advance;
+
+        if (c == ' ') {
+            // Trailing spaces may hang past the box; they are not drawn
+            if (content_end == start) {
+                break_start = content_end;
+                break_width = content_width;
+            }
+            break_end = p;
+            after_break_width = 0;
+            line_width += advance;
+            continue;
+        }
+
+        while (line_width + advance > box->w && start != line_start) {
+            if (!wrap) {
+                cut = true;
+                break;
+            }
+
+            if (break_start && break_start != line_start) {
+                // Wrap at the last space; the word so far moves to the next line
+                if (!layout_emit(&state, line_start, break_start, break_width, false, true)) {
+                    return false;
+                }
+                line_start = break_end;
+                line_width = content_width = after_break_width;
+                content_end = after_break_width > 0 ? start : line_start;
+            } else {
+                // No space to wrap at: break inside the word
+                if (!layout_emit(&state, line_start, content_end, content_width, false, true)) {
+                    return false;
+                }
+                line_start = content_end = start;
+                line_width = content_width = 0;
+            }
+            break_start = NULL;
+        }
+
+        if (cut) {
+            continue;
+        }
+
+        line_width += advance;
+        after_break_width += advance;
+        content_end = p;
+        content_width = line_width;
+    }
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "damage.h"
+#include "font.h"
+
+#ifndef ___LAYOUT_H
+#define ___LAYOUT_H
+
+#define LAYOUT_ALIGN_LEFT 0
+#define LAYOUT_ALIGN_CENTER 1
+#define LAYOUT_ALIGN_RIGHT 2
+
+// Break lines at spaces, or inside a word that is wider than the box; otherwise only at '\n'
+#define LAYOUT_WRAP 0x01
+// End the last line that fits with an ellipsis when text is cut off
+#define LAYOUT_ELLIPSIS 0x02
+
+typedef struct LayoutOptions {
+    uint8_t align;
+    uint8_t flags;
+    // Extra pixels between lines, may be negative
+    int8_t line_spacing;
+} LayoutOptions;
+
+/**
+ * One laid out line: `length` bytes of UTF-8 from `text`, drawn with the pen at (x, y), the top of the line.
+ * `width` includes the ellipsis when `ellipsis` is set; trailing spaces are not part of the line.
+ */
+typedef struct LayoutLine {
+    const char* text;
+    uint16_t length;
+    uint16_t x;
+    uint16_t y;
+    uint16_t width;
+    bool ellipsis;
+} LayoutLine;
+
+typedef void (*layout_line_fn)(const LayoutLine* line, void* ctx);
+
+uint32_t layout_measure(const Font* font, const char* text, size_t length);
+const Glyph* layout_ellipsis_glyph(const Font* font, uint8_t* count);
+bool layout_text(const Font* font, const char* text, const Rect* box, const LayoutOptions* options,
+    layout_line_fn on_line, void* ctx, Rect* used);
+
+#endif
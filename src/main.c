@@ -1,15 +1,25 @@
 #include "button.h"
-#include "epaper.h"
+#include "display.h"
 #include "http.h"
+#include "metrics.h"
 #include "wifi.h"
 
 void app_main(void)
 {
-    wifi_task_params wifi_params = {
+    // The Wi-Fi task reads these after app_main() has returned
+    static wifi_task_params wifi_params = {
         .on_init_success = http_server_init,
     };
-    wifi_create_task(&wifi_params, NULL);
-    button_create_task(NULL);
+    TaskHandle_t wifi_task = NULL;
+    TaskHandle_t button_task = NULL;
+    TaskHandle_t display_task = NULL;
 
-    epaper_setup();
+    wifi_create_task(&wifi_params, &wifi_task);
+    button_create_task(&button_task);
+
+    display_create_task(&display_task);
+
+    metrics_watch_task(wifi_task);
+    metrics_watch_task(button_task);
+    metrics_watch_task(display_task);
 }
@@ -0,0 +1,326 @@
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "esp_heap_caps.h"
+
+#include "display.h"
+#include "epaper.h"
+#include "glyph_cache.h"
+#include "metrics.h"
+#include "slots.h"
+
+#if EPAPER_METRICS
+
+// Output is formatted into this much memory at a time and handed to the emit function
+#define METRICS_WRITE_BUFFER_SIZE 512
+
+typedef struct metrics_writer {
+    char buffer[METRICS_WRITE_BUFFER_SIZE];
+    size_t length;
+    metrics_emit_fn emit;
+    void* ctx;
+} metrics_writer;
+
+static const char* const phase_names[METRICS_PHASE_COUNT] = { "init", "busy", "transmit", "refresh", "deep_sleep" };
+
+// Guards the histograms, which are read while the display task records; counters are atomic instead
+static portMUX_TYPE metrics_lock = portMUX_INITIALIZER_UNLOCKED;
+static metrics_histogram phases[METRICS_PHASE_COUNT];
+static uint32_t counters[METRICS_COUNTER_COUNT];
+static TaskHandle_t tasks[METRICS_MAX_TASKS];
+static uint8_t task_count;
+
+static inline uint8_t bucket_index(uint32_t duration_us)
+{
+    if (duration_us <= 1) {
+        return 0;
+    }
+
+    uint8_t index = 32 - __builtin_clz(duration_us - 1);
+
+    return index < METRICS_BUCKETS - 1 ? index : METRICS_BUCKETS - 1;
+}
+
+/**
+ * Adds the time since `start_us`, taken with metrics_now(), to the phase's histogram.
+ */
+void metrics_record(metrics_phase phase, int64_t start_us)
+{
+    metrics_histogram* histogram = &phases[phase];
+    uint32_t duration_us = (uint32_t) (esp_timer_get_time() - start_us);
+
+    taskENTER_CRITICAL(&metrics_lock);
+    histogram->count++;
+    histogram->buckets[bucket_index(duration_us)]++;
+    histogram->total_us += duration_us;
+    histogram->last_us = duration_us;
+    histogram->last_start_us = start_us;
+    if (duration_us > histogram->max_us) {
+        histogram->max_us = duration_us;
+    }
+    taskEXIT_CRITICAL(&metrics_lock);
+}
+
+void metrics_count(metrics_counter counter)
+{
+    __atomic_fetch_add(&counters[counter], 1, __ATOMIC_RELAXED);
+}
+
+/**
+ * Adds a task to the stack high-water marks that are reported; tasks must not be deleted afterwards.
+ */
+void metrics_watch_task(TaskHandle_t task)
+{
+    if (task && task_count < METRICS_MAX_TASKS) {
+        tasks[task_count++] = task;
+    }
+}
+
+void metrics_get_phase(metrics_phase phase, metrics_histogram* histogram)
+{
+    taskENTER_CRITICAL(&metrics_lock);
+    *histogram = phases[phase];
+    taskEXIT_CRITICAL(&metrics_lock);
+}
+
+uint32_t metrics_get_counter(metrics_counter counter)
+{
+    return __atomic_load_n(&counters[counter], __ATOMIC_RELAXED);
+}
+
+static void writer_flush(metrics_writer* writer)
+{
+    if (writer->length > 0) {
+        writer->emit((const uint8_t*) writer->buffer, writer->length, writer->ctx);
+        writer->length = 0;
+    }
+}
+
+/**
+ * Appends formatted text, flushing first when it does not fit; a single piece is at most a buffer long.
+ */
+static void writer_printf(metrics_writer* writer, const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+static void writer_printf(metrics_writer* writer, const char* format, ...)
+{
+    va_list args;
+
+    for (int attempt = 0; attempt < 2; attempt++) {
+        size_t space = sizeof(writer->buffer) - writer->length;
+
+        va_start(args, format);
+        int ret = vsnprintf(writer->buffer + writer->length, space, format, args);
+        va_end(args);
+
+        if (ret >= 0 && (size_t) ret < space) {
+            writer->length += ret;
+            return;
+        }
+
+        writer_flush(writer);
+    }
+}
+
+/**
+ * Prometheus text format: cumulative buckets up to 2^i us, then "+Inf".
+ */
+static void write_phases_text(metrics_writer* writer)
+{
+    writer_printf(writer, "# TYPE epaper_phase_us histogram\n");
+
+    for (int phase = 0; phase < METRICS_PHASE_COUNT; phase++) {
+        metrics_histogram histogram;
+        const char* name = phase_names[phase];
+        uint32_t cumulative = 0;
+
+        metrics_get_phase(phase, &histogram);
+
+        for (int i = 0; i < METRICS_BUCKETS - 1; i++) {
+            cumulative += histogram.buckets[i];
+            writer_printf(writer, "epaper_phase_us_bucket{phase=\"%s\",le=\"%lu\"} %lu\n", name, 1UL << i,
+                (unsigned long) cumulative);
+        }
+        writer_printf(writer, "epaper_phase_us_bucket{phase=\"%s\",le=\"+Inf\"} %lu\n", name,
+            (unsigned long) histogram.count);
+        writer_printf(writer, "epaper_phase_us_sum{phase=\"%s\"} %llu\n", name,
+            (unsigned long long) histogram.total_us);
+        writer_printf(writer, "epaper_phase_us_count{phase=\"%s\"} %lu\n", name, (unsigned long) histogram.count);
+        writer_printf(writer, "epaper_phase_max_us{phase=\"%s\"} %lu\n", name, (unsigned long) histogram.max_us);
+        writer_printf(writer, "epaper_phase_last_us{phase=\"%s\"} %lu\n", name, (unsigned long) histogram.last_us);
+        writer_printf(writer, "epaper_phase_last_start_us{phase=\"%s\"} %lld\n", name,
+            (long long) histogram.last_start_us);
+    }
+}
+
+static void write_phases_json(metrics_writer* writer)
+{
+    writer_printf(writer, "\"phases\": {");
+
+    for (int phase = 0; phase < METRICS_PHASE_COUNT; phase++) {
+        metrics_histogram histogram;
+
+        metrics_get_phase(phase, &histogram);
+
+        writer_printf(writer, "%s\"%s\": {\"count\": %lu, \"sum_us\": %llu, \"max_us\": %lu, \"last_us\": %lu, "
+                              "\"last_start_us\": %lld, \"buckets\": [",
+            phase > 0 ? ", " : "", phase_names[phase], (unsigned long) histogram.count,
+            (unsigned long long) histogram.total_us, (unsigned long) histogram.max_us,
+            (unsigned long) histogram.last_us, (long long) histogram.last_start_us);
+        for (int i = 0; i < METRICS_BUCKETS; i++) {
+            writer_printf(writer, "%s%lu", i > 0 ? ", " : "", (unsigned long) histogram.buckets[i]);
+        }
+        writer_printf(writer, "]}");
+    }
+
+    writer_printf(writer, "}, ");
+}
+
+/**
+ * The controller's power state, one gauge per state in text, and the time each kind of transition took.
+ */
+static void write_power(metrics_writer* writer, bool json)
+{
+    power_stats power;
+
+    epaper_get_power_stats(&power);
+
+    if (json) {
+        writer_printf(writer, "\"power\": {\"state\": \"%s\", \"transitions\": {", power_state_name(power.state));
+    } else {
+        for (int state = 0; state < POWER_STATE_COUNT; state++) {
+            writer_printf(writer, "epaper_power_state{state=\"%s\"} %d\n", power_state_name(state),
+                state == power.state);
+        }
+    }
+
+    for (int i = 0; i < POWER_TRANSITION_COUNT; i++) {
+        const power_transition_stats* transition = &power.transitions[i];
+        const char* name = power_transition_name(i);
+
+        if (json) {
+            writer_printf(writer, "%s\"%s\": {\"count\": %lu, \"failures\": %lu, \"sum_us\": %llu, \"max_us\": %lu, "
+                                  "\"last_us\": %lu}",
+                i > 0 ? ", " : "", name, (unsigned long) transition->count, (unsigned long) transition->failures,
+                (unsigned long long) transition->total_us, (unsigned long) transition->max_us,
+                (unsigned long) transition->last_us);
+            continue;
+        }
+
+        writer_printf(writer, "epaper_power_transitions_total{transition=\"%s\"} %lu\n", name,
+            (unsigned long) transition->count);
+        writer_printf(writer, "epaper_power_transition_failures_total{transition=\"%s\"} %lu\n", name,
+            (unsigned long) transition->failures);
+        writer_printf(writer, "epaper_power_transition_us_sum{transition=\"%s\"} %llu\n", name,
+            (unsigned long long) transition->total_us);
+        writer_printf(writer, "epaper_power_transition_max_us{transition=\"%s\"} %lu\n", name,
+            (unsigned long) transition->max_us);
+        writer_printf(writer, "epaper_power_transition_last_us{transition=\"%s\"} %lu\n", name,
+            (unsigned long) transition->last_us);
+    }
+
+    if (json) {
+        writer_printf(writer, "}}, ");
+    }
+}
+
+/**
+ * Writes every metric as Prometheus-style text or as one JSON object. JSON buckets are not cumulative: entry i
+ * counts durations above 2^(i-1) and up to 2^i us, the last one everything longer.
+ */
+void metrics_write(metrics_format format, metrics_emit_fn emit, void* ctx)
+{
+    static metrics_writer writer;
+    epaper_spi_stats spi;
+    epaper_busy_stats busy;
+    epaper_refresh_stats refresh;
+    display_stats display;
+    glyph_cache_stats glyphs;
+    slots_stats slots;
+    bool json = format == METRICS_FORMAT_JSON;
+
+    epaper_get_spi_stats(&spi);
+    epaper_get_busy_stats(&busy);
+    epaper_get_refresh_stats(&refresh);
+    display_get_stats(&display);
+    glyph_cache_get_stats(&glyphs);
+    slots_get_stats(&slots);
+
+    writer.length = 0;
+    writer.emit = emit;
+    writer.ctx = ctx;
+
+    // Name, value pairs in output order
+    const struct {
+        const char* name;
+        unsigned long long value;
+    } values[] = {
+        { "uptime_us", esp_timer_get_time() },
+        { "requests_total", metrics_get_counter(METRICS_COUNTER_REQUESTS) },
+        { "button_presses_total", metrics_get_counter(METRICS_COUNTER_BUTTON_PRESSES) },
+        { "display_commands_total", display.commands },
+        { "display_batches_total", display.batches },
+        { "display_dropped_total", display.dropped },
+        { "refreshes_full_total", refresh.full },
+        { "refreshes_partial_total", refresh.partial },
+        { "refreshes_banded_total", refresh.banded },
+        { "refreshes_skipped_total", refresh.skipped },
+        { "red_plane_skipped_total", refresh.red_skipped },
+        { "spi_transactions_total", spi.transactions },
+        { "spi_bytes_total", spi.bytes },
+        { "busy_timeouts_total", busy.timeouts },
+        { "glyph_cache_hits_total", glyphs.hits },
+        { "glyph_cache_misses_total", glyphs.misses },
+        { "slot_saves_total", slots.saves },
+        { "slot_saves_unchanged_total", slots.unchanged },
+        { "slot_loads_total", slots.loads },
+        { "slot_failures_total", slots.failures },
+        { "slot_sectors_erased_total", slots.sectors_erased },
+        { "slot_bytes_written_total", slots.bytes_written },
+        { "slot_last_save_us", slots.last_save_us },
+        { "heap_free_bytes", heap_caps_get_free_size(MALLOC_CAP_DEFAULT) },
+        { "heap_min_free_bytes", heap_caps_get_minimum_free_size(MALLOC_CAP_DEFAULT) },
+        { "heap_largest_free_block_bytes", heap_caps_get_largest_free_block(MALLOC_CAP_DEFAULT) },
+        { "diff_memory_bytes", refresh.diff_memory_bytes },
+        { "red_plane_memory_bytes", refresh.red_memory_bytes },
+        { "glyph_cache_memory_bytes", glyphs.memory_bytes },
+        { "display_list_bytes", display.list_bytes },
+    };
+
+    if (json) {
+        writer_printf(&writer, "{");
+        write_phases_json(&writer);
+    } else {
+        write_phases_text(&writer);
+    }
+
+    for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+        writer_printf(&writer, json ? "\"%s\": %llu, " : "epaper_%s %llu\n", values[i].name, values[i].value);
+    }
+
+    write_power(&writer, json);
+
+    if (json) {
+        writer_printf(&writer, "\"stack_free_min_bytes\": {");
+    }
+    for (uint8_t i = 0; i < task_count; i++) {
+        const char* name = pcTaskGetName(tasks[i]);
+        unsigned long free_bytes = uxTaskGetStackHighWaterMark(tasks[i]);
+
+        if (json) {
+            writer_printf(&writer, "%s\"%s\": %lu", i > 0 ? ", " : "", name, free_bytes);
+        } else {
+            writer_printf(&writer, "epaper_stack_free_min_bytes{task=\"%s\"} %lu\n", name, free_bytes);
+        }
+    }
+    if (json) {
+        writer_printf(&writer, "}}\n");
+    }
+
+    writer_flush(&writer);
+}
+
+#endif
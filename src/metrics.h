@@ -0,0 +1,91 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "esp_timer.h"
+
+#ifndef ___METRICS_H
+#define ___METRICS_H
+
+// Phase timing, request counters and GET /metrics; with 0 the calls below compile to nothing
+#ifndef EPAPER_METRICS
+#define EPAPER_METRICS 1
+#endif
+
+// Bucket i counts durations up to 2^i us, the last one everything longer (2^25 us is 33.5 s)
+#define METRICS_BUCKETS 27
+// Tasks whose stack high-water marks are reported
+#define METRICS_MAX_TASKS 6
+
+typedef enum metrics_phase {
+    METRICS_PHASE_INIT, // reset and controller setup, fixed delays included
+    METRICS_PHASE_BUSY, // every wait for BUSY_N, including those inside the other phases
+    METRICS_PHASE_TRANSMIT, // frame data sent to the controller, rendering included in banded mode
+    METRICS_PHASE_REFRESH, // from 0x12 until the panel is done
+    METRICS_PHASE_DEEP_SLEEP, // power off and deep sleep
+    METRICS_PHASE_COUNT,
+} metrics_phase;
+
+typedef enum metrics_counter {
+    METRICS_COUNTER_REQUESTS,
+    METRICS_COUNTER_BUTTON_PRESSES,
+    METRICS_COUNTER_COUNT,
+} metrics_counter;
+
+typedef enum metrics_format {
+    METRICS_FORMAT_TEXT,
+    METRICS_FORMAT_JSON,
+} metrics_format;
+
+typedef struct metrics_histogram {
+    uint32_t count;
+    uint32_t buckets[METRICS_BUCKETS];
+    uint64_t total_us;
+    uint32_t max_us;
+    uint32_t last_us;
+    // esp_timer time at which the last one started
+    int64_t last_start_us;
+} metrics_histogram;
+
+typedef void (*metrics_emit_fn)(const uint8_t* data, size_t length, void* ctx);
+
+/**
+ * Start time for metrics_record(); free when metrics are compiled out.
+ */
+static inline int64_t metrics_now()
+{
+    return EPAPER_METRICS ? esp_timer_get_time() : 0;
+}
+
+#if EPAPER_METRICS
+
+void metrics_record(metrics_phase phase, int64_t start_us);
+void metrics_count(metrics_counter counter);
+void metrics_watch_task(TaskHandle_t task);
+
+void metrics_get_phase(metrics_phase phase, metrics_histogram* histogram);
+uint32_t metrics_get_counter(metrics_counter counter);
+
+void metrics_write(metrics_format format, metrics_emit_fn emit, void* ctx);
+
+#else
+
+static inline void metrics_record(metrics_phase phase, int64_t start_us)
+{
+}
+
+static inline void metrics_count(metrics_counter counter)
+{
+}
+
+static inline void metrics_watch_task(TaskHandle_t task)
+{
+}
+
+#endif
+
+#endif
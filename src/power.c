@@ -0,0 +1,183 @@
+#include <stddef.h>
+
+#include "esp_log.h"
+
+#include "power.h"
+
+static const char* TAG = "power.c";
+
+static const char* const state_names[POWER_STATE_COUNT] = { "off", "initialized", "powered", "deep_sleep" };
+static const char* const transition_names[POWER_TRANSITION_COUNT] = {
+    "init", "power_on", "power_off", "deep_sleep", "wake"
+};
+
+void power_init(power_machine* machine, const power_ops* ops, uint32_t idle_timeout_ms)
+{
+    *machine = (power_machine) { .ops = ops, .state = POWER_STATE_OFF, .idle_timeout_ms = idle_timeout_ms };
+}
+
+/**
+ * POWER_IDLE_NEVER keeps the controller awake until power_sleep(); 0 lets it sleep as soon as it is idle.
+ */
+void power_set_idle_timeout(power_machine* machine, uint32_t idle_timeout_ms)
+{
+    machine->idle_timeout_ms = idle_timeout_ms;
+}
+
+static inline bool power_is_awake(const power_machine* machine)
+{
+    return machine->state == POWER_STATE_POWERED || machine->state == POWER_STATE_INITIALIZED;
+}
+
+/**
+ * Runs one controller step and times it. A failed step leaves the state unknown: OFF, so the next use starts over
+ * with a reset.
+ */
+static bool power_step(power_machine* machine, power_transition transition, bool (*step)(void* ctx),
+    power_state target)
+{
+    const power_ops* ops = machine->ops;
+    power_transition_stats* stats = &machine->transitions[transition];
+    int64_t start = ops->now_us(ops->ctx);
+    bool ok = step(ops->ctx);
+    uint32_t elapsed_us = (uint32_t) (ops->now_us(ops->ctx) - start);
+
+    stats->count++;
+    stats->last_us = elapsed_us;
+    stats->total_us += elapsed_us;
+    if (elapsed_us > stats->max_us) {
+        stats->max_us = elapsed_us;
+    }
+
+    if (!ok) {
+        stats->failures++;
+        machine->state = POWER_STATE_OFF;
+        ESP_LOGE(TAG, "%s failed after %lu us, resetting on next use", transition_names[transition],
+            (unsigned long) elapsed_us);
+        return false;
+    }
+
+    ESP_LOGD(TAG, "%s: %s -> %s in %lu us", transition_names[transition], state_names[machine->state],
+        state_names[target], (unsigned long) elapsed_us);
+    machine->state = target;
+
+    return true;
+}
+
+/**
+ * Brings the controller up to at least `target`, INITIALIZED to accept image data or POWERED to refresh as well,
+ * and restarts the idle timeout. Returns false when it did not respond.
+ */
+bool power_require(power_machine* machine, power_state target)
+{
+    const power_ops* ops = machine->ops;
+    bool ok = true;
+
+    if (target != POWER_STATE_INITIALIZED && target != POWER_STATE_POWERED) {
+        return false;
+    }
+
+    switch (machine->state) {
+    case POWER_STATE_OFF:
+        ok = power_step(machine, POWER_TRANSITION_INIT, ops->init, POWER_STATE_POWERED);
+        break;
+    case POWER_STATE_DEEP_SLEEP:
+        ok = power_step(machine, POWER_TRANSITION_WAKE, ops->init, POWER_STATE_POWERED);
+        break;
+    case POWER_STATE_INITIALIZED:
+        if (target == POWER_STATE_POWERED) {
+            ok = power_step(machine, POWER_TRANSITION_POWER_ON, ops->power_on, POWER_STATE_POWERED);
+        }
+        break;
+    default:
+        break;
+    }
+
+    if (ok) {
+        power_touch(machine);
+    }
+
+    return ok;
+}
+
+/**
+ * Restarts the idle timeout, e.g. once a refresh is done.
+ */
+void power_touch(power_machine* machine)
+{
+    machine->last_active_us = machine->ops->now_us(machine->ops->ctx);
+}
+
+/**
+ * Switches the charge pump off while keeping the controller initialized, e.g. once a refresh is done; the next
+ * refresh only has to power on again. The idle timeout keeps running. Returns false if a powered controller did not
+ * respond.
+ */
+bool power_release(power_machine* machine)
+{
+    if (machine->state != POWER_STATE_POWERED) {
+        return true;
+    }
+
+    return power_step(machine, POWER_TRANSITION_POWER_OFF, machine->ops->power_off, POWER_STATE_INITIALIZED);
+}
+
+/**
+ * Powers off and puts the controller into deep sleep right away; returns true if it went to sleep now.
+ */
+bool power_sleep(power_machine* machine)
+{
+    const power_ops* ops = machine->ops;
+
+    if (machine->state == POWER_STATE_POWERED
+        && !power_step(machine, POWER_TRANSITION_POWER_OFF, ops->power_off, POWER_STATE_INITIALIZED)) {
+        return false;
+    }
+
+    if (machine->state != POWER_STATE_INITIALIZED) {
+        return false;
+    }
+
+    return power_step(machine, POWER_TRANSITION_DEEP_SLEEP, ops->deep_sleep, POWER_STATE_DEEP_SLEEP);
+}
+
+/**
+ * Milliseconds until an awake controller has been idle for the idle timeout, 0 once it has, or POWER_IDLE_NEVER
+ * while it is not awake or the timeout is disabled.
+ */
+uint32_t power_idle_remaining_ms(const power_machine* machine)
+{
+    if (!power_is_awake(machine) || machine->idle_timeout_ms == POWER_IDLE_NEVER) {
+        return POWER_IDLE_NEVER;
+    }
+
+    int64_t idle_ms = (machine->ops->now_us(machine->ops->ctx) - machine->last_active_us) / 1000;
+
+    return idle_ms >= machine->idle_timeout_ms ? 0 : machine->idle_timeout_ms - (uint32_t) idle_ms;
+}
+
+/**
+ * Puts the controller into deep sleep if it has been idle for the idle timeout; returns true if it went to sleep.
+ */
+bool power_sleep_if_idle(power_machine* machine)
+{
+    return power_idle_remaining_ms(machine) == 0 && power_sleep(machine);
+}
+
+void power_get_stats(const power_machine* machine, power_stats* stats)
+{
+    stats->state = machine->state;
+    for (int i = 0; i < POWER_TRANSITION_COUNT; i++) {
+        stats->transitions[i] = machine->transitions[i];
+    }
+}
+
+const char* power_state_name(power_state state)
+{
+    return state < POWER_STATE_COUNT ? state_names[state] : "unknown";
+}
+
+const char* power_transition_name(power_transition transition)
+{
+    return transition < POWER_TRANSITION_COUNT ? transition_names[transition] : "unknown";
+}
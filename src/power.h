@@ -0,0 +1,88 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifndef ___POWER_H
+#define ___POWER_H
+
+// What power_idle_remaining_ms() returns while there is nothing to time out
+#define POWER_IDLE_NEVER UINT32_MAX
+
+/**
+ * Power states of the display controller:
+ *
+ *   OFF          ---init--->       POWERED      nothing configured yet, or a step failed and the state is unknown
+ *   POWERED      ---power off-->   INITIALIZED  registers and RAM kept, charge pump off; power_release() after a
+ *                                               refresh, or on the way to deep sleep
+ *   INITIALIZED  ---power on--->   POWERED
+ *   INITIALIZED  ---deep sleep-->  DEEP_SLEEP   everything up to a hardware reset is ignored
+ *   DEEP_SLEEP   ---wake--->       POWERED      reset and init again; RAM is lost
+ */
+typedef enum power_state {
+    POWER_STATE_OFF,
+    POWER_STATE_INITIALIZED,
+    POWER_STATE_POWERED,
+    POWER_STATE_DEEP_SLEEP,
+    POWER_STATE_COUNT,
+} power_state;
+
+typedef enum power_transition {
+    POWER_TRANSITION_INIT,
+    POWER_TRANSITION_POWER_ON,
+    POWER_TRANSITION_POWER_OFF,
+    POWER_TRANSITION_DEEP_SLEEP,
+    POWER_TRANSITION_WAKE,
+    POWER_TRANSITION_COUNT,
+} power_transition;
+
+/**
+ * The controller steps the machine drives; each returns false when the controller did not respond. `init` starts
+ * with a hardware reset and leaves the panel powered. Passing fakes runs the machine without hardware.
+ */
+typedef struct power_ops {
+    bool (*init)(void* ctx);
+    bool (*power_on)(void* ctx);
+    bool (*power_off)(void* ctx);
+    bool (*deep_sleep)(void* ctx);
+    int64_t (*now_us)(void* ctx);
+    void* ctx;
+} power_ops;
+
+typedef struct power_transition_stats {
+    uint32_t count;
+    uint32_t failures;
+    uint32_t last_us;
+    uint32_t max_us;
+    uint64_t total_us;
+} power_transition_stats;
+
+typedef struct power_stats {
+    power_state state;
+    power_transition_stats transitions[POWER_TRANSITION_COUNT];
+} power_stats;
+
+typedef struct power_machine {
+    const power_ops* ops;
+    power_state state;
+    uint32_t idle_timeout_ms;
+    // ops->now_us() time of the last use, from which the idle timeout runs
+    int64_t last_active_us;
+    power_transition_stats transitions[POWER_TRANSITION_COUNT];
+} power_machine;
+
+void power_init(power_machine* machine, const power_ops* ops, uint32_t idle_timeout_ms);
+void power_set_idle_timeout(power_machine* machine, uint32_t idle_timeout_ms);
+
+bool power_require(power_machine* machine, power_state target);
+void power_touch(power_machine* machine);
+bool power_release(power_machine* machine);
+bool power_sleep(power_machine* machine);
+bool power_sleep_if_idle(power_machine* machine);
+uint32_t power_idle_remaining_ms(const power_machine* machine);
+
+void power_get_stats(const power_machine* machine, power_stats* stats);
+const char* power_state_name(power_state state);
+const char* power_transition_name(power_transition transition);
+
+#endif
@@ -0,0 +1,434 @@
+#include <string.h>
+#include <sys/param.h>
+
+#include "epaper.h"
+#include "proto.h"
+#include "utf8.h"
+
+_Static_assert(PROTO_PAYLOAD_MAX >= PROTO_RECT_SIZE + DISPLAY_BITMAP_MAX_SIZE, "a bitmap payload must fit");
+_Static_assert(PROTO_PAYLOAD_MAX >= PROTO_TEXT_BOX_HEADER_SIZE + DISPLAY_TEXT_MAX_LEN, "a text box payload must fit");
+
+void proto_parser_init(proto_parser* parser, proto_command_fn on_command, void* ctx)
+{
+    memset(parser, 0, sizeof(*parser));
+    parser->state = PROTO_STATE_STREAM_HEADER;
+    parser->on_command = on_command;
+    parser->ctx = ctx;
+}
+
+static inline uint16_t read_u16(const uint8_t* data)
+{
+    return data[0] | (data[1] << 8);
+}
+
+/**
+ * Decodes the buffered payload of a complete command and hands it to the callback.
+ */
+static bool proto_emit(proto_parser* parser)
+{
+    display_command command = { 0 };
+    const uint8_t* p = parser->payload;
+    uint16_t length = parser->payload_length;
+
+    switch (parser->opcode) {
+    case PROTO_OP_ID:
+        if (length != 2) {
+            return false;
+        }
+        parser->next_id = read_u16(p);
+        return true;
+    case PROTO_OP_REMOVE:
+        if (length != 2) {
+            return false;
+        }
+        command.type = DISPLAY_CMD_REMOVE;
+        command.id = read_u16(p);
+        break;
+    case PROTO_OP_FILL:
+    case PROTO_OP_BITMAP: {
+        if (length < PROTO_RECT_SIZE || (parser->opcode == PROTO_OP_FILL && length != PROTO_RECT_SIZE)) {
+            return false;
+        }
+        command.type = parser->opcode == PROTO_OP_FILL ? DISPLAY_CMD_FILL_RECT : DISPLAY_CMD_DRAW_BITMAP;
+        command.x = read_u16(p);
+        command.y = read_u16(p + 2);
+        command.width = read_u16(p + 4);
+        command.height = read_u16(p + 6);
+        command.color = p[8];
+
+        // The rows have to be all there and fit a command
+        size_t bitmap_size = (size_t) (command.width + 7) / 8 * command.height;
+        if (parser->opcode == PROTO_OP_BITMAP
+            && (bitmap_size != length - PROTO_RECT_SIZE || bitmap_size > DISPLAY_BITMAP_MAX_SIZE)) {
+            return false;
+        }
+        memcpy(command.bitmap, p + PROTO_RECT_SIZE, length - PROTO_RECT_SIZE);
+        break;
+    }
+    case PROTO_OP_SHAPE:
+        if (length < PROTO_SHAPE_HEADER_SIZE || (length - PROTO_SHAPE_HEADER_SIZE) % 4 != 0
+            || (length - PROTO_SHAPE_HEADER_SIZE) / 4 > SHAPE_MAX_POINTS) {
+            return false;
+        }
+        command.type = DISPLAY_CMD_DRAW_SHAPE;
+        command.shape = p[0];
+        command.shape_flags = p[1];
+        command.thickness = p[2];
+        command.color = p[3];
+        command.x = read_u16(p + 4);
+        command.y = read_u16(p + 6);
+        command.x2 = read_u16(p + 8);
+        command.y2 = read_u16(p + 10);
+        command.width = read_u16(p + 12);
+        command.height = read_u16(p + 14);
+        command.radius = read_u16(p + 16);
+        command.length = (length - PROTO_SHAPE_HEADER_SIZE) / 4;
+        for (uint16_t i = 0; i < command.length; i++) {
+            command.points[i].x = read_u16(p + PROTO_SHAPE_HEADER_SIZE + 4 * i);
+            command.points[i].y = read_u16(p + PROTO_SHAPE_HEADER_SIZE + 4 * i + 2);
+        }
+        break;
+    case PROTO_OP_TEXT:
+        if (length < 4) {
+            return false;
+        }
+        command.type = DISPLAY_CMD_DRAW_TEXT;
+        command.x = read_u16(p);
+        command.y = read_u16(p + 2);
+        memcpy(command.text, p + 4, MIN(length - 4, DISPLAY_TEXT_MAX_LEN));
+        utf8_trim(command.text);
+        break;
+    case PROTO_OP_TEXT_BOX:
+        if (length < PROTO_TEXT_BOX_HEADER_SIZE) {
+            return false;
+        }
+        command.type = DISPLAY_CMD_DRAW_TEXT_BOX;
+        command.x = read_u16(p);
+        command.y = read_u16(p + 2);
+        command.width = read_u16(p + 4);
+        command.height = read_u16(p + 6);
+        command.layout.align = p[8];
+        command.layout.flags = p[9];
+        command.layout.line_spacing = (int8_t) p[10];
+        memcpy(command.text, p + PROTO_TEXT_BOX_HEADER_SIZE,
+            MIN(length - PROTO_TEXT_BOX_HEADER_SIZE, DISPLAY_TEXT_MAX_LEN));
+        utf8_trim(command.text);
+        break;
+    case PROTO_OP_LINE:
+        if (length != 9) {
+            return false;
+        }
+        command.type = DISPLAY_CMD_DRAW_LINE;
+        command.x = read_u16(p);
+        command.y = read_u16(p + 2);
+        command.x2 = read_u16(p + 4);
+        command.y2 = read_u16(p + 6);
+        command.color = p[8];
+        break;
+    case PROTO_OP_RUN:
+        if (length != 7) {
+            return false;
+        }
+        command.type = DISPLAY_CMD_DRAW_RUN;
+        command.x = read_u16(p);
+        command.y = read_u16(p + 2);
+        command.length = read_u16(p + 4);
+        command.color = p[6];
+        break;
+    case PROTO_OP_CLEAR:
+        if (length != 0) {
+            return false;
+        }
+        command.type = DISPLAY_CMD_CLEAR;
+        break;
+    case PROTO_OP_COLOR:
+        if (length != 1) {
+            return false;
+        }
+        command.type = DISPLAY_CMD_SET_SCREEN_COLOR;
+        command.color = p[0] == SCREEN_BLACK ? SCREEN_BLACK : SCREEN_WHITE;
+        break;
+    default:
+        return false;
+    }
+
+    if (command.type != DISPLAY_CMD_REMOVE) {
+        command.id = parser->next_id;
+        parser->next_id = 0;
+    }
+
+    parser->commands++;
+    parser->on_command(&command, parser->ctx);
+
+    return true;
+}
+
+/**
+ * Feeds the next chunk of the body; commands are emitted as soon as their last byte arrives.
+ *
+ * Returns false once the stream is malformed; commands emitted before that point stay applied.
+ */
+bool proto_parser_feed(proto_parser* parser, const uint8_t* data, size_t length)
+{
+    size_t i = 0;
+
+    while (i < length) {
+        switch (parser->state) {
+        case PROTO_STATE_STREAM_HEADER:
+            parser->header[parser->received++] = data[i++];
+
+            if (parser->received == PROTO_STREAM_HEADER_SIZE) {
+                if (parser->header[0] != PROTO_MAGIC_0 || parser->header[1] != PROTO_MAGIC_1
+                    || parser->header[2] != PROTO_VERSION) {
+                    parser->state = PROTO_STATE_ERROR;
+                    break;
+                }
+
+                parser->flags = parser->header[3];
+                parser->received = 0;
+                parser->state = PROTO_STATE_COMMAND_HEADER;
+            }
+            break;
+
+        case PROTO_STATE_COMMAND_HEADER:
+            parser->header[parser->received++] = data[i++];
+
+            if (parser->received == PROTO_COMMAND_HEADER_SIZE) {
+                parser->opcode = parser->header[0];
+                parser->payload_length = read_u16(parser->header + 1);
+                parser->received = 0;
+                parser->state = PROTO_STATE_PAYLOAD;
+
+                if (parser->payload_length == 0) {
+                    parser->state = proto_emit(parser) ? PROTO_STATE_COMMAND_HEADER : PROTO_STATE_ERROR;
+                }
+            }
+            break;
+
+        case PROTO_STATE_PAYLOAD: {
+            uint16_t n = MIN(length - i, (size_t) (parser->payload_length - parser->received));
+
+            // Bytes past PROTO_PAYLOAD_MAX are consumed but not kept
+            if (parser->received < PROTO_PAYLOAD_MAX) {
+                memcpy(parser->payload + parser->received, data + i, MIN(n, PROTO_PAYLOAD_MAX - parser->received));
+            }
+
+            parser->received += n;
+            i += n;
+
+            if (parser->received == parser->payload_length) {
+                parser->received = 0;
+                parser->state = proto_emit(parser) ? PROTO_STATE_COMMAND_HEADER : PROTO_STATE_ERROR;
+            }
+            break;
+        }
+
+        case PROTO_STATE_ERROR:
+            return false;
+        }
+    }
+
+    return parser->state != PROTO_STATE_ERROR;
+}
+
+/**
+ * Returns true when the body ended on a command boundary.
+ */
+bool proto_parser_finish(const proto_parser* parser)
+{
+    return parser->state == PROTO_STATE_COMMAND_HEADER && parser->received == 0;
+}
+
+static int json_int(const cJSON* object, const char* key, int fallback)
+{
+    const cJSON* item = cJSON_GetObjectItem(object, key);
+
+    return cJSON_IsNumber(item) ? item->valueint : fallback;
+}
+
+static bool json_bool(const cJSON* object, const char* key, bool fallback)
+{
+    const cJSON* item = cJSON_GetObjectItem(object, key);
+
+    return cJSON_IsBool(item) ? cJSON_IsTrue(item) : fallback;
+}
+
+/**
+ * Decodes a string of hex digit pairs into `out`; returns false when it is malformed or longer than `size` bytes.
+ */
+static bool proto_parse_hex(const char* hex, uint8_t* out, size_t size, size_t* length)
+{
+    size_t n = strlen(hex);
+
+    if (n % 2 != 0 || n / 2 > size) {
+        return false;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        char c = hex[i];
+        uint8_t nibble;
+
+        if (c >= '0' && c <= '9') {
+            nibble = c - '0';
+        } else if (c >= 'a' && c <= 'f') {
+            nibble = c - 'a' + 10;
+        } else if (c >= 'A' && c <= 'F') {
+            nibble = c - 'A' + 10;
+        } else {
+            return false;
+        }
+
+        out[i / 2] = i % 2 ? (out[i / 2] | nibble) : nibble << 4;
+    }
+
+    *length = n / 2;
+
+    return true;
+}
+
+/**
+ * Fills in a text command from "text", "x", "y", "color" and "id". With "w" and "h" it becomes a text box, laid out
+ * with "align" ("left", "center" or "right"), "wrap" (default true), "ellipsis" and "spacing" (extra pixels
+ * between lines). Returns false without a "text" string.
+ */
+bool proto_parse_json_text(const cJSON* json, display_command* command)
+{
+    const cJSON* text = cJSON_GetObjectItem(json, "text");
+    const cJSON* align = cJSON_GetObjectItem(json, "align");
+
+    if (!cJSON_IsString(text)) {
+        return false;
+    }
+
+    command->type = DISPLAY_CMD_DRAW_TEXT;
+    command->x = json_int(json, "x", 0);
+    command->y = json_int(json, "y", 0);
+    command->color = json_int(json, "color", COLOR_BLACK);
+    command->id = json_int(json, "id", 0);
+    strncpy(command->text, text->valuestring, DISPLAY_TEXT_MAX_LEN);
+    utf8_trim(command->text);
+
+    if (!cJSON_GetObjectItem(json, "w") || !cJSON_GetObjectItem(json, "h")) {
+        return true;
+    }
+
+    command->type = DISPLAY_CMD_DRAW_TEXT_BOX;
+    command->width = json_int(json, "w", 0);
+    command->height = json_int(json, "h", 0);
+    command->layout.line_spacing = json_int(json, "spacing", 0);
+    command->layout.flags = (json_bool(json, "wrap", true) ? LAYOUT_WRAP : 0)
+        | (json_bool(json, "ellipsis", false) ? LAYOUT_ELLIPSIS : 0);
+    command->layout.align = LAYOUT_ALIGN_LEFT;
+    if (cJSON_IsString(align) && strcmp(align->valuestring, "center") == 0) {
+        command->layout.align = LAYOUT_ALIGN_CENTER;
+    } else if (cJSON_IsString(align) && strcmp(align->valuestring, "right") == 0) {
+        command->layout.align = LAYOUT_ALIGN_RIGHT;
+    }
+
+    return true;
+}
+
+/**
+ * Converts one JSON batch operation to a display command; returns false for an unknown or incomplete operation.
+ *
+ * Drawing operations take an "id"; drawing again with the same id replaces the item, and "remove" takes it off
+ * the screen.
+ */
+bool proto_parse_json_op(const cJSON* op_json, display_command* command)
+{
+    const cJSON* op = cJSON_GetObjectItem(op_json, "op");
+
+    if (!cJSON_IsString(op)) {
+        return false;
+    }
+
+    memset(command, 0, sizeof(*command));
+    command->x = json_int(op_json, "x", 0);
+    command->y = json_int(op_json, "y", 0);
+    command->color = json_int(op_json, "color", 0);
+    command->id = json_int(op_json, "id", 0);
+
+    if (strcmp(op->valuestring, "text") == 0) {
+        return proto_parse_json_text(op_json, command);
+    } else if (strcmp(op->valuestring, "line") == 0) {
+        command->type = DISPLAY_CMD_DRAW_LINE;
+        command->x = json_int(op_json, "x1", 0);
+        command->y = json_int(op_json, "y1", 0);
+        command->x2 = json_int(op_json, "x2", 0);
+        command->y2 = json_int(op_json, "y2", 0);
+        command->thickness = json_int(op_json, "width", 1);
+        if (command->thickness > 1) {
+            command->type = DISPLAY_CMD_DRAW_SHAPE;
+            command->shape = SHAPE_LINE;
+        }
+    } else if (strcmp(op->valuestring, "rect") == 0 || strcmp(op->valuestring, "circle") == 0) {
+        command->type = DISPLAY_CMD_DRAW_SHAPE;
+        command->width = json_int(op_json, "w", 0);
+        command->height = json_int(op_json, "h", 0);
+        command->radius = json_int(op_json, "r", 0);
+        command->thickness = json_int(op_json, "width", 1);
+        command->shape_flags = json_bool(op_json, "fill", false) ? SHAPE_FILLED : 0;
+        if (op->valuestring[0] == 'c') {
+            command->shape = SHAPE_CIRCLE;
+        } else {
+            command->shape = command->radius > 0 ? SHAPE_ROUND_RECT : SHAPE_RECT;
+        }
+    } else if (strcmp(op->valuestring, "polygon") == 0) {
+        const cJSON* points = cJSON_GetObjectItem(op_json, "points");
+        const cJSON* point;
+
+        command->type = DISPLAY_CMD_DRAW_SHAPE;
+        command->shape = SHAPE_POLYGON;
+        command->shape_flags = SHAPE_FILLED;
+        if (!cJSON_IsArray(points) || cJSON_GetArraySize(points) < 3
+            || cJSON_GetArraySize(points) > SHAPE_MAX_POINTS) {
+            return false;
+        }
+        cJSON_ArrayForEach(point, points)
+        {
+            const cJSON* x = cJSON_GetArrayItem(point, 0);
+            const cJSON* y = cJSON_GetArrayItem(point, 1);
+
+            if (!cJSON_IsNumber(x) || !cJSON_IsNumber(y)) {
+                return false;
+            }
+            command->points[command->length].x = x->valueint;
+            command->points[command->length].y = y->valueint;
+            command->length++;
+        }
+    } else if (strcmp(op->valuestring, "run") == 0) {
+        command->type = DISPLAY_CMD_DRAW_RUN;
+        command->length = json_int(op_json, "length", 0);
+    } else if (strcmp(op->valuestring, "fill") == 0) {
+        command->type = DISPLAY_CMD_FILL_RECT;
+        command->width = json_int(op_json, "w", 0);
+        command->height = json_int(op_json, "h", 0);
+    } else if (strcmp(op->valuestring, "bitmap") == 0) {
+        const cJSON* data = cJSON_GetObjectItem(op_json, "data");
+        size_t length;
+
+        command->type = DISPLAY_CMD_DRAW_BITMAP;
+        command->width = json_int(op_json, "w", 0);
+        command->height = json_int(op_json, "h", 0);
+        if (!cJSON_IsString(data)
+            || !proto_parse_hex(data->valuestring, command->bitmap, DISPLAY_BITMAP_MAX_SIZE, &length)
+            || length != (size_t) (command->width + 7) / 8 * command->height) {
+            return false;
+        }
+    } else if (strcmp(op->valuestring, "remove") == 0) {
+        command->type = DISPLAY_CMD_REMOVE;
+    } else if (strcmp(op->valuestring, "clear") == 0) {
+        command->type = DISPLAY_CMD_CLEAR;
+    } else if (strcmp(op->valuestring, "color") == 0) {
+        const cJSON* color = cJSON_GetObjectItem(op_json, "color");
+        if (!cJSON_IsString(color)) {
+            return false;
+        }
+        command->type = DISPLAY_CMD_SET_SCREEN_COLOR;
+        command->color = strcmp(color->valuestring, "black") == 0 ? SCREEN_BLACK : SCREEN_WHITE;
+    } else {
+        return false;
+    }
+
+    return true;
+}
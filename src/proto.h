@@ -0,0 +1,102 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "cJSON.h"
+
+#include "display.h"
+
+#ifndef ___PROTO_H
+#define ___PROTO_H
+
+/*
+ * Binary draw protocol (Content-Type: application/octet-stream)
+ *
+ * Stream header, 4 bytes: 'E' 'P' version flags
+ * Then any number of commands: opcode (u8), payload length (u16), payload
+ *
+ * All integers are little endian. Payloads:
+ *
+ *   PROTO_OP_TEXT   x (u16), y (u16), UTF-8 text (rest of the payload, not terminated)
+ *   PROTO_OP_LINE   x1 (u16), y1 (u16), x2 (u16), y2 (u16), color (u8)
+ *   PROTO_OP_RUN    x (u16), y (u16), length (u16), color (u8)
+ *   PROTO_OP_CLEAR  empty
+ *   PROTO_OP_COLOR  screen color (u8, SCREEN_BLACK or SCREEN_WHITE)
+ *   PROTO_OP_TEXT_BOX  x (u16), y (u16), w (u16), h (u16), align (u8, LAYOUT_ALIGN_*), flags (u8, LAYOUT_WRAP |
+ *                      LAYOUT_ELLIPSIS), line spacing (i8), UTF-8 text (rest of the payload, not terminated)
+ *   PROTO_OP_ID      id (u16) of the next drawing command; drawing with an id replaces the item drawn with it before
+ *   PROTO_OP_REMOVE  id (u16) of the item to remove from the screen
+ *   PROTO_OP_FILL    x (u16), y (u16), w (u16), h (u16), color (u8)
+ *   PROTO_OP_BITMAP  x (u16), y (u16), w (u16), h (u16), color (u8), h rows of (w + 7) / 8 bytes, MSB first, 1 bits
+ *                    drawn in color, 0 bits white; at most DISPLAY_BITMAP_MAX_SIZE bytes
+ *   PROTO_OP_SHAPE   shape (u8, SHAPE_*), flags (u8, SHAPE_FILLED), thickness (u8), color (u8), x (u16), y (u16),
+ *                    x2 (u16), y2 (u16), w (u16), h (u16), radius (u16), then polygon points as x (u16), y (u16)
+ *                    pairs, at most SHAPE_MAX_POINTS
+ */
+#define PROTO_MAGIC_0 'E'
+#define PROTO_MAGIC_1 'P'
+#define PROTO_VERSION 1
+#define PROTO_STREAM_HEADER_SIZE 4
+#define PROTO_COMMAND_HEADER_SIZE 3
+
+// Stream flag: apply the commands to the framebuffer without refreshing
+#define PROTO_FLAG_NO_REFRESH 0x01
+
+#define PROTO_OP_TEXT 0x01
+#define PROTO_OP_LINE 0x02
+#define PROTO_OP_RUN 0x03
+#define PROTO_OP_CLEAR 0x04
+#define PROTO_OP_COLOR 0x05
+#define PROTO_OP_TEXT_BOX 0x06
+#define PROTO_OP_ID 0x07
+#define PROTO_OP_REMOVE 0x08
+#define PROTO_OP_FILL 0x09
+#define PROTO_OP_BITMAP 0x0A
+#define PROTO_OP_SHAPE 0x0B
+
+// Fixed part of a PROTO_OP_TEXT_BOX payload
+#define PROTO_TEXT_BOX_HEADER_SIZE 11
+// Fixed part of a PROTO_OP_FILL payload, and of a PROTO_OP_BITMAP payload before the rows
+#define PROTO_RECT_SIZE 9
+// Fixed part of a PROTO_OP_SHAPE payload
+#define PROTO_SHAPE_HEADER_SIZE 18
+// Payload bytes kept per command, enough for the largest polygon; longer text is truncated to DISPLAY_TEXT_MAX_LEN
+#define PROTO_PAYLOAD_MAX (PROTO_SHAPE_HEADER_SIZE + SHAPE_MAX_POINTS * 4)
+
+typedef void (*proto_command_fn)(const display_command* command, void* ctx);
+
+typedef enum proto_state {
+    PROTO_STATE_STREAM_HEADER,
+    PROTO_STATE_COMMAND_HEADER,
+    PROTO_STATE_PAYLOAD,
+    PROTO_STATE_ERROR,
+} proto_state;
+
+/**
+ * Incremental parser; holds at most one command, so a body of any length parses in constant memory.
+ */
+typedef struct proto_parser {
+    proto_state state;
+    uint8_t flags;
+    uint8_t opcode;
+    uint16_t payload_length;
+    uint16_t received;
+    uint8_t header[PROTO_STREAM_HEADER_SIZE];
+    uint8_t payload[PROTO_PAYLOAD_MAX];
+    uint32_t commands;
+    // Set by PROTO_OP_ID for the next drawing command
+    uint16_t next_id;
+    proto_command_fn on_command;
+    void* ctx;
+} proto_parser;
+
+void proto_parser_init(proto_parser* parser, proto_command_fn on_command, void* ctx);
+bool proto_parser_feed(proto_parser* parser, const uint8_t* data, size_t length);
+bool proto_parser_finish(const proto_parser* parser);
+
+bool proto_parse_json_text(const cJSON* json, display_command* command);
+bool proto_parse_json_op(const cJSON* op_json, display_command* command);
+
+#endif
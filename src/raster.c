@@ -0,0 +1,374 @@
+#include <stdlib.h>
+#include <string.h>
+#include <sys/param.h>
+
+#include "glyph_cache.h"
+#include "raster.h"
+#include "utf8.h"
+
+static inline uint32_t left_mask(uint8_t width)
+{
+    return width >= 32 ? 0xffffffffu : ~(0xffffffffu >> width);
+}
+
+/**
+ * Reads `width` bits of a glyph row starting at bit `offset`, left-aligned in a 32-bit word.
+ */
+static inline uint32_t font_row_bits(const uint8_t* row, uint32_t offset, uint8_t width)
+{
+    const uint8_t* src = row + offset / 8;
+    uint8_t skip = offset % 8;
+    uint8_t bytes = (skip + width + 7) / 8;
+    uint32_t bits = 0;
+
+    // Only the bytes the row covers are read, so the last glyph never reads past the bitmap
+    for (uint8_t i = 0; i < bytes; i++) {
+        bits |= (uint32_t) src[i] << (24 - 8 * i);
+    }
+
+    return (bits << skip) & left_mask(width);
+}
+
+/**
+ * Writes `width` left-aligned pixels of `bits` at (x, y), clipped to the raster's right edge.
+ *
+ * Byte-aligned rows that cover whole bytes are stored directly; otherwise the word is shifted into place and
+ * merged with edge masks.
+ */
+void raster_put_row_bits(const Raster* raster, uint16_t x, uint16_t y, uint32_t bits, uint8_t width)
+{
+    if (x >= raster->width || y < raster->top || y - raster->top >= raster->height) {
+        return;
+    }
+    y -= raster->top;
+    if (x + width > raster->width) {
+        width = raster->width - x;
+    }
+
+    uint8_t* dst = raster->buffer + y * raster->stride + x / 8;
+    uint8_t shift = x % 8;
+    uint8_t bytes = (shift + width + 7) / 8;
+    uint32_t mask = left_mask(width) >> shift;
+
+    bits >>= shift;
+
+    if (shift == 0 && width % 8 == 0) {
+        for (uint8_t i = 0; i < bytes; i++) {
+            dst[i] = bits >> (24 - 8 * i);
+        }
+        return;
+    }
+
+    for (uint8_t i = 0; i < bytes; i++) {
+        uint8_t m = mask >> (24 - 8 * i);
+        dst[i] = (dst[i] & ~m) | ((bits >> (24 - 8 * i)) & m);
+    }
+}
+
+/**
+ * Clears the pixels set in `width` left-aligned `bits` at (x, y) to black, clipped to the raster's right edge.
+ */
+void raster_ink_row_bits(const Raster* raster, uint16_t x, uint16_t y, uint32_t bits, uint8_t width)
+{
+    if (x >= raster->width || y < raster->top || y - raster->top >= raster->height) {
+        return;
+    }
+    y -= raster->top;
+    if (x + width > raster->width) {
+        width = raster->width - x;
+    }
+
+    uint8_t* dst = raster->buffer + y * raster->stride + x / 8;
+    uint8_t shift = x % 8;
+    uint8_t bytes = (shift + width + 7) / 8;
+
+    bits = (bits & left_mask(width)) >> shift;
+
+    for (uint8_t i = 0; i < bytes; i++) {
+        dst[i] &= ~(bits >> (24 - 8 * i));
+    }
+}
+
+/**
+ * Sets `width` pixels of row `y` starting at `x` to `color`, clipped to the raster: the partial bytes at either
+ * end are merged through a mask and the bytes in between are set with memset().
+ */
+void raster_hspan(const Raster* raster, uint16_t x, uint16_t y, uint16_t width, uint8_t color)
+{
+    if (x >= raster->width || y < raster->top || y - raster->top >= raster->height || width == 0) {
+        return;
+    }
+    width = MIN(width, raster->width - x);
+
+    uint8_t* row = raster->buffer + (y - raster->top) * raster->stride;
+    uint16_t first = x / 8;
+    uint16_t last = (x + width - 1) / 8;
+    uint8_t head = 0xffu >> (x % 8);
+    uint8_t tail = 0xffu << (7 - (x + width - 1) % 8);
+    uint8_t fill = color ? 0xff : 0x00;
+
+    if (first == last) {
+        head &= tail;
+        row[first] = (row[first] & ~head) | (fill & head);
+        return;
+    }
+
+    row[first] = (row[first] & ~head) | (fill & head);
+    memset(row + first + 1, fill, last - first - 1);
+    row[last] = (row[last] & ~tail) | (fill & tail);
+}
+
+/**
+ * Sets `height` pixels of column `x` starting at `y` to `color`, clipped to the raster; one masked byte per row.
+ */
+void raster_vspan(const Raster* raster, uint16_t x, uint16_t y, uint16_t height, uint8_t color)
+{
+    uint32_t end = MIN((uint32_t) y + height, (uint32_t) raster->top + raster->height);
+
+    if (x >= raster->width) {
+        return;
+    }
+    if (y < raster->top) {
+        y = raster->top;
+    }
+
+    uint8_t mask = 0x80u >> (x % 8);
+    uint8_t* dst = raster->buffer + (y - raster->top) * raster->stride + x / 8;
+
+    if (color) {
+        for (uint32_t row = y; row < end; row++, dst += raster->stride) {
+            *dst |= mask;
+        }
+    } else {
+        for (uint32_t row = y; row < end; row++, dst += raster->stride) {
+            *dst &= ~mask;
+        }
+    }
+}
+
+void raster_fill_rect(const Raster* raster, uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t color)
+{
+    uint32_t end = MIN((uint32_t) y + height, (uint32_t) raster->top + raster->height);
+
+    // Only the rows the raster holds
+    for (uint32_t row = MAX(y, raster->top); row < end; row++) {
+        raster_hspan(raster, x, row, width, color);
+    }
+}
+
+/**
+ * Draws the Bresenham line from (x1, y1) to (x2, y2) in `color`, both ends included. Horizontal and vertical lines
+ * are spans; the others step through the buffer directly instead of addressing every pixel from scratch.
+ */
+void raster_draw_line(const Raster* raster, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t color)
+{
+    int32_t dx = abs(x2 - x1);
+    int32_t sx = x1 < x2 ? 1 : -1;
+    int32_t dy = -abs(y2 - y1);
+    int32_t sy = y1 < y2 ? 1 : -1;
+    int32_t err = dx + dy;
+    int32_t x = x1;
+    int32_t y = y1;
+    uint8_t fill = color ? 0xff : 0x00;
+    uint8_t mask = 0;
+
+    if (y1 == y2) {
+        raster_hspan(raster, MIN(x1, x2), y1, dx + 1, color);
+        return;
+    }
+    if (x1 == x2) {
+        raster_vspan(raster, x1, MIN(y1, y2), -dy + 1, color);
+        return;
+    }
+    if (MAX(y1, y2) < raster->top || MIN(y1, y2) >= raster->top + raster->height) {
+        return;
+    }
+
+    // Offset of row y in the buffer; only used while y is one of the rows held
+    int32_t row = (y - raster->top) * raster->stride;
+    int32_t step = sy * raster->stride;
+
+    if (-dy > dx) {
+        // Steep: a pixel per row, written as it is reached
+        while (1) {
+            if (x < raster->width && (uint32_t) (y - raster->top) < raster->height) {
+                uint8_t* dst = raster->buffer + row + (x >> 3);
+                uint8_t bit = 0x80u >> (x & 7);
+                *dst = (*dst & ~bit) | (fill & bit);
+            }
+            if (y == y2) {
+                break;
+            }
+
+            int32_t e2 = 2 * err;
+            if (e2 >= dy) {
+                err += dy;
+                x += sx;
+            }
+            err += dx;
+            y += sy;
+            row += step;
+        }
+        return;
+    }
+
+    // Flat: the pixels that fall in the same byte are collected into a mask and the byte is written once
+    while (1) {
+        bool last = x == x2;
+        int32_t e2 = 2 * err;
+        int32_t next_x = x + sx;
+        int32_t next_y = y;
+
+        if (x < raster->width) {
+            mask |= 0x80u >> (x & 7);
+        }
+
+        if (!last) {
+            err += dy;
+            if (e2 <= dx) {
+                err += dx;
+                next_y += sy;
+            }
+        }
+
+        if (last || next_y != y || ((next_x ^ x) & ~7)) {
+            if (mask && (uint32_t) (y - raster->top) < raster->height) {
+                uint8_t* dst = raster->buffer + row + (x >> 3);
+                *dst = (*dst & ~mask) | (fill & mask);
+            }
+            mask = 0;
+        }
+
+        if (last) {
+            break;
+        }
+        if (next_y != y) {
+            row += step;
+        }
+        x = next_x;
+        y = next_y;
+    }
+}
+
+/**
+ * Copies `height` rows of a `width` pixel bitmap to (x, y), white and black pixels alike; rows are (width + 7) / 8
+ * bytes, MSB first, in the raster's polarity unless `invert` is set.
+ */
+void raster_put_bitmap(const Raster* raster, uint16_t x, uint16_t y, const uint8_t* bitmap, uint16_t width,
+    uint16_t height, bool invert)
+{
+    size_t row_bytes = (width + 7) / 8;
+    uint32_t flip = invert ? 0xffffffffu : 0;
+
+    if (x >= raster->width) {
+        return;
+    }
+    width = MIN(width, raster->width - x);
+
+    for (uint16_t row = 0; row < height; row++, bitmap += row_bytes) {
+        uint32_t ry = (uint32_t) y + row;
+
+        if (ry < raster->top) {
+            continue;
+        }
+        if (ry >= raster->top + raster->height) {
+            break;
+        }
+
+        for (uint16_t column = 0; column < width; column += 16) {
+            uint8_t n = MIN(width - column, 16);
+            raster_put_row_bits(raster, x + column, ry, font_row_bits(bitmap, column, n) ^ flip, n);
+        }
+    }
+}
+
+/**
+ * Draws `glyph` of `font` with the pen at (x, y), the top of the line: the advance x line_height cell is filled
+ * white, then the ink is blitted from the glyph's bitmap, which is read front to back as one block. Encoded
+ * fonts are decoded through the glyph cache.
+ *
+ * Ink left of or above the raster is cut off, rows below it are skipped up front and columns past the right
+ * edge are masked off.
+ */
+void raster_draw_glyph(const Raster* raster, uint16_t x, uint16_t y, const Font* font, const Glyph* glyph)
+{
+    if (x >= raster->width || y >= raster->top + raster->height || y + font->line_height <= raster->top) {
+        return;
+    }
+
+    raster_fill_rect(raster, x, y, glyph->advance, font->line_height, 1);
+
+    const uint8_t* row_data = glyph_cache_bitmap(font, glyph);
+    size_t row_bytes = font_glyph_row_bytes(glyph);
+    int32_t gx = (int32_t) x + glyph->x_offset;
+    // Relative to the first row held in the buffer from here on
+    int32_t gy = (int32_t) y + glyph->y_offset - raster->top;
+    uint16_t rows = glyph->height;
+    uint8_t skip = 0;
+
+    if (!row_data) {
+        return;
+    }
+    if (gy < 0) {
+        if (-gy >= rows) {
+            return;
+        }
+        row_data += (size_t) -gy * row_bytes;
+        rows += gy;
+        gy = 0;
+    }
+    if (gy >= raster->height) {
+        return;
+    }
+    if (gy + rows > raster->height) {
+        rows = raster->height - gy;
+    }
+    if (gx < 0) {
+        if (-gx >= glyph->width) {
+            return;
+        }
+        skip = -gx;
+        gx = 0;
+    }
+
+    if (glyph->width > RASTER_MAX_BLIT_WIDTH) {
+        // Too wide for one word: blit each row as several narrower columns
+        for (uint16_t row = 0; row < rows; row++, row_data += row_bytes) {
+            for (uint8_t column = skip; column < glyph->width; column += 16) {
+                uint8_t width = glyph->width - column < 16 ? glyph->width - column : 16;
+                raster_ink_row_bits(raster, gx + column - skip, raster->top + gy + row,
+                    font_row_bits(row_data, column, width), width);
+            }
+        }
+        return;
+    }
+
+    uint8_t width = glyph->width - skip;
+
+    for (uint16_t row = 0; row < rows; row++, row_data += row_bytes) {
+        raster_ink_row_bits(raster, gx, raster->top + gy + row, font_row_bits(row_data, skip, width), width);
+    }
+}
+
+/**
+ * Draws the glyphs of [text, end), stopping at a NUL, with the pen starting at (x, y) and returns where the pen
+ * ends up; glyphs past the right edge are not drawn.
+ */
+uint32_t raster_draw_glyphs(const Raster* raster, uint32_t x, uint16_t y, const char* text, const char* end,
+    const Font* font)
+{
+    uint32_t c;
+
+    while (text < end && (c = utf8_next(&text)) != 0) {
+        // Every later glyph is off the raster as well
+        if (x >= raster->width) {
+            break;
+        }
+
+        const Glyph* glyph = font_get_glyph(font, c);
+        raster_draw_glyph(raster, x, y, font, glyph);
+        x += glyph->advance;
+    }
+
+    return x;
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "font.h"
+
+#ifndef ___RASTER_H
+#define ___RASTER_H
+
+/**
+ * A 1-bit image: `stride` bytes per row, MSB is the leftmost pixel, 1 = white.
+ *
+ * `buffer` holds rows `top` to `top + height - 1` of the image, so a band of a larger image is drawn with the
+ * image's own coordinates; whatever falls outside those rows is clipped.
+ */
+typedef struct Raster {
+    uint8_t* buffer;
+    uint16_t width;
+    uint16_t height;
+    uint16_t stride;
+    uint16_t top;
+} Raster;
+
+// Widest row the word blitter handles; a row plus a 7-bit shift must fit in 32 bits
+#define RASTER_MAX_BLIT_WIDTH 25
+
+void raster_put_row_bits(const Raster* raster, uint16_t x, uint16_t y, uint32_t bits, uint8_t width);
+void raster_ink_row_bits(const Raster* raster, uint16_t x, uint16_t y, uint32_t bits, uint8_t width);
+void raster_hspan(const Raster* raster, uint16_t x, uint16_t y, uint16_t width, uint8_t color);
+void raster_vspan(const Raster* raster, uint16_t x, uint16_t y, uint16_t height, uint8_t color);
+void raster_fill_rect(const Raster* raster, uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t color);
+void raster_draw_line(const Raster* raster, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t color);
+void raster_put_bitmap(const Raster* raster, uint16_t x, uint16_t y, const uint8_t* bitmap, uint16_t width,
+    uint16_t height, bool invert);
+void raster_draw_glyph(const Raster* raster, uint16_t x, uint16_t y, const Font* font, const Glyph* glyph);
+uint32_t raster_draw_glyphs(const Raster* raster, uint32_t x, uint16_t y, const char* text, const char* end,
+    const Font* font);
+
+#endif
@@ -0,0 +1,177 @@
+#include <string.h>
+#include <sys/param.h>
+
+#include "rle.h"
+
+static void rle_put(rle_encoder* encoder, const uint8_t* data, size_t length)
+{
+    while (length > 0) {
+        size_t n = MIN(length, RLE_OUT_CHUNK - encoder->out_length);
+
+        memcpy(encoder->out + encoder->out_length, data, n);
+        encoder->out_length += n;
+        encoder->encoded += n;
+        data += n;
+        length -= n;
+
+        if (encoder->out_length == RLE_OUT_CHUNK) {
+            encoder->emit(encoder->out, encoder->out_length, encoder->ctx);
+            encoder->out_length = 0;
+        }
+    }
+}
+
+static void rle_flush_literal(rle_encoder* encoder)
+{
+    if (encoder->literal_length == 0) {
+        return;
+    }
+
+    uint8_t header = encoder->literal_length - 1;
+
+    rle_put(encoder, &header, 1);
+    rle_put(encoder, encoder->literal, encoder->literal_length);
+    encoder->literal_length = 0;
+}
+
+static void rle_flush_run(rle_encoder* encoder)
+{
+    if (encoder->run_length == 0) {
+        return;
+    }
+
+    uint8_t packet[2] = { (uint8_t) (257 - encoder->run_length), encoder->run_value };
+
+    rle_put(encoder, packet, sizeof(packet));
+    encoder->run_length = 0;
+}
+
+void rle_encoder_init(rle_encoder* encoder, rle_emit_fn emit, void* ctx)
+{
+    memset(encoder, 0, sizeof(*encoder));
+    encoder->emit = emit;
+    encoder->ctx = ctx;
+}
+
+/**
+ * Encodes the next piece of the input; pieces may split runs anywhere.
+ */
+void rle_encoder_feed(rle_encoder* encoder, const uint8_t* data, size_t length)
+{
+    for (size_t i = 0; i < length; i++) {
+        uint8_t b = data[i];
+
+        if (encoder->run_length > 0) {
+            if (b == encoder->run_value && encoder->run_length < 128) {
+                encoder->run_length++;
+                continue;
+            }
+            rle_flush_run(encoder);
+        }
+
+        uint8_t n = encoder->literal_length;
+
+        // Three equal bytes in a row start a run; two cost the same either way
+        if (n >= 2 && encoder->literal[n - 1] == b && encoder->literal[n - 2] == b) {
+            encoder->literal_length -= 2;
+            rle_flush_literal(encoder);
+            encoder->run_value = b;
+            encoder->run_length = 3;
+            continue;
+        }
+
+        encoder->literal[encoder->literal_length++] = b;
+        if (encoder->literal_length == sizeof(encoder->literal)) {
+            rle_flush_literal(encoder);
+        }
+    }
+}
+
+/**
+ * Emits everything still buffered; returns the total encoded size.
+ */
+size_t rle_encoder_finish(rle_encoder* encoder)
+{
+    rle_flush_run(encoder);
+    rle_flush_literal(encoder);
+
+    if (encoder->out_length > 0) {
+        encoder->emit(encoder->out, encoder->out_length, encoder->ctx);
+        encoder->out_length = 0;
+    }
+
+    return encoder->encoded;
+}
+
+/**
+ * Starts decoding into `sink`; more than `limit` decoded bytes is an error.
+ */
+void rle_decoder_init(rle_decoder* decoder, const rle_sink* sink, size_t limit)
+{
+    memset(decoder, 0, sizeof(*decoder));
+    decoder->state = RLE_STATE_HEADER;
+    decoder->sink = *sink;
+    decoder->limit = limit;
+}
+
+/**
+ * Decodes the next piece of the input; packets may be split anywhere.
+ */
+bool rle_decoder_feed(rle_decoder* decoder, const uint8_t* data, size_t length)
+{
+    size_t i = 0;
+
+    while (i < length && decoder->state != RLE_STATE_ERROR) {
+        switch (decoder->state) {
+        case RLE_STATE_HEADER: {
+            uint8_t header = data[i++];
+
+            if (header < 128) {
+                decoder->count = header + 1;
+                decoder->state = RLE_STATE_LITERAL;
+            } else if (header > 128) {
+                decoder->count = 257 - header;
+                decoder->state = RLE_STATE_RUN;
+            }
+
+            if (decoder->state != RLE_STATE_HEADER && decoder->decoded + decoder->count > decoder->limit) {
+                decoder->state = RLE_STATE_ERROR;
+            }
+            break;
+        }
+
+        case RLE_STATE_LITERAL: {
+            size_t n = MIN(length - i, decoder->count);
+
+            decoder->sink.write(data + i, n, decoder->sink.ctx);
+            decoder->decoded += n;
+            decoder->count -= n;
+            i += n;
+
+            if (decoder->count == 0) {
+                decoder->state = RLE_STATE_HEADER;
+            }
+            break;
+        }
+
+        case RLE_STATE_RUN:
+            decoder->sink.fill(data[i++], decoder->count, decoder->sink.ctx);
+            decoder->decoded += decoder->count;
+            decoder->state = RLE_STATE_HEADER;
+            break;
+
+        case RLE_STATE_ERROR:
+            break;
+        }
+    }
+
+    return decoder->state != RLE_STATE_ERROR;
+}
+
+/**
+ * Returns true when the input ended on a packet boundary after exactly `limit` bytes.
+ */
+bool rle_decoder_finish(const rle_decoder* decoder)
+{
+    return decoder->state == RLE_STATE_HEADER && decoder->decoded == decoder->limit;
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef ___RLE_H
+#define ___RLE_H
+
+/*
+ * PackBits run-length coding for 1-bit frames
+ *
+ * Each packet starts with a signed header byte n:
+ *   0..127     n + 1 literal bytes follow
+ *   -127..-1   the next byte is repeated 1 - n times (2..128)
+ *   -128       no-op
+ *
+ * A white 800x480 frame encodes to 750 bytes. Both directions are streaming and use no heap.
+ */
+
+// Encoded bytes buffered before they are handed to the emit callback
+#define RLE_OUT_CHUNK 256
+
+typedef void (*rle_emit_fn)(const uint8_t* data, size_t length, void* ctx);
+
+/**
+ * Where the decoder puts its output; `fill` writes `length` copies of `value`.
+ */
+typedef struct rle_sink {
+    void (*write)(const uint8_t* data, size_t length, void* ctx);
+    void (*fill)(uint8_t value, size_t length, void* ctx);
+    void* ctx;
+} rle_sink;
+
+typedef struct rle_encoder {
+    uint8_t literal[128];
+    uint8_t literal_length;
+    uint8_t run_value;
+    uint8_t run_length;
+    uint8_t out[RLE_OUT_CHUNK];
+    uint16_t out_length;
+    size_t encoded;
+    rle_emit_fn emit;
+    void* ctx;
+} rle_encoder;
+
+typedef enum rle_decoder_state {
+    RLE_STATE_HEADER,
+    RLE_STATE_LITERAL,
+    RLE_STATE_RUN,
+    RLE_STATE_ERROR,
+} rle_decoder_state;
+
+typedef struct rle_decoder {
+    rle_decoder_state state;
+    uint8_t count;
+    size_t decoded;
+    size_t limit;
+    rle_sink sink;
+} rle_decoder;
+
+void rle_encoder_init(rle_encoder* encoder, rle_emit_fn emit, void* ctx);
+void rle_encoder_feed(rle_encoder* encoder, const uint8_t* data, size_t length);
+size_t rle_encoder_finish(rle_encoder* encoder);
+
+void rle_decoder_init(rle_decoder* decoder, const rle_sink* sink, size_t limit);
+bool rle_decoder_feed(rle_decoder* decoder, const uint8_t* data, size_t length);
+bool rle_decoder_finish(const rle_decoder* decoder);
+
+#endif
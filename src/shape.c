@@ -0,0 +1,283 @@
+#include <math.h>
+#include <stdlib.h>
+#include <sys/param.h>
+
+#include "shape.h"
+
+// Polygon vertices are fixed point with this many fraction bits; a pixel's center is at +0.5
+#define SHAPE_FRACTION_BITS 8
+#define SHAPE_ONE (1 << SHAPE_FRACTION_BITS)
+#define SHAPE_HALF (SHAPE_ONE / 2)
+
+static uint32_t isqrt(uint32_t value)
+{
+    uint32_t root = 0;
+    uint32_t bit = 1u << 30;
+
+    while (bit > value) {
+        bit >>= 2;
+    }
+    while (bit) {
+        if (value >= root + bit) {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return root;
+}
+
+static int64_t div_ceil(int64_t a, int64_t b)
+{
+    if (b < 0) {
+        a = -a;
+        b = -b;
+    }
+
+    return a >= 0 ? (a + b - 1) / b : -(-a / b);
+}
+
+/**
+ * Sets columns [x1, x2] of row `y` to `color`; coordinates off the raster on any side are clipped.
+ */
+static void shape_span(const Raster* raster, int32_t x1, int32_t x2, int32_t y, uint8_t color)
+{
+    if (y < 0 || y > UINT16_MAX || x2 < 0 || x1 > x2 || x1 >= raster->width) {
+        return;
+    }
+
+    x1 = MAX(x1, 0);
+    raster_hspan(raster, x1, y, MIN(x2, raster->width - 1) - x1 + 1, color);
+}
+
+/**
+ * Columns [left, right] that `row` of a w x h rectangle with corners of radius `r` covers, relative to its left
+ * edge. A corner pixel is inside when its distance from the corner's center is at most r + 1/2, give or take.
+ */
+static void round_rect_row(int32_t w, int32_t h, int32_t r, int32_t row, int32_t* left, int32_t* right)
+{
+    // Distance from the nearer of the top and bottom edges
+    int32_t i = MIN(row, h - 1 - row);
+    int32_t inset = 0;
+
+    if (i < r) {
+        int32_t dy = r - i;
+        inset = r - isqrt((uint32_t) r * r + r - (uint32_t) dy * dy);
+    }
+
+    *left = inset;
+    *right = w - 1 - inset;
+}
+
+/**
+ * Draws rectangles, rounded rectangles and circles row by row as spans. An outline of thickness `t` is what is
+ * left of the shape after taking out the same shape inset by t on every side.
+ */
+static void shape_round_rect(const Raster* raster, int32_t x, int32_t y, int32_t w, int32_t h, int32_t r,
+    int32_t t, bool filled, uint8_t color)
+{
+    int32_t first = MAX(0, (int32_t) raster->top - y);
+    int32_t last = MIN(h, (int32_t) raster->top + raster->height - y);
+
+    r = MIN(r, MIN(w, h) / 2);
+    if (w - 2 * t <= 0 || h - 2 * t <= 0) {
+        filled = true;
+    }
+
+    for (int32_t row = first; row < last; row++) {
+        int32_t left;
+        int32_t right;
+        int32_t inner_left;
+        int32_t inner_right;
+
+        round_rect_row(w, h, r, row, &left, &right);
+
+        if (filled || row < t || row >= h - t) {
+            shape_span(raster, x + left, x + right, y + row, color);
+            continue;
+        }
+
+        round_rect_row(w - 2 * t, h - 2 * t, MAX(r - t, 0), row - t, &inner_left, &inner_right);
+        shape_span(raster, x + left, x + t + inner_left - 1, y + row, color);
+        shape_span(raster, x + t + inner_right + 1, x + right, y + row, color);
+    }
+}
+
+/**
+ * Scanline fill of a polygon with fixed point vertices: a pixel is set when its center is inside, or on a left
+ * or top edge. Crossings are kept sorted by insertion; there are at most as many as edges.
+ */
+static void shape_fill_polygon(const Raster* raster, const int32_t* xs, const int32_t* ys, uint8_t count,
+    uint8_t color)
+{
+    int32_t crossings[SHAPE_MAX_POINTS];
+    int32_t y_min = ys[0];
+    int32_t y_max = ys[0];
+
+    for (uint8_t i = 1; i < count; i++) {
+        y_min = MIN(y_min, ys[i]);
+        y_max = MAX(y_max, ys[i]);
+    }
+
+    // Rows whose centers are inside [y_min, y_max), limited to the rows the raster holds
+    int32_t first = MAX(div_ceil(y_min - SHAPE_HALF, SHAPE_ONE), (int32_t) raster->top);
+    int32_t last = MIN(div_ceil(y_max - SHAPE_HALF, SHAPE_ONE), (int32_t) raster->top + raster->height);
+
+    for (int32_t row = first; row < last; row++) {
+        int32_t center = row * SHAPE_ONE + SHAPE_HALF;
+        uint8_t n = 0;
+
+        for (uint8_t i = 0; i < count; i++) {
+            uint8_t j = i + 1 < count ? i + 1 : 0;
+
+            if ((ys[i] <= center) == (ys[j] <= center)) {
+                continue;
+            }
+
+            // Rounded up, so comparing with pixel centers below is exact
+            int32_t x = xs[i] + div_ceil((int64_t) (center - ys[i]) * (xs[j] - xs[i]), ys[j] - ys[i]);
+            uint8_t k = n++;
+
+            for (; k > 0 && crossings[k - 1] > x; k--) {
+                crossings[k] = crossings[k - 1];
+            }
+            crossings[k] = x;
+        }
+
+        for (uint8_t k = 0; k + 1 < n; k += 2) {
+            int32_t from = div_ceil(crossings[k] - SHAPE_HALF, SHAPE_ONE);
+            int32_t to = div_ceil(crossings[k + 1] - SHAPE_HALF, SHAPE_ONE);
+
+            shape_span(raster, from, to - 1, row, color);
+        }
+    }
+}
+
+/**
+ * A line `t` pixels wide is filled as the rectangle around the segment between the two pixel centers, with
+ * square ends flush with them.
+ */
+static void shape_thick_line(const Raster* raster, const Shape* shape, int32_t t, uint8_t color)
+{
+    float x1 = shape->x + 0.5f;
+    float y1 = shape->y + 0.5f;
+    float x2 = shape->x2 + 0.5f;
+    float y2 = shape->y2 + 0.5f;
+    float length = sqrtf((x2 - x1) * (x2 - x1) + (y2 - y1) * (y2 - y1));
+    // Unit normal, and half the width along it in fixed point
+    float nx = length > 0 ? -(y2 - y1) / length : 0;
+    float ny = length > 0 ? (x2 - x1) / length : 1;
+    float half = t * SHAPE_ONE / 2.0f;
+    int32_t xs[4];
+    int32_t ys[4];
+
+    if (length == 0) {
+        // A single point: a t x t square around it
+        shape_round_rect(raster, shape->x - t / 2, shape->y - t / 2, t, t, 0, t, true, color);
+        return;
+    }
+
+    xs[0] = lrintf(x1 * SHAPE_ONE + nx * half);
+    ys[0] = lrintf(y1 * SHAPE_ONE + ny * half);
+    xs[1] = lrintf(x2 * SHAPE_ONE + nx * half);
+    ys[1] = lrintf(y2 * SHAPE_ONE + ny * half);
+    xs[2] = lrintf(x2 * SHAPE_ONE - nx * half);
+    ys[2] = lrintf(y2 * SHAPE_ONE - ny * half);
+    xs[3] = lrintf(x1 * SHAPE_ONE - nx * half);
+    ys[3] = lrintf(y1 * SHAPE_ONE - ny * half);
+
+    shape_fill_polygon(raster, xs, ys, 4, color);
+}
+
+/**
+ * Draws `shape` in `color`, 1 = white, clipped to the raster.
+ */
+void shape_draw(const Raster* raster, const Shape* shape, uint8_t color)
+{
+    int32_t t = MAX(shape->thickness, 1);
+    bool filled = shape->flags & SHAPE_FILLED;
+    int32_t r = shape->radius;
+
+    switch (shape->type) {
+    case SHAPE_RECT:
+        shape_round_rect(raster, shape->x, shape->y, shape->width, shape->height, 0, t, filled, color);
+        break;
+    case SHAPE_ROUND_RECT:
+        shape_round_rect(raster, shape->x, shape->y, shape->width, shape->height, r, t, filled, color);
+        break;
+    case SHAPE_CIRCLE:
+        shape_round_rect(raster, shape->x - r, shape->y - r, 2 * r + 1, 2 * r + 1, r, t, filled, color);
+        break;
+    case SHAPE_LINE:
+        if (t == 1) {
+            raster_draw_line(raster, shape->x, shape->y, shape->x2, shape->y2, color);
+        } else {
+            shape_thick_line(raster, shape, t, color);
+        }
+        break;
+    case SHAPE_POLYGON: {
+        int32_t xs[SHAPE_MAX_POINTS];
+        int32_t ys[SHAPE_MAX_POINTS];
+        uint8_t count = MIN(shape->count, SHAPE_MAX_POINTS);
+
+        if (count < 3) {
+            break;
+        }
+        for (uint8_t i = 0; i < count; i++) {
+            xs[i] = shape->points[i].x * SHAPE_ONE;
+            ys[i] = shape->points[i].y * SHAPE_ONE;
+        }
+        shape_fill_polygon(raster, xs, ys, count, color);
+        break;
+    }
+    }
+}
+
+/**
+ * The area `shape` can touch, a pixel larger than needed for thick lines.
+ */
+void shape_bounds(const Shape* shape, Rect* bounds)
+{
+    int32_t t = MAX(shape->thickness, 1);
+    int32_t x1 = shape->x;
+    int32_t y1 = shape->y;
+    int32_t x2 = (int32_t) shape->x + shape->width;
+    int32_t y2 = (int32_t) shape->y + shape->height;
+
+    switch (shape->type) {
+    case SHAPE_CIRCLE:
+        x1 = shape->x - shape->radius;
+        y1 = shape->y - shape->radius;
+        x2 = shape->x + shape->radius + 1;
+        y2 = shape->y + shape->radius + 1;
+        break;
+    case SHAPE_LINE:
+        x1 = MIN(shape->x, shape->x2) - t / 2 - 1;
+        y1 = MIN(shape->y, shape->y2) - t / 2 - 1;
+        x2 = MAX(shape->x, shape->x2) + t / 2 + 2;
+        y2 = MAX(shape->y, shape->y2) + t / 2 + 2;
+        break;
+    case SHAPE_POLYGON:
+        x1 = x2 = shape->count ? shape->points[0].x : 0;
+        y1 = y2 = shape->count ? shape->points[0].y : 0;
+        for (uint8_t i = 1; i < MIN(shape->count, SHAPE_MAX_POINTS); i++) {
+            x1 = MIN(x1, shape->points[i].x);
+            y1 = MIN(y1, shape->points[i].y);
+            x2 = MAX(x2, shape->points[i].x);
+            y2 = MAX(y2, shape->points[i].y);
+        }
+        break;
+    default:
+        break;
+    }
+
+    x1 = MAX(x1, 0);
+    y1 = MAX(y1, 0);
+    x2 = MIN(x2, UINT16_MAX);
+    y2 = MIN(y2, UINT16_MAX);
+
+    *bounds = (Rect) { .x = x1, .y = y1, .w = MAX(x2 - x1, 0), .h = MAX(y2 - y1, 0) };
+}
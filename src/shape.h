@@ -0,0 +1,55 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "damage.h"
+#include "raster.h"
+
+#ifndef ___SHAPE_H
+#define ___SHAPE_H
+
+#define SHAPE_RECT 0
+// A rectangle with quarter-circle corners of `radius`
+#define SHAPE_ROUND_RECT 1
+// Centered on (x, y), 2 * radius + 1 pixels across
+#define SHAPE_CIRCLE 2
+// From (x, y) to (x2, y2), `thickness` pixels wide
+#define SHAPE_LINE 3
+// Always filled; the outline is closed from the last point back to the first
+#define SHAPE_POLYGON 4
+
+// Fill the shape instead of drawing a `thickness` pixel wide outline
+#define SHAPE_FILLED 0x01
+
+// Most points of a polygon
+#define SHAPE_MAX_POINTS 32
+
+typedef struct ShapePoint {
+    uint16_t x;
+    uint16_t y;
+} ShapePoint;
+
+/**
+ * A shape in screen coordinates; which fields are used depends on the type.
+ */
+typedef struct Shape {
+    uint8_t type;
+    uint8_t flags;
+    // Outline or line width, at least 1
+    uint8_t thickness;
+    uint16_t x;
+    uint16_t y;
+    uint16_t x2; // line end
+    uint16_t y2; // line end
+    uint16_t width; // rectangles
+    uint16_t height; // rectangles
+    uint16_t radius; // circles and rounded corners
+    const ShapePoint* points; // polygon
+    uint8_t count;
+} Shape;
+
+void shape_draw(const Raster* raster, const Shape* shape, uint8_t color);
+void shape_bounds(const Shape* shape, Rect* bounds);
+
+#endif
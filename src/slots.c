@@ -0,0 +1,465 @@
+#include <ctype.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "esp_rom_crc.h"
+#include "esp_timer.h"
+
+#include "slots.h"
+
+// "SLOT" little endian; erased flash reads 0xffffffff
+#define SLOTS_MAGIC 0x544f4c53
+
+#define SLOTS_FLAG_BLACK 0x01
+#define SLOTS_FLAG_RED 0x02
+
+static const char* TAG = "slots.c";
+
+/**
+ * Starts a copy and is written last, after the scene and the planes that follow it: a copy cut short by a reset
+ * has no header and the previous one stays the slot's content.
+ */
+typedef struct slot_header {
+    uint32_t magic;
+    uint32_t sequence;
+    char name[SLOTS_NAME_MAX_LEN + 1];
+    uint8_t flags;
+    uint8_t screen_color;
+    uint16_t reserved;
+    uint32_t plane_size;
+    uint32_t scene_size;
+    // CRC-32 of the scene and the planes, padding left out
+    uint32_t crc;
+} slot_header;
+
+_Static_assert(sizeof(slot_header) % 4 == 0, "the scene follows the header 4-byte aligned");
+
+static const esp_partition_t* partition;
+// The whole partition, mapped once; writes through esp_partition_write() show up here
+static const uint8_t* mapped;
+static esp_partition_mmap_handle_t mmap_handle;
+// Bytes per copy, a multiple of the erase size
+static uint32_t copy_size;
+// Saves run in the display task while requests list and load
+static SemaphoreHandle_t slots_mutex;
+static slots_stats stats;
+
+static inline uint32_t align4(uint32_t size)
+{
+    return (size + 3) & ~3u;
+}
+
+static inline uint32_t copy_offset(uint8_t area, uint8_t copy)
+{
+    return (area * SLOTS_COPIES + copy) * copy_size;
+}
+
+static inline const slot_header* copy_header(uint8_t area, uint8_t copy)
+{
+    return (const slot_header*) (mapped + copy_offset(area, copy));
+}
+
+static uint32_t record_size(uint8_t flags, uint32_t plane_size, uint32_t scene_size)
+{
+    uint32_t planes = ((flags & SLOTS_FLAG_BLACK) ? 1 : 0) + ((flags & SLOTS_FLAG_RED) ? 1 : 0);
+
+    return sizeof(slot_header) + align4(scene_size) + planes * align4(plane_size);
+}
+
+static bool header_valid(const slot_header* header)
+{
+    return header->magic == SLOTS_MAGIC && header->name[SLOTS_NAME_MAX_LEN] == '\0'
+        && header->plane_size <= copy_size && header->scene_size <= copy_size
+        && record_size(header->flags, header->plane_size, header->scene_size) <= copy_size;
+}
+
+/**
+ * Returns the copy with the highest sequence number among those with a valid header and not in the bit mask
+ * `skipped`, or -1.
+ */
+static int newest_copy_except(uint8_t area, uint32_t skipped)
+{
+    int newest = -1;
+
+    for (uint8_t copy = 0; copy < SLOTS_COPIES; copy++) {
+        const slot_header* header = copy_header(area, copy);
+
+        if (!(skipped & (1u << copy)) && header_valid(header)
+            && (newest < 0 || (int32_t) (header->sequence - copy_header(area, newest)->sequence) > 0)) {
+            newest = copy;
+        }
+    }
+
+    return newest;
+}
+
+static inline int newest_copy(uint8_t area)
+{
+    return newest_copy_except(area, 0);
+}
+
+static int find_area(const char* name)
+{
+    for (uint8_t area = 0; area < SLOTS_COUNT; area++) {
+        int copy = newest_copy(area);
+
+        if (copy >= 0 && strcmp(copy_header(area, copy)->name, name) == 0) {
+            return area;
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * Points `image` at the parts of a copy, in the order they are stored: scene, black plane, red plane.
+ */
+static void image_from_copy(const slot_header* header, slot_image* image)
+{
+    const uint8_t* data = (const uint8_t*) (header + 1);
+
+    image->scene = header->scene_size ? data : NULL;
+    image->scene_size = header->scene_size;
+    data += align4(header->scene_size);
+
+    image->black = (header->flags & SLOTS_FLAG_BLACK) ? data : NULL;
+    data += image->black ? align4(header->plane_size) : 0;
+
+    image->red = (header->flags & SLOTS_FLAG_RED) ? data : NULL;
+    image->plane_size = header->plane_size;
+    image->screen_color = header->screen_color;
+}
+
+static uint32_t image_crc(const slot_image* image)
+{
+    uint32_t crc = esp_rom_crc32_le(0, image->scene, image->scene ? image->scene_size : 0);
+
+    crc = esp_rom_crc32_le(crc, image->black, image->black ? image->plane_size : 0);
+    crc = esp_rom_crc32_le(crc, image->red, image->red ? image->plane_size : 0);
+
+    return crc;
+}
+
+/**
+ * Returns the newest copy whose data matches its CRC, or -1.
+ */
+static int newest_intact_copy(uint8_t area)
+{
+    uint32_t damaged = 0;
+    int copy;
+
+    while ((copy = newest_copy_except(area, damaged)) >= 0) {
+        const slot_header* header = copy_header(area, copy);
+        slot_image image;
+
+        image_from_copy(header, &image);
+        if (image_crc(&image) == header->crc) {
+            return copy;
+        }
+
+        ESP_LOGW(TAG, "copy %d of slot \"%s\" is damaged", copy, header->name);
+        damaged |= 1u << copy;
+    }
+
+    return -1;
+}
+
+static inline bool part_equal(const uint8_t* a, const uint8_t* b, uint32_t size)
+{
+    return a == NULL ? b == NULL : b != NULL && memcmp(a, b, size) == 0;
+}
+
+static bool image_equal(const slot_image* a, const slot_image* b)
+{
+    return a->screen_color == b->screen_color && a->scene_size == b->scene_size && a->plane_size == b->plane_size
+        && part_equal(a->scene, b->scene, a->scene_size) && part_equal(a->black, b->black, a->plane_size)
+        && part_equal(a->red, b->red, a->plane_size);
+}
+
+static bool write_part(uint32_t* offset, const uint8_t* data, uint32_t size)
+{
+    if (!data || size == 0) {
+        return true;
+    }
+
+    if (esp_partition_write(partition, *offset, data, size) != ESP_OK) {
+        return false;
+    }
+
+    stats.bytes_written += size;
+    *offset += align4(size);
+
+    return true;
+}
+
+/**
+ * Slot names are 1 to SLOTS_NAME_MAX_LEN letters, digits, '-' or '_'.
+ */
+bool slots_name_valid(const char* name)
+{
+    size_t length = strnlen(name, SLOTS_NAME_MAX_LEN + 1);
+
+    if (length == 0 || length > SLOTS_NAME_MAX_LEN) {
+        return false;
+    }
+
+    for (size_t i = 0; i < length; i++) {
+        if (!isalnum((unsigned char) name[i]) && name[i] != '-' && name[i] != '_') {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Finds the partition and maps it; without it every other call fails.
+ */
+bool slots_init()
+{
+    if (partition) {
+        return true;
+    }
+
+    if (!slots_mutex) {
+        slots_mutex = xSemaphoreCreateMutex();
+    }
+
+    const esp_partition_t* found
+        = esp_partition_find_first(SLOTS_PARTITION_TYPE, SLOTS_PARTITION_SUBTYPE, SLOTS_PARTITION_LABEL);
+    if (!found) {
+        ESP_LOGW(TAG, "no \"%s\" partition, slots are not available", SLOTS_PARTITION_LABEL);
+        return false;
+    }
+
+    const void* ptr;
+    esp_err_t err = esp_partition_mmap(found, 0, found->size, ESP_PARTITION_MMAP_DATA, &ptr, &mmap_handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "failed to map the \"%s\" partition: %s", SLOTS_PARTITION_LABEL, esp_err_to_name(err));
+        return false;
+    }
+
+    mapped = ptr;
+    copy_size = found->size / (SLOTS_COUNT * SLOTS_COPIES) / found->erase_size * found->erase_size;
+    partition = found;
+
+    ESP_LOGI(TAG, "%d slots of %lu bytes, %d copies each", SLOTS_COUNT, (unsigned long) copy_size, SLOTS_COPIES);
+
+    return true;
+}
+
+/**
+ * Saves `image` under `name`, into the slot's area or a free one. The copy written is the one after the newest
+ * intact one, so successive saves spread the erases over the area's copies and a reset during the write still
+ * leaves that one to load; only the sectors the image needs are erased. Nothing is written when the slot already
+ * holds the same image.
+ */
+bool slots_save(const char* name, const slot_image* image)
+{
+    // Left-out parts have no size, the same as in a loaded image
+    slot_image parts = *image;
+    uint8_t flags = (parts.black ? SLOTS_FLAG_BLACK : 0) | (parts.red ? SLOTS_FLAG_RED : 0);
+    bool ok = false;
+
+    if (!parts.scene || parts.scene_size == 0) {
+        parts.scene = NULL;
+        parts.scene_size = 0;
+    }
+    if (!flags) {
+        parts.plane_size = 0;
+    }
+
+    uint32_t size = record_size(flags, parts.plane_size, parts.scene_size);
+
+    if (!partition || !slots_name_valid(name)) {
+        return false;
+    }
+    if (size > copy_size) {
+        ESP_LOGE(TAG, "%lu bytes do not fit into a slot of %lu", (unsigned long) size, (unsigned long) copy_size);
+        return false;
+    }
+
+    xSemaphoreTake(slots_mutex, portMAX_DELAY);
+
+    int64_t start = esp_timer_get_time();
+    int area = find_area(name);
+
+    for (uint8_t i = 0; i < SLOTS_COUNT && area < 0; i++) {
+        if (newest_copy(i) < 0) {
+            area = i;
+        }
+    }
+
+    if (area < 0) {
+        ESP_LOGW(TAG, "no free slot for \"%s\"", name);
+        stats.failures++;
+        xSemaphoreGive(slots_mutex);
+        return false;
+    }
+
+    int newest = newest_copy(area);
+    int intact = newest >= 0 ? newest_intact_copy(area) : -1;
+
+    if (intact >= 0) {
+        slot_image saved;
+
+        image_from_copy(copy_header(area, intact), &saved);
+        if (image_equal(&parts, &saved)) {
+            stats.unchanged++;
+            xSemaphoreGive(slots_mutex);
+            return true;
+        }
+    }
+
+    // Newer copies than the intact one are damaged and are written over first
+    int after = intact >= 0 ? intact : newest;
+    uint8_t copy = after < 0 ? 0 : (after + 1) % SLOTS_COPIES;
+    uint32_t offset = copy_offset(area, copy);
+    uint32_t erase_size = (size + partition->erase_size - 1) / partition->erase_size * partition->erase_size;
+    slot_header header = {
+        .magic = SLOTS_MAGIC,
+        .sequence = newest < 0 ? 1 : copy_header(area, newest)->sequence + 1,
+        .flags = flags,
+        .screen_color = parts.screen_color,
+        .plane_size = parts.plane_size,
+        .scene_size = parts.scene_size,
+        .crc = image_crc(&parts),
+    };
+    uint32_t data_offset = offset + sizeof(header);
+
+    strncpy(header.name, name, SLOTS_NAME_MAX_LEN);
+
+    if (esp_partition_erase_range(partition, offset, erase_size) == ESP_OK) {
+        stats.sectors_erased += erase_size / partition->erase_size;
+
+        ok = write_part(&data_offset, parts.scene, header.scene_size)
+            && write_part(&data_offset, parts.black, parts.plane_size)
+            && write_part(&data_offset, parts.red, parts.plane_size)
+            && esp_partition_write(partition, offset, &header, sizeof(header)) == ESP_OK;
+    }
+
+    if (ok) {
+        stats.saves++;
+        stats.bytes_written += sizeof(header);
+        stats.last_save_us = esp_timer_get_time() - start;
+        ESP_LOGI(TAG, "saved \"%s\" (%lu bytes) to slot %d, copy %u in %lu us", name, (unsigned long) size, area,
+            copy, (unsigned long) stats.last_save_us);
+    } else {
+        stats.failures++;
+        ESP_LOGE(TAG, "failed to save \"%s\"", name);
+    }
+
+    xSemaphoreGive(slots_mutex);
+
+    return ok;
+}
+
+/**
+ * Points `image` at the newest copy of the slot whose data matches its CRC, in place in flash; a damaged copy gives
+ * way to the one saved before it. False when there is no intact copy.
+ */
+bool slots_load(const char* name, slot_image* image)
+{
+    bool ok = false;
+
+    if (!partition) {
+        return false;
+    }
+
+    xSemaphoreTake(slots_mutex, portMAX_DELAY);
+
+    int area = find_area(name);
+
+    if (area >= 0) {
+        int copy = newest_intact_copy(area);
+
+        ok = copy >= 0;
+        if (ok) {
+            image_from_copy(copy_header(area, copy), image);
+        } else {
+            ESP_LOGE(TAG, "slot \"%s\" is damaged", name);
+            stats.failures++;
+        }
+    }
+
+    if (ok) {
+        stats.loads++;
+    }
+
+    xSemaphoreGive(slots_mutex);
+
+    return ok;
+}
+
+/**
+ * Frees the slot by erasing the sectors with its copies' headers.
+ */
+bool slots_delete(const char* name)
+{
+    bool ok = true;
+
+    if (!partition) {
+        return false;
+    }
+
+    xSemaphoreTake(slots_mutex, portMAX_DELAY);
+
+    int area = find_area(name);
+
+    for (uint8_t copy = 0; copy < SLOTS_COPIES && area >= 0; copy++) {
+        if (copy_header(area, copy)->magic == 0xffffffff) {
+            continue;
+        }
+
+        ok &= esp_partition_erase_range(partition, copy_offset(area, copy), partition->erase_size) == ESP_OK;
+        stats.sectors_erased++;
+    }
+
+    xSemaphoreGive(slots_mutex);
+
+    return area >= 0 && ok;
+}
+
+/**
+ * Fills `slots` with the saved slots in partition order and returns how many there are, at most `max`.
+ */
+size_t slots_list(slot_info* slots, size_t max)
+{
+    size_t count = 0;
+
+    if (!partition) {
+        return 0;
+    }
+
+    xSemaphoreTake(slots_mutex, portMAX_DELAY);
+
+    for (uint8_t area = 0; area < SLOTS_COUNT && count < max; area++) {
+        int copy = newest_copy(area);
+
+        if (copy < 0) {
+            continue;
+        }
+
+        const slot_header* header = copy_header(area, copy);
+        slot_info* info = &slots[count++];
+
+        memcpy(info->name, header->name, sizeof(info->name));
+        info->sequence = header->sequence;
+        info->black = header->flags & SLOTS_FLAG_BLACK;
+        info->red = header->flags & SLOTS_FLAG_RED;
+        info->scene_size = header->scene_size;
+    }
+
+    xSemaphoreGive(slots_mutex);
+
+    return count;
+}
+
+void slots_get_stats(slots_stats* out)
+{
+    *out = stats;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef ___SLOTS_H
+#define ___SLOTS_H
+
+// Partition holding the slots, see partitions.csv
+#define SLOTS_PARTITION_LABEL "frames"
+#define SLOTS_PARTITION_TYPE 0x40
+#define SLOTS_PARTITION_SUBTYPE 0x00
+
+// Equal areas the partition is split into, one per slot
+#define SLOTS_COUNT 4
+// Copies per area that saves rotate through; the newest complete one is the slot's content
+#define SLOTS_COPIES 2
+#define SLOTS_NAME_MAX_LEN 15
+
+/**
+ * A saved screen: the black/white and the red plane in framebuffer layout, either of which may be left out, the
+ * display list as dlist_serialize() writes it and the screen color. Loaded images point into the mapped
+ * partition and stay valid until the slot is saved again or deleted.
+ */
+typedef struct slot_image {
+    const uint8_t* black;
+    const uint8_t* red;
+    uint32_t plane_size;
+    const uint8_t* scene;
+    uint32_t scene_size;
+    uint8_t screen_color;
+} slot_image;
+
+typedef struct slot_info {
+    char name[SLOTS_NAME_MAX_LEN + 1];
+    // Saves into this slot's area so far
+    uint32_t sequence;
+    bool black;
+    bool red;
+    uint32_t scene_size;
+} slot_info;
+
+typedef struct slots_stats {
+    uint32_t saves;
+    // Saves left out because the slot already held the same content
+    uint32_t unchanged;
+    uint32_t loads;
+    uint32_t failures;
+    uint32_t sectors_erased;
+    uint64_t bytes_written;
+    uint32_t last_save_us;
+} slots_stats;
+
+bool slots_init();
+bool slots_name_valid(const char* name);
+
+bool slots_save(const char* name, const slot_image* image);
+bool slots_load(const char* name, slot_image* image);
+bool slots_delete(const char* name);
+size_t slots_list(slot_info* slots, size_t max);
+
+void slots_get_stats(slots_stats* stats);
+
+#endif
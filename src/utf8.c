@@ -0,0 +1,81 @@
+#include <string.h>
+
+#include "utf8.h"
+
+/**
+ * Decodes the code point at `*text` and advances past it; returns 0 at the terminating NUL.
+ *
+ * Malformed input (stray continuation bytes, truncated or overlong sequences, surrogates, values above
+ * U+10FFFF) decodes to U+FFFD, consuming only the bytes that belong to the broken sequence.
+ */
+uint32_t utf8_next(const char** text)
+{
+    const uint8_t* p = (const uint8_t*) *text;
+    uint32_t c = p[0];
+    uint8_t extra;
+    uint32_t min;
+
+    if (c == 0) {
+        return 0;
+    }
+    if (c < 0x80) {
+        *text += 1;
+        return c;
+    }
+
+    if ((c & 0xe0) == 0xc0) {
+        extra = 1;
+        min = 0x80;
+        c &= 0x1f;
+    } else if ((c & 0xf0) == 0xe0) {
+        extra = 2;
+        min = 0x800;
+        c &= 0x0f;
+    } else if ((c & 0xf8) == 0xf0) {
+        extra = 3;
+        min = 0x10000;
+        c &= 0x07;
+    } else {
+        *text += 1;
+        return UTF8_REPLACEMENT_CHAR;
+    }
+
+    for (uint8_t i = 1; i <= extra; i++) {
+        if ((p[i] & 0xc0) != 0x80) {
+            // Also stops at the NUL, so a truncated sequence never reads past the string
+            *text += i;
+            return UTF8_REPLACEMENT_CHAR;
+        }
+        c = (c << 6) | (p[i] & 0x3f);
+    }
+
+    *text += 1 + extra;
+
+    if (c < min || c > 0x10ffff || (c >= 0xd800 && c <= 0xdfff)) {
+        return UTF8_REPLACEMENT_CHAR;
+    }
+
+    return c;
+}
+
+/**
+ * Drops a multi-byte sequence cut off at the end of `text`, as left behind by truncating to a byte limit.
+ */
+void utf8_trim(char* text)
+{
+    size_t length = strlen(text);
+
+    for (size_t i = 1; i <= 3 && i <= length; i++) {
+        uint8_t c = text[length - i];
+
+        if ((c & 0xc0) == 0x80) {
+            continue;
+        }
+
+        uint8_t needed = (c & 0xe0) == 0xc0 ? 2 : (c & 0xf0) == 0xe0 ? 3 : (c & 0xf8) == 0xf0 ? 4 : 1;
+        if (needed > i) {
+            text[length - i] = '\0';
+        }
+        return;
+    }
+}
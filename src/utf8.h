@@ -0,0 +1,13 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifndef ___UTF8_H
+#define ___UTF8_H
+
+#define UTF8_REPLACEMENT_CHAR 0xfffd
+
+uint32_t utf8_next(const char** text);
+void utf8_trim(char* text);
+
+#endif
@@ -0,0 +1,321 @@
+/**
+ * Compiles TrueType/OpenType fonts into the glyph tables of src/font.h, without a browser in the loop.
+ *
+ *   fontc [-s pixels] [-c code points] [-t threshold] [-H hinting] [-z] font.ttf:symbol:name... > font_x.c
+ *
+ *   -s  pixel size of the em, default 24
+ *   -c  code points to include, e.g. 0x20-0x7e,0xa0-0xff,0x20ac; default 0x20-0x7e
+ *   -t  coverage threshold 1-255 for grayscale rendering, default 128; 0 renders bi-level directly
+ *   -H  none, light, normal or mono (hinting for bi-level output), default normal
+ *   -z  RLE-encode the glyphs; they are decoded through the glyph cache when drawn
+ *
+ * Code points the font has no glyph for are left out and drawn with the font's .notdef glyph, which becomes
+ * the fallback. The output only depends on the arguments, the font files and the FreeType version.
+ *
+ *   fontc -s 20 -c 0x20-0x7e,0xb0,0x20ac DejaVuSans.ttf:font_dejavu_sans_20:"DejaVu Sans" > ../src/font_dejavu.c
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#include "font.h"
+#include "fontgen.h"
+
+#define MAX_FONTS 8
+#define MAX_CODEPOINT_RANGES 64
+
+typedef struct font_spec {
+    const char* path;
+    const char* symbol;
+    const char* name;
+} font_spec;
+
+static int pixel_size = 24;
+static int threshold = 128;
+static FT_Int32 load_flags = FT_LOAD_DEFAULT;
+static FT_Render_Mode render_mode = FT_RENDER_MODE_NORMAL;
+static int encoding = FONT_ENCODING_RAW;
+
+static uint32_t codepoint_ranges[MAX_CODEPOINT_RANGES][2] = { { 0x20, 0x7e } };
+static int num_codepoint_ranges = 1;
+
+static int compare_ranges(const void* a, const void* b)
+{
+    const uint32_t* ra = a;
+    const uint32_t* rb = b;
+
+    return ra[0] < rb[0] ? -1 : ra[0] > rb[0];
+}
+
+/**
+ * Parses "a-b,c,..." into sorted, non-overlapping ranges.
+ */
+static int parse_codepoints(char* arg)
+{
+    char* item;
+    int count = 0;
+
+    while ((item = strsep(&arg, ",")) != NULL) {
+        char* end;
+        uint32_t first = strtoul(item, &end, 0);
+        uint32_t last = first;
+
+        if (*end == '-') {
+            last = strtoul(end + 1, &end, 0);
+        }
+        if (end == item || *end != '\0' || last < first || last > 0x10ffff || count == MAX_CODEPOINT_RANGES) {
+            fprintf(stderr, "invalid code point range: %s\n", item);
+            return 0;
+        }
+
+        codepoint_ranges[count][0] = first;
+        codepoint_ranges[count][1] = last;
+        count++;
+    }
+
+    qsort(codepoint_ranges, count, sizeof(codepoint_ranges[0]), compare_ranges);
+
+    for (int i = 1; i < count; i++) {
+        if (codepoint_ranges[i][0] <= codepoint_ranges[i - 1][1]) {
+            fprintf(stderr, "overlapping code point ranges\n");
+            return 0;
+        }
+    }
+
+    num_codepoint_ranges = count;
+
+    return 1;
+}
+
+static int parse_hinting(const char* arg)
+{
+    if (strcmp(arg, "none") == 0) {
+        load_flags = FT_LOAD_NO_HINTING;
+    } else if (strcmp(arg, "light") == 0) {
+        load_flags = FT_LOAD_TARGET_LIGHT;
+    } else if (strcmp(arg, "normal") == 0) {
+        load_flags = FT_LOAD_TARGET_NORMAL;
+    } else if (strcmp(arg, "mono") == 0) {
+        load_flags = FT_LOAD_TARGET_MONO;
+    } else {
+        return 0;
+    }
+
+    return 1;
+}
+
+/**
+ * Renders glyph `index` and crops it into `glyph`; the bitmap is placed relative to the pen at the top of the
+ * line, `baseline` pixels above the origin FreeType renders against.
+ */
+static int render_glyph(FT_Face face, FT_UInt index, int baseline, fontgen_glyph* glyph)
+{
+    if (FT_Load_Glyph(face, index, load_flags) != 0 || FT_Render_Glyph(face->glyph, render_mode) != 0) {
+        return 0;
+    }
+
+    FT_GlyphSlot slot = face->glyph;
+    FT_Bitmap* bitmap = &slot->bitmap;
+    uint8_t* cell = calloc(bitmap->rows * bitmap->width + 1, 1);
+
+    for (unsigned int y = 0; y < bitmap->rows; y++) {
+        const uint8_t* row = bitmap->buffer + y * bitmap->pitch;
+
+        for (unsigned int x = 0; x < bitmap->width; x++) {
+            if (bitmap->pixel_mode == FT_PIXEL_MODE_MONO) {
+                cell[y * bitmap->width + x] = (row[x / 8] >> (7 - x % 8)) & 1;
+            } else {
+                cell[y * bitmap->width + x] = row[x] >= threshold;
+            }
+        }
+    }
+
+    fontgen_crop(glyph, cell, bitmap->width, bitmap->rows, slot->bitmap_left, baseline - slot->bitmap_top);
+    glyph->advance = (slot->advance.x + 32) >> 6;
+    free(cell);
+
+    return 1;
+}
+
+static int compile(FT_Library library, const font_spec* spec)
+{
+    FT_Face face;
+
+    if (FT_New_Face(library, spec->path, 0, &face) != 0) {
+        fprintf(stderr, "%s: cannot open font\n", spec->path);
+        return 0;
+    }
+    if (FT_Set_Pixel_Sizes(face, 0, pixel_size) != 0) {
+        fprintf(stderr, "%s: cannot set a %d px size\n", spec->path, pixel_size);
+        FT_Done_Face(face);
+        return 0;
+    }
+
+    int ascender = (face->size->metrics.ascender + 63) >> 6;
+    int descender = (-face->size->metrics.descender + 63) >> 6;
+    size_t capacity = 1;
+
+    for (int i = 0; i < num_codepoint_ranges; i++) {
+        capacity += codepoint_ranges[i][1] - codepoint_ranges[i][0] + 1;
+    }
+
+    fontgen_font font = {
+        .encoding = encoding,
+        .symbol = spec->symbol,
+        .name = spec->name,
+        .line_height = ascender + descender,
+        .baseline = ascender,
+        .glyphs = calloc(capacity, sizeof(fontgen_glyph)),
+    };
+    int missing = 0;
+    int ok = 1;
+
+    for (int i = 0; i < num_codepoint_ranges && ok; i++) {
+        for (uint32_t c = codepoint_ranges[i][0]; c <= codepoint_ranges[i][1] && ok; c++) {
+            FT_UInt index = FT_Get_Char_Index(face, c);
+
+            if (index == 0) {
+                missing++;
+                continue;
+            }
+
+            fontgen_glyph* glyph = &font.glyphs[font.num_glyphs++];
+            glyph->codepoint = c;
+            ok = render_glyph(face, index, ascender, glyph);
+        }
+    }
+
+    // Glyph index 0 is the font's .notdef glyph; some fonts leave it empty
+    fontgen_glyph* fallback = &font.glyphs[font.num_glyphs++];
+    fallback->codepoint = -1;
+    ok = ok && render_glyph(face, 0, ascender, fallback);
+    if (ok && fallback->width == 0 && fallback->advance > 4) {
+        fontgen_box(fallback, fallback->advance, font.line_height / 6, ascender - 1);
+    }
+
+    if (!ok) {
+        fprintf(stderr, "%s: rendering failed\n", spec->path);
+    } else if (font.num_glyphs == 1) {
+        fprintf(stderr, "%s: none of the code points are in the font\n", spec->path);
+        ok = 0;
+    } else {
+        if (missing > 0) {
+            fprintf(stderr, "%s: %d code points not in the font, drawn with the fallback glyph\n", spec->symbol,
+                missing);
+        }
+        ok = fontgen_emit(stdout, &font) > 0;
+    }
+
+    fontgen_free(&font);
+    FT_Done_Face(face);
+
+    return ok;
+}
+
+static int parse_spec(char* arg, font_spec* spec)
+{
+    // Split from the right so the path may contain colons
+    char* name = strrchr(arg, ':');
+    if (!name || name == arg) {
+        return 0;
+    }
+    *name++ = '\0';
+
+    char* symbol = strrchr(arg, ':');
+    if (!symbol || symbol == arg) {
+        return 0;
+    }
+    *symbol++ = '\0';
+
+    spec->path = arg;
+    spec->symbol = symbol;
+    spec->name = name;
+
+    return 1;
+}
+
+static int usage()
+{
+    fprintf(stderr, "usage: fontc [-s pixels] [-c code points] [-t threshold] [-H none|light|normal|mono] [-z] "
+                    "font.ttf:symbol:name...\n");
+    return 1;
+}
+
+int main(int argc, char** argv)
+{
+    font_spec specs[MAX_FONTS];
+    int num_specs = 0;
+    char command[1024] = "";
+
+    // Recorded in the output before parse_spec() splits the arguments; directories are left out so the output
+    // does not depend on where the font files are
+    for (int i = 1; i < argc; i++) {
+        const char* arg = strrchr(argv[i], '/') ? strrchr(argv[i], '/') + 1 : argv[i];
+        snprintf(command + strlen(command), sizeof(command) - strlen(command), " %s", arg);
+    }
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-z") == 0) {
+            encoding = FONT_ENCODING_RLE;
+        } else if (argv[i][0] == '-' && argv[i][1] && !argv[i][2] && i + 1 < argc) {
+            char* value = argv[++i];
+
+            switch (argv[i - 1][1]) {
+            case 's':
+                pixel_size = atoi(value);
+                break;
+            case 'c':
+                if (!parse_codepoints(value)) {
+                    return 1;
+                }
+                break;
+            case 't':
+                threshold = atoi(value);
+                break;
+            case 'H':
+                if (!parse_hinting(value)) {
+                    return usage();
+                }
+                break;
+            default:
+                return usage();
+            }
+        } else if (num_specs < MAX_FONTS && parse_spec(argv[i], &specs[num_specs])) {
+            num_specs++;
+        } else {
+            return usage();
+        }
+    }
+
+    if (num_specs == 0 || pixel_size <= 0 || threshold < 0 || threshold > 255) {
+        return usage();
+    }
+
+    // Bi-level rendering for mono hinting or a zero threshold; otherwise grayscale cut at the threshold
+    if (threshold == 0 || load_flags == FT_LOAD_TARGET_MONO) {
+        render_mode = FT_RENDER_MODE_MONO;
+    }
+
+    FT_Library library;
+    if (FT_Init_FreeType(&library) != 0) {
+        fprintf(stderr, "cannot initialize FreeType\n");
+        return 1;
+    }
+
+    printf("// Generated by tools/fontc:%s\n", command);
+    printf("#include <stdint.h>\n\n#include \"font.h\"\n");
+
+    int ok = 1;
+    for (int i = 0; i < num_specs && ok; i++) {
+        putchar('\n');
+        ok = compile(library, &specs[i]);
+    }
+
+    FT_Done_FreeType(library);
+
+    return ok ? 0 : 1;
+}
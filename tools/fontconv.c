@@ -0,0 +1,243 @@
+/**
+ * Converts the bitmap strips rendered by fonts/canvas.html into the glyph-major font format of src/font.h.
+ *
+ *   fontconv [-w 16] [-h 24] [-f 0x20] [-n 95] [-z] fonts.js array:symbol:name:baseline... > font.c
+ *
+ * A strip is `h` rows of n * w pixels, 1 = ink, glyph i in columns i * w to (i + 1) * w. Every glyph is
+ * cropped to its ink bounds and stored as one contiguous block of byte-padded rows, or RLE-encoded with -z.
+ *
+ *   fontconv ../fonts/fonts.js ubuntu_mono_16x24:font_ubuntu_mono_16x24:"Ubuntu Mono":19 > ../src/font.c
+ */
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "font.h"
+#include "fontgen.h"
+
+#define MAX_FONTS 8
+
+typedef struct font_spec {
+    const char* array;
+    const char* symbol;
+    const char* name;
+    int baseline;
+} font_spec;
+
+static int char_width = 16;
+static int char_height = 24;
+static int first_char = 0x20;
+static int num_chars = 95;
+static int encoding = FONT_ENCODING_RAW;
+
+static char* read_file(const char* path)
+{
+    FILE* file = fopen(path, "rb");
+
+    if (!file) {
+        perror(path);
+        return NULL;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    char* content = malloc(length + 1);
+    if (fread(content, 1, length, file) != (size_t) length) {
+        perror(path);
+        free(content);
+        fclose(file);
+        return NULL;
+    }
+    content[length] = '\0';
+    fclose(file);
+
+    return content;
+}
+
+/**
+ * Reads the integers of `const <array> = [ ... ];` from the fonts.js source.
+ */
+static int parse_array(const char* source, const char* array, uint8_t* out, size_t size)
+{
+    char pattern[128];
+    snprintf(pattern, sizeof(pattern), "const %s = [", array);
+
+    const char* p = strstr(source, pattern);
+    if (!p) {
+        fprintf(stderr, "%s: not found\n", array);
+        return 0;
+    }
+    p += strlen(pattern);
+
+    size_t count = 0;
+    while (*p && *p != ']') {
+        if (isdigit((unsigned char) *p)) {
+            char* end;
+            long value = strtol(p, &end, 10);
+
+            if (count >= size || value > 0xff) {
+                fprintf(stderr, "%s: more than %zu bytes or value out of range\n", array, size);
+                return 0;
+            }
+            out[count++] = value;
+            p = end;
+        } else {
+            p++;
+        }
+    }
+
+    if (count != size) {
+        fprintf(stderr, "%s: %zu bytes, expected %zu\n", array, count, size);
+        return 0;
+    }
+
+    return 1;
+}
+
+static int strip_pixel(const uint8_t* strip, int glyph, int x, int y)
+{
+    int bit = glyph * char_width + x;
+    int row_bytes = char_width * num_chars / 8;
+
+    return (strip[y * row_bytes + bit / 8] >> (7 - bit % 8)) & 1;
+}
+
+static int convert(const char* source, const font_spec* spec)
+{
+    size_t strip_size = (size_t) char_width * char_height * num_chars / 8;
+    uint8_t* strip = malloc(strip_size);
+    uint8_t* cell = malloc((size_t) char_width * char_height);
+    // The strip's glyphs followed by the fallback glyph
+    fontgen_font font = {
+        .encoding = encoding,
+        .symbol = spec->symbol,
+        .name = spec->name,
+        .line_height = char_height,
+        .baseline = spec->baseline,
+        .glyphs = calloc(num_chars + 1, sizeof(fontgen_glyph)),
+        .num_glyphs = num_chars + 1,
+    };
+
+    if (!parse_array(source, spec->array, strip, strip_size)) {
+        free(cell);
+        free(strip);
+        fontgen_free(&font);
+        return 0;
+    }
+
+    for (int glyph = 0; glyph < num_chars; glyph++) {
+        for (int y = 0; y < char_height; y++) {
+            for (int x = 0; x < char_width; x++) {
+                cell[y * char_width + x] = strip_pixel(strip, glyph, x, y);
+            }
+        }
+
+        font.glyphs[glyph].codepoint = first_char + glyph;
+        fontgen_crop(&font.glyphs[glyph], cell, char_width, char_height, 0, 0);
+        font.glyphs[glyph].advance = char_width;
+    }
+
+    // The strips have no fallback glyph: a box from a sixth of the line height down to the baseline
+    font.glyphs[num_chars].codepoint = -1;
+    fontgen_box(&font.glyphs[num_chars], char_width, char_height / 6, spec->baseline - 1);
+
+    size_t size = fontgen_emit(stdout, &font);
+
+    free(cell);
+    free(strip);
+    fontgen_free(&font);
+
+    return size > 0;
+}
+
+static int parse_spec(char* arg, font_spec* spec)
+{
+    char* fields[4];
+
+    for (int i = 0; i < 4; i++) {
+        fields[i] = strsep(&arg, ":");
+        if (!fields[i]) {
+            return 0;
+        }
+    }
+
+    spec->array = fields[0];
+    spec->symbol = fields[1];
+    spec->name = fields[2];
+    spec->baseline = atoi(fields[3]);
+
+    return 1;
+}
+
+static int usage()
+{
+    fprintf(stderr, "usage: fontconv [-w width] [-h height] [-f first_char] [-n num_chars] [-z] fonts.js "
+                    "array:symbol:name:baseline...\n");
+    return 1;
+}
+
+int main(int argc, char** argv)
+{
+    font_spec specs[MAX_FONTS];
+    int num_specs = 0;
+    const char* path = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-z") == 0) {
+            encoding = FONT_ENCODING_RLE;
+        } else if (argv[i][0] == '-' && argv[i][1] && !argv[i][2] && i + 1 < argc) {
+            int value = strtol(argv[++i], NULL, 0);
+
+            switch (argv[i - 1][1]) {
+            case 'w':
+                char_width = value;
+                break;
+            case 'h':
+                char_height = value;
+                break;
+            case 'f':
+                first_char = value;
+                break;
+            case 'n':
+                num_chars = value;
+                break;
+            default:
+                return usage();
+            }
+        } else if (!path) {
+            path = argv[i];
+        } else if (num_specs < MAX_FONTS && parse_spec(argv[i], &specs[num_specs])) {
+            num_specs++;
+        } else {
+            return usage();
+        }
+    }
+
+    if (!path || num_specs == 0 || char_width * num_chars % 8 != 0) {
+        return usage();
+    }
+
+    char* source = read_file(path);
+    if (!source) {
+        return 1;
+    }
+
+    printf("// Generated by tools/fontconv from fonts/fonts.js\n");
+    printf("#include <stdint.h>\n\n#include \"font.h\"\n");
+
+    for (int i = 0; i < num_specs; i++) {
+        putchar('\n');
+        if (!convert(source, &specs[i])) {
+            free(source);
+            return 1;
+        }
+    }
+
+    free(source);
+
+    return 0;
+}
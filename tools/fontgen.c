@@ -0,0 +1,280 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "font.h"
+#include "fontgen.h"
+
+// sizeof(Font) with the target's 32-bit pointers
+#define FONTGEN_TARGET_FONT_SIZE 32
+
+/**
+ * Crops a `cell_width` x `cell_height` cell of pixels (1 = ink) to its ink bounds. The cell's top-left corner
+ * sits at (cell_x, cell_y) relative to the pen at the top of the line; a cell without ink gives an empty glyph.
+ */
+void fontgen_crop(fontgen_glyph* glyph, const uint8_t* cell, int cell_width, int cell_height, int cell_x, int cell_y)
+{
+    int left = cell_width, right = -1, top = cell_height, bottom = -1;
+
+    for (int y = 0; y < cell_height; y++) {
+        for (int x = 0; x < cell_width; x++) {
+            if (cell[y * cell_width + x]) {
+                left = x < left ? x : left;
+                right = x > right ? x : right;
+                top = y < top ? y : top;
+                bottom = y > bottom ? y : bottom;
+            }
+        }
+    }
+
+    glyph->pixels = NULL;
+
+    if (right < 0) {
+        glyph->width = glyph->height = glyph->x_offset = glyph->y_offset = 0;
+        return;
+    }
+
+    glyph->width = right - left + 1;
+    glyph->height = bottom - top + 1;
+    glyph->x_offset = cell_x + left;
+    glyph->y_offset = cell_y + top;
+    glyph->pixels = malloc(glyph->width * glyph->height);
+
+    for (int y = 0; y < glyph->height; y++) {
+        memcpy(glyph->pixels + y * glyph->width, cell + (top + y) * cell_width + left, glyph->width);
+    }
+}
+
+/**
+ * A hollow box from `top` down to `bottom` with a 2-pixel margin to the advance, for fonts without a usable
+ * fallback glyph.
+ */
+void fontgen_box(fontgen_glyph* glyph, int advance, int top, int bottom)
+{
+    int width = advance - 4;
+    int height = bottom - top + 1;
+
+    glyph->width = width;
+    glyph->height = height;
+    glyph->x_offset = 2;
+    glyph->y_offset = top;
+    glyph->advance = advance;
+    glyph->pixels = malloc(width * height);
+
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            glyph->pixels[y * width + x] = y == 0 || y == height - 1 || x == 0 || x == width - 1;
+        }
+    }
+}
+
+void fontgen_free(fontgen_font* font)
+{
+    for (int i = 0; i < font->num_glyphs; i++) {
+        free(font->glyphs[i].pixels);
+    }
+    free(font->glyphs);
+    font->glyphs = NULL;
+    font->num_glyphs = 0;
+}
+
+static void print_binary(FILE* out, uint8_t value)
+{
+    fprintf(out, "0b");
+    for (int bit = 7; bit >= 0; bit--) {
+        fputc('0' + ((value >> bit) & 1), out);
+    }
+}
+
+static void print_char_comment(FILE* out, int32_t c)
+{
+    if (c < 0) {
+        fprintf(out, "// fallback\n");
+    } else if (c == '\\') {
+        // A trailing backslash would continue the comment onto the next line
+        fprintf(out, "// U+%04X\n", c);
+    } else if (c < 0x80) {
+        fprintf(out, "// U+%04X '%c'\n", c, c);
+    } else {
+        fprintf(out, "// U+%04X\n", c);
+    }
+}
+
+/**
+ * Appends the run of `run` bits as nibbles: 15 adds 15 and continues, anything below ends the run.
+ */
+static void put_run(uint8_t* out, size_t* nibbles, uint32_t run)
+{
+    for (;;) {
+        uint8_t value = run >= 15 ? 15 : run;
+
+        out[*nibbles / 2] |= *nibbles % 2 ? value : value << 4;
+        (*nibbles)++;
+        if (value < 15) {
+            return;
+        }
+        run -= 15;
+    }
+}
+
+/**
+ * FONT_ENCODING_RLE: every row is XORed with the row above, then the bits are stored as alternating runs of
+ * 0 and 1 starting with 0. Returns the encoded length; `out` must hold 2 * width * height + 1 bytes.
+ */
+static size_t encode_rle(const fontgen_glyph* glyph, uint8_t* out)
+{
+    size_t nibbles = 0;
+    uint32_t run = 0;
+    int ink = 0;
+
+    memset(out, 0, 2 * glyph->width * glyph->height + 1);
+
+    for (int y = 0; y < glyph->height; y++) {
+        for (int x = 0; x < glyph->width; x++) {
+            int pixel = glyph->pixels[y * glyph->width + x] != 0;
+
+            if (y > 0) {
+                pixel ^= glyph->pixels[(y - 1) * glyph->width + x] != 0;
+            }
+            if (pixel != ink) {
+                put_run(out, &nibbles, run);
+                ink = pixel;
+                run = 0;
+            }
+            run++;
+        }
+    }
+    put_run(out, &nibbles, run);
+
+    return (nibbles + 1) / 2;
+}
+
+static int check_range(const fontgen_font* font, const fontgen_glyph* glyph)
+{
+    if (glyph->width > 255 || glyph->height > 255 || glyph->advance < 0 || glyph->advance > 255 ||
+        glyph->x_offset < -128 || glyph->x_offset > 127 || glyph->y_offset < -128 || glyph->y_offset > 127) {
+        fprintf(stderr, "%s: U+%04X does not fit the glyph table\n", font->symbol, glyph->codepoint);
+        return 0;
+    }
+
+    return 1;
+}
+
+/**
+ * Writes the bitmap, glyph table, range index and Font definition of `font` as C source. Returns the flash
+ * bytes the tables take, or 0 when a glyph does not fit the table's field widths.
+ */
+size_t fontgen_emit(FILE* out, const fontgen_font* font)
+{
+    uint32_t offset = 0;
+    int num_ranges = 0;
+    int fallback = font->num_glyphs - 1;
+
+    for (int i = 0; i < font->num_glyphs; i++) {
+        if (!check_range(font, &font->glyphs[i])) {
+            return 0;
+        }
+    }
+
+    uint32_t* offsets = malloc(font->num_glyphs * sizeof(uint32_t));
+
+    fprintf(out, "static const uint8_t __%s_bitmap[] = {\n", font->symbol);
+
+    for (int i = 0; i < font->num_glyphs; i++) {
+        const fontgen_glyph* glyph = &font->glyphs[i];
+
+        offsets[i] = offset;
+
+        if (glyph->width == 0) {
+            continue;
+        }
+
+        fprintf(out, "    ");
+        print_char_comment(out, glyph->codepoint);
+
+        if (font->encoding == FONT_ENCODING_RLE) {
+            uint8_t* encoded = malloc(2 * glyph->width * glyph->height + 1);
+            size_t length = encode_rle(glyph, encoded);
+
+            for (size_t j = 0; j < length; j++) {
+                fprintf(out, "%s0x%02x,%s", j % 12 == 0 ? "    " : " ", encoded[j],
+                    j % 12 == 11 || j == length - 1 ? "\n" : "");
+            }
+            offset += length;
+            free(encoded);
+            continue;
+        }
+
+        for (int y = 0; y < glyph->height; y++) {
+            const uint8_t* row = glyph->pixels + y * glyph->width;
+
+            fprintf(out, "   ");
+
+            for (int x = 0; x < glyph->width; x += 8) {
+                uint8_t byte = 0;
+
+                for (int bit = 0; bit < 8 && x + bit < glyph->width; bit++) {
+                    byte |= (row[x + bit] != 0) << (7 - bit);
+                }
+                fputc(' ', out);
+                print_binary(out, byte);
+                fputc(',', out);
+            }
+            fputc('\n', out);
+        }
+        offset += (glyph->width + 7) / 8 * glyph->height;
+    }
+
+    fprintf(out, "};\n\n");
+    fprintf(out, "static const Glyph __%s_glyphs[] = {\n", font->symbol);
+
+    for (int i = 0; i < font->num_glyphs; i++) {
+        const fontgen_glyph* glyph = &font->glyphs[i];
+
+        fprintf(out, "    { %5u, %2d, %2d, %2d, %2d, %2d }, ", offsets[i], glyph->width, glyph->height, glyph->x_offset,
+            glyph->y_offset, glyph->advance);
+        print_char_comment(out, glyph->codepoint);
+    }
+
+    free(offsets);
+
+    fprintf(out, "};\n\n");
+    fprintf(out, "static const FontRange __%s_ranges[] = {\n", font->symbol);
+
+    // Every run of consecutive code points becomes a range
+    for (int i = 0; i < fallback;) {
+        int count = 1;
+
+        while (i + count < fallback && font->glyphs[i + count].codepoint == font->glyphs[i].codepoint + count) {
+            count++;
+        }
+        fprintf(out, "    { 0x%04x, %3d, %3d },\n", font->glyphs[i].codepoint, count, i);
+        num_ranges++;
+        i += count;
+    }
+
+    fprintf(out, "};\n\n");
+    fprintf(out, "Font %s = {\n", font->symbol);
+    fprintf(out, "    .version = FONT_VERSION,\n");
+    fprintf(out, "    .encoding = %s,\n", font->encoding == FONT_ENCODING_RLE ? "FONT_ENCODING_RLE" : "FONT_ENCODING_RAW");
+    fprintf(out, "    .line_height = %d,\n", font->line_height);
+    fprintf(out, "    .baseline = %d,\n", font->baseline);
+    fprintf(out, "    .num_glyphs = %d,\n", font->num_glyphs);
+    fprintf(out, "    .num_ranges = %d,\n", num_ranges);
+    fprintf(out, "    .fallback = %d,\n", fallback);
+    fprintf(out, "    .size = sizeof(__%s_bitmap),\n", font->symbol);
+    fprintf(out, "    .name = \"%s\",\n", font->name);
+    fprintf(out, "    .ranges = __%s_ranges,\n", font->symbol);
+    fprintf(out, "    .glyphs = __%s_glyphs,\n", font->symbol);
+    fprintf(out, "    .bitmap = __%s_bitmap,\n", font->symbol);
+    fprintf(out, "};\n");
+
+    size_t glyph_table = font->num_glyphs * sizeof(Glyph);
+    size_t index = num_ranges * sizeof(FontRange);
+    size_t header = FONTGEN_TARGET_FONT_SIZE + strlen(font->name) + 1;
+    size_t total = offset + glyph_table + index + header;
+
+    fprintf(stderr, "%s: %d glyphs, %d ranges: bitmap %u + glyph table %zu + index %zu + font %zu = %zu flash bytes\n",
+        font->symbol, font->num_glyphs, num_ranges, offset, glyph_table, index, header, total);
+
+    return total;
+}
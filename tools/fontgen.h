@@ -0,0 +1,41 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+#ifndef ___FONTGEN_H
+#define ___FONTGEN_H
+
+/**
+ * A glyph on its way into the src/font.h tables: ink pixels cropped to their bounds plus metrics.
+ */
+typedef struct fontgen_glyph {
+    // -1 for the fallback glyph, which has no code point
+    int32_t codepoint;
+    int width;
+    int height;
+    int x_offset;
+    int y_offset;
+    int advance;
+    // width * height bytes, 1 = ink
+    uint8_t* pixels;
+} fontgen_glyph;
+
+typedef struct fontgen_font {
+    // FONT_ENCODING_RAW or FONT_ENCODING_RLE
+    int encoding;
+    const char* symbol;
+    const char* name;
+    int line_height;
+    int baseline;
+    // Sorted by code point, the fallback glyph last
+    fontgen_glyph* glyphs;
+    int num_glyphs;
+} fontgen_font;
+
+void fontgen_crop(fontgen_glyph* glyph, const uint8_t* cell, int cell_width, int cell_height, int cell_x, int cell_y);
+void fontgen_box(fontgen_glyph* glyph, int advance, int top, int bottom);
+void fontgen_free(fontgen_font* font);
+size_t fontgen_emit(FILE* out, const fontgen_font* font);
+
+#endif
@@ -0,0 +1,115 @@
+/**
+ * PackBits encoder/decoder for /framebuffer uploads and downloads.
+ *
+ *   rletool encode frame.raw frame.pb
+ *   rletool decode frame.pb frame.raw [size]
+ *
+ * Raw frames are 1 bit per pixel, MSB first, 1 = white; a full 800x480 frame is 48000 bytes, which is also the
+ * default decoded size.
+ *
+ *   curl --data-binary @frame.pb 'http://192.168.4.1/framebuffer?encoding=packbits'
+ *   curl -o frame.pb 'http://192.168.4.1/framebuffer?encoding=packbits'
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "rle.h"
+
+#define DEFAULT_FRAME_SIZE (800 * 480 / 8)
+
+static void file_emit(const uint8_t* data, size_t length, void* ctx)
+{
+    fwrite(data, 1, length, (FILE*) ctx);
+}
+
+static void file_fill(uint8_t value, size_t length, void* ctx)
+{
+    uint8_t run[128];
+
+    memset(run, value, sizeof(run));
+    while (length > 0) {
+        size_t n = length < sizeof(run) ? length : sizeof(run);
+        fwrite(run, 1, n, (FILE*) ctx);
+        length -= n;
+    }
+}
+
+static int encode(FILE* in, FILE* out)
+{
+    uint8_t chunk[4096];
+    size_t raw = 0;
+    size_t n;
+    rle_encoder encoder;
+
+    rle_encoder_init(&encoder, file_emit, out);
+
+    while ((n = fread(chunk, 1, sizeof(chunk), in)) > 0) {
+        rle_encoder_feed(&encoder, chunk, n);
+        raw += n;
+    }
+
+    size_t encoded = rle_encoder_finish(&encoder);
+    fprintf(stderr, "%zu -> %zu bytes (%.1fx)\n", raw, encoded, encoded ? (double) raw / encoded : 0.0);
+
+    return 0;
+}
+
+static int decode(FILE* in, FILE* out, size_t size)
+{
+    uint8_t chunk[4096];
+    size_t n;
+    rle_sink sink = { .write = file_emit, .fill = file_fill, .ctx = out };
+    rle_decoder decoder;
+
+    rle_decoder_init(&decoder, &sink, size);
+
+    while ((n = fread(chunk, 1, sizeof(chunk), in)) > 0) {
+        if (!rle_decoder_feed(&decoder, chunk, n)) {
+            fprintf(stderr, "decoded data exceeds %zu bytes\n", size);
+            return 1;
+        }
+    }
+
+    if (!rle_decoder_finish(&decoder)) {
+        fprintf(stderr, "truncated input: %zu of %zu bytes decoded\n", decoder.decoded, size);
+        return 1;
+    }
+
+    return 0;
+}
+
+static int usage()
+{
+    fprintf(stderr, "usage: rletool encode <raw> <packed>\n       rletool decode <packed> <raw> [size]\n");
+    return 2;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 4) {
+        return usage();
+    }
+
+    FILE* in = fopen(argv[2], "rb");
+    FILE* out = fopen(argv[3], "wb");
+    int ret;
+
+    if (!in || !out) {
+        perror("rletool");
+        return 1;
+    }
+
+    if (strcmp(argv[1], "encode") == 0) {
+        ret = encode(in, out);
+    } else if (strcmp(argv[1], "decode") == 0) {
+        ret = decode(in, out, argc > 4 ? strtoul(argv[4], NULL, 10) : DEFAULT_FRAME_SIZE);
+    } else {
+        ret = usage();
+    }
+
+    fclose(in);
+    fclose(out);
+
+    return ret;
+}